@@ -0,0 +1,337 @@
+#include "socrates.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+// Compares every fast path in Socrates against its reference function (or the exact result) and reports
+// the maximum and mean ULP error as well as the maximum relative error.
+// The program fails (returns 1) if any of the fast paths goes over its documented bound.
+
+struct ErrorStats {
+  const char* name;
+  double bound_ulp;
+
+  double max_ulp;
+  double sum_ulp;
+  double max_rel;
+  soc::uint64 samples;
+};
+
+// Returns the distance between `value` and the next representable float after it
+static double ulp_of(const float value) {
+  float mag = std::fabs(value);
+  if(mag < SOC_EPSILON) {
+    mag = SOC_EPSILON;
+  }
+
+  return (double)(std::nextafter(mag, SOC_FLOAT_MAX) - mag);
+}
+
+// Adds a sample of `fast` against `ref` where `scale` is the magnitude used for the ULP
+static void stats_add(ErrorStats& stats, const float fast, const float ref, const float scale) {
+  double diff = std::fabs((double)fast - (double)ref);
+  double ulp  = diff / ulp_of(scale);
+  double rel  = diff / std::fabs((double)scale);
+
+  stats.max_ulp  = ulp > stats.max_ulp ? ulp : stats.max_ulp;
+  stats.max_rel  = rel > stats.max_rel ? rel : stats.max_rel;
+  stats.sum_ulp += ulp;
+  stats.samples++;
+}
+
+static ErrorStats stats_create(const char* name, const double bound_ulp) {
+  return ErrorStats{name, bound_ulp, 0.0, 0.0, 0.0, 0};
+}
+
+// Returns a random float between `min` and `max`
+static float random_float(const float min, const float max) {
+  return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static ErrorStats test_rsqrt() {
+  ErrorStats stats = stats_create("rsqrt_fast", 4.0);
+
+  // Logarithmic sweep over [1e-30, 1e30]
+  for(double e = -30.0; e <= 30.0; e += 0.0001) {
+    float x   = (float)std::pow(10.0, e);
+    float ref = (float)(1.0 / std::sqrt((double)x));
+
+    stats_add(stats, soc::rsqrt_fast(x), ref, ref);
+  }
+
+  return stats;
+}
+
+static ErrorStats test_vec3_normalize() {
+  ErrorStats stats = stats_create("vec3_normalize_fast", 6.0);
+
+  for(soc::uint32 i = 0; i < 1000000; i++) {
+    float scale = std::pow(10.0f, random_float(-3.0f, 3.0f));
+    soc::Vector3 v(random_float(-1.0f, 1.0f) * scale, random_float(-1.0f, 1.0f) * scale, random_float(-1.0f, 1.0f) * scale);
+
+    soc::Vector3 fast = soc::vec3_normalize_fast(v);
+    soc::Vector3 ref  = soc::vec3_normalize(v);
+
+    float mag = std::fmax(std::fabs(ref.x), std::fmax(std::fabs(ref.y), std::fabs(ref.z)));
+    stats_add(stats, fast.x, ref.x, mag);
+    stats_add(stats, fast.y, ref.y, mag);
+    stats_add(stats, fast.z, ref.z, mag);
+  }
+
+  return stats;
+}
+
+static ErrorStats test_sincos() {
+  ErrorStats stats = stats_create("sincos_fast", 2.0);
+
+  for(float x = -8192.0f; x <= 8192.0f; x += 0.0037f) {
+    soc::Vector2 fast = soc::sincos_fast(x);
+    float s         = (float)soc::sin(x);
+    float c         = (float)soc::cos(x);
+    float mag       = std::fmax(std::fabs(s), std::fabs(c));
+
+    stats_add(stats, fast.x, s, mag);
+    stats_add(stats, fast.y, c, mag);
+  }
+
+  return stats;
+}
+
+static ErrorStats test_log() {
+  ErrorStats stats = stats_create("log_fast", 2.0);
+
+  for(double e = -30.0; e <= 30.0; e += 0.0001) {
+    float x   = (float)std::pow(10.0, e);
+    float ref = (float)std::log((double)x);
+
+    stats_add(stats, soc::log_fast(x), ref, ref);
+  }
+
+  return stats;
+}
+
+static ErrorStats test_exp() {
+  ErrorStats stats = stats_create("exp_fast", 2.0);
+
+  for(float x = -87.0f; x <= 88.0f; x += 0.001f) {
+    float ref = (float)std::exp((double)x);
+    stats_add(stats, soc::exp_fast(x), ref, ref);
+  }
+
+  return stats;
+}
+
+// Returns the exact sRGB to linear transfer function of `c` 
+static float srgb_to_linear_ref(const double c) {
+  return (float)(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+}
+
+// Returns the exact linear to sRGB transfer function of `c` 
+static float linear_to_srgb_ref(const double c) {
+  return (float)(c <= 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055);
+}
+
+static ErrorStats test_srgb_to_linear() {
+  ErrorStats stats = stats_create("srgb_to_linear", 16.0);
+
+  for(float c = 0.0f; c <= 1.0f; c += 0.000001f) {
+    float ref = srgb_to_linear_ref(c);
+    stats_add(stats, soc::color_srgb_to_linear_channel(c), ref, ref);
+  }
+
+  return stats;
+}
+
+static ErrorStats test_linear_to_srgb() {
+  ErrorStats stats = stats_create("linear_to_srgb", 12.0);
+
+  for(float c = 0.0f; c <= 1.0f; c += 0.000001f) {
+    float ref = linear_to_srgb_ref(c);
+    stats_add(stats, soc::color_linear_to_srgb_channel(c), ref, ref);
+  }
+
+  return stats;
+}
+
+// Returns a random, well-conditioned transformation or projection matrix
+static soc::Matrix4 random_matrix() {
+  if(rand() % 4 == 0) {
+    return soc::mat4_perspective(random_float(0.5f, 2.0f), random_float(0.5f, 2.0f), random_float(0.01f, 1.0f), random_float(10.0f, 1000.0f));
+  }
+
+  soc::Vector3 axis(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(0.1f, 1.0f));
+  soc::Vector3 pos(random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f));
+  soc::Vector3 scale(random_float(0.25f, 4.0f), random_float(0.25f, 4.0f), random_float(0.25f, 4.0f));
+
+  return soc::mat4_translate(pos) * soc::mat4_rotate(axis, random_float(-3.0f, 3.0f)) * soc::mat4_scale(scale);
+}
+
+// Returns the exact inverse of `m` (Gauss-Jordan elimination with partial pivoting in doubles)
+static void mat4_inverse_ref(const soc::Matrix4& m, double* out) {
+  double rows[4][8];
+  for(soc::uint32 i = 0; i < 4; i++) {
+    for(soc::uint32 j = 0; j < 4; j++) {
+      rows[i][j]     = (double)m[i * 4 + j];
+      rows[i][j + 4] = i == j ? 1.0 : 0.0;
+    }
+  }
+
+  for(soc::uint32 col = 0; col < 4; col++) {
+    soc::uint32 pivot = col;
+    for(soc::uint32 i = col + 1; i < 4; i++) {
+      pivot = std::fabs(rows[i][col]) > std::fabs(rows[pivot][col]) ? i : pivot;
+    }
+
+    for(soc::uint32 j = 0; j < 8; j++) {
+      double temp    = rows[col][j];
+      rows[col][j]   = rows[pivot][j];
+      rows[pivot][j] = temp;
+    }
+
+    double inv_pivot = 1.0 / rows[col][col];
+    for(soc::uint32 j = 0; j < 8; j++) {
+      rows[col][j] *= inv_pivot;
+    }
+
+    for(soc::uint32 i = 0; i < 4; i++) {
+      if(i == col) {
+        continue;
+      }
+
+      double factor = rows[i][col];
+      for(soc::uint32 j = 0; j < 8; j++) {
+        rows[i][j] -= factor * rows[col][j];
+      }
+    }
+  }
+
+  // The inverse of the transpose is the transpose of the inverse, so the storage order does not matter here
+  for(soc::uint32 i = 0; i < 4; i++) {
+    for(soc::uint32 j = 0; j < 4; j++) {
+      out[i * 4 + j] = rows[i][j + 4];
+    }
+  }
+}
+
+// Both inverses get measured against the exact one, since they are meant to be the same algorithm
+static ErrorStats test_mat4_inverse(const char* name, const soc::Matrix4 (*inverse)(const soc::Matrix4&)) {
+  ErrorStats stats = stats_create(name, 16.0);
+  srand(4321);
+
+  for(soc::uint32 i = 0; i < 200000; i++) {
+    soc::Matrix4 mat = random_matrix();
+    soc::Matrix4 inv = inverse(mat);
+
+    double ref[16];
+    mat4_inverse_ref(mat, ref);
+
+    float mag = 0.0f;
+    for(soc::uint32 j = 0; j < 16; j++) {
+      mag = std::fmax(mag, std::fabs((float)ref[j]));
+    }
+
+    for(soc::uint32 j = 0; j < 16; j++) {
+      stats_add(stats, inv[j], (float)ref[j], mag);
+    }
+  }
+
+  return stats;
+}
+
+static ErrorStats test_quat_set_mat3() {
+  ErrorStats stats = stats_create("quat_set_mat3_fast", 16.0);
+
+  for(soc::uint32 i = 0; i < 1000000; i++) {
+    soc::Vector3 axis(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f));
+    if(soc::vec3_length(axis) < 0.01f) {
+      continue;
+    }
+
+    soc::Matrix3 mat     = soc::mat3_rotate(axis, random_float(-3.14f, 3.14f));
+    soc::Quaternion fast = soc::quat_set_mat3_fast(mat);
+    soc::Quaternion ref  = soc::quat_set_mat3(mat);
+
+    // Both `q` and `-q` are the same rotation
+    float sign = soc::quat_dot(fast, ref) < 0.0f ? -1.0f : 1.0f;
+    float mag  = std::fmax(std::fmax(std::fabs(ref.x), std::fabs(ref.y)), std::fmax(std::fabs(ref.z), std::fabs(ref.w)));
+
+    stats_add(stats, fast.x * sign, ref.x, mag);
+    stats_add(stats, fast.y * sign, ref.y, mag);
+    stats_add(stats, fast.z * sign, ref.z, mag);
+    stats_add(stats, fast.w * sign, ref.w, mag);
+  }
+
+  return stats;
+}
+
+// Converts rotations into Euler angles and back for every order, with half of the second angles at or right next 
+// to the gimbal lock (`±PI/2`), and measures how far the rotation ends up from where it started
+static ErrorStats test_quat_to_euler() {
+  ErrorStats stats = stats_create("quat_to_euler", 16.0);
+
+  for(soc::uint32 i = 0; i < 600000; i++) {
+    soc::EulerOrder order = (soc::EulerOrder)(i % 6);
+    soc::uint32 axes[3];
+    soc::euler_order_axes(order, axes);
+
+    soc::Vector3 angles(random_float(-3.0f, 3.0f), random_float(-3.0f, 3.0f), random_float(-3.0f, 3.0f));
+    if(i % 12 < 6) {
+      float lock = (float)(SOC_PI * 0.5) - (i % 4 < 2 ? 0.0f : random_float(0.0f, 2e-3f));
+      angles.components[axes[1]] = i % 2 ? lock : -lock;
+    }
+    else {
+      angles.components[axes[1]] = random_float(-1.5f, 1.5f);
+    }
+
+    soc::Quaternion ref  = soc::quat_from_euler(angles, order);
+    soc::Quaternion back = soc::quat_from_euler(soc::quat_to_euler(ref, order), order);
+
+    // Both `q` and `-q` are the same rotation
+    float sign = soc::quat_dot(back, ref) < 0.0f ? -1.0f : 1.0f;
+    float mag  = std::fmax(std::fmax(std::fabs(ref.x), std::fabs(ref.y)), std::fmax(std::fabs(ref.z), std::fabs(ref.w)));
+
+    stats_add(stats, back.x * sign, ref.x, mag);
+    stats_add(stats, back.y * sign, ref.y, mag);
+    stats_add(stats, back.z * sign, ref.z, mag);
+    stats_add(stats, back.w * sign, ref.w, mag);
+  }
+
+  return stats;
+}
+
+int main() {
+  srand(1234);
+
+  ErrorStats results[] = {
+    test_rsqrt(),
+    test_vec3_normalize(),
+    test_sincos(),
+    test_log(),
+    test_exp(),
+    test_srgb_to_linear(),
+    test_linear_to_srgb(),
+    test_mat4_inverse("mat4_inverse", soc::mat4_inverse),
+    test_mat4_inverse("mat4_inverse_fast", soc::mat4_inverse_fast),
+    test_quat_set_mat3(),
+    test_quat_to_euler(),
+  };
+
+  bool has_failed = false;
+
+  printf("%-22s %12s %12s %14s %10s %s\n", "function", "max ulp", "mean ulp", "max rel err", "bound", "result");
+  for(const ErrorStats& stats : results) {
+    bool passed = stats.max_ulp <= stats.bound_ulp;
+    has_failed  = has_failed || !passed;
+
+    printf("%-22s %12.3f %12.3f %14.3e %10.1f %s\n",
+           stats.name,
+           stats.max_ulp,
+           stats.sum_ulp / (double)stats.samples,
+           stats.max_rel,
+           stats.bound_ulp,
+           passed ? "PASS" : "FAIL");
+  }
+
+  return has_failed ? 1 : 0;
+}
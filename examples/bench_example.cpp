@@ -0,0 +1,882 @@
+#include "socrates.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Throughput benchmarks of the batch functions in Socrates. 
+// Run `Soc_Bench <name>` to only run the benchmarks whose name starts with `<name>`.
+// NOTE: Make sure to build this one with optimizations on, since the numbers mean nothing otherwise.
+
+// Returns the current time in seconds
+static double time_now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Returns a random float between `min` and `max`
+static float random_float(const float min, const float max) {
+  return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+// Prints the throughput of `count` items that took `seconds` to process
+static void bench_report(const char* name, const soc::uint32 count, const double seconds) {
+  printf("%-32s %10u items %10.3f ms %10.2f M items/s\n", name, count, seconds * 1000.0, (double)count / seconds / 1000000.0);
+}
+
+static std::vector<soc::Vector3> random_points(const soc::uint32 count) {
+  std::vector<soc::Vector3> points(count);
+  for(soc::Vector3& point : points) {
+    point = soc::Vector3(random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f));
+  }
+
+  return points;
+}
+
+static void bench_anim(const soc::uint32 count) {
+  // A clip of 64 tracks with 30 keys each (like a short character animation at 15 keys a second) 
+  // shared by every instance
+  const soc::uint32 tracks_count = 64;
+  const soc::uint32 keys_count   = 30;
+
+  std::vector<soc::uint32> offsets(tracks_count + 1);
+  std::vector<float> times(tracks_count * keys_count);
+  std::vector<soc::Vector3> translations(tracks_count * keys_count), scales(tracks_count * keys_count);
+  std::vector<soc::Quaternion> rotations(tracks_count * keys_count);
+
+  for(soc::uint32 i = 0; i < tracks_count * keys_count; i++) {
+    times[i]        = (float)(i % keys_count) * (2.0f / (float)(keys_count - 1));
+    translations[i] = soc::Vector3(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f));
+    scales[i]       = soc::Vector3(random_float(0.9f, 1.1f), random_float(0.9f, 1.1f), random_float(0.9f, 1.1f));
+    rotations[i]    = soc::quat_from_euler(soc::Vector3(random_float(-SOC_PI, SOC_PI), random_float(-SOC_PI, SOC_PI), random_float(-SOC_PI, SOC_PI)), 
+                                           soc::EULER_ORDER_XYZ);
+  }
+  for(soc::uint32 i = 0; i <= tracks_count; i++) {
+    offsets[i] = i * keys_count;
+  }
+
+  soc::AnimationClip clip;
+  clip.duration            = 2.0f;
+  clip.tracks_count        = tracks_count;
+  clip.translation_offsets = offsets.data();
+  clip.translation_times   = times.data();
+  clip.translations        = translations.data();
+  clip.rotation_offsets    = offsets.data();
+  clip.rotation_times      = times.data();
+  clip.rotations           = rotations.data();
+  clip.scale_offsets       = offsets.data();
+  clip.scale_times         = times.data();
+  clip.scales              = scales.data();
+
+  std::vector<soc::uint32> cursors((soc::uint64)count * tracks_count * 3);
+  std::vector<soc::Vector3> pose_translations((soc::uint64)count * tracks_count), pose_scales((soc::uint64)count * tracks_count);
+  std::vector<soc::Quaternion> pose_rotations((soc::uint64)count * tracks_count);
+
+  std::vector<soc::AnimationInstance> instances(count);
+  std::vector<soc::AnimationPose> poses(count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    instances[i]       = soc::anim_instance_create(clip, &cursors[(soc::uint64)i * tracks_count * 3]);
+    instances[i].time  = random_float(0.0f, clip.duration);
+    instances[i].speed = random_float(0.5f, 1.5f);
+
+    soc::uint64 first = (soc::uint64)i * tracks_count;
+    poses[i]          = soc::AnimationPose{&pose_translations[first], &pose_rotations[first], &pose_scales[first]};
+  }
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::anim_instance_advance(instances[i], 1.0f / 60.0f);
+    soc::anim_sample(instances[i], poses[i]);
+  }
+  bench_report("anim_sample per instance", count, time_now() - start);
+
+  start = time_now();
+  soc::anim_sample_batch(instances.data(), poses.data(), count, 1.0f / 60.0f);
+  bench_report("anim_sample_batch", count, time_now() - start);
+}
+
+static void bench_morton(const soc::uint32 count) {
+  std::vector<soc::Vector3> points = random_points(count);
+  soc::AABB bounds                 = soc::aabb_from_points(points.data(), count);
+
+  std::vector<soc::uint32> codes32(count), values(count), scratch_codes32(count), scratch_values(count);
+  std::vector<soc::uint64> codes64(count), scratch_codes64(count);
+
+  double start = time_now();
+  soc::morton_encode30_batch(points.data(), count, bounds, codes32.data());
+  bench_report("morton_encode30_batch", count, time_now() - start);
+
+  start = time_now();
+  soc::morton_encode63_batch(points.data(), count, bounds, codes64.data());
+  bench_report("morton_encode63_batch", count, time_now() - start);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    values[i] = i;
+  }
+
+  start = time_now();
+  soc::radix_sort32(codes32.data(), values.data(), count, scratch_codes32.data(), scratch_values.data());
+  bench_report("radix_sort32 (30 bits)", count, time_now() - start);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    values[i] = i;
+  }
+
+  start = time_now();
+  soc::radix_sort64(codes64.data(), values.data(), count, scratch_codes64.data(), scratch_values.data());
+  bench_report("radix_sort64 (63 bits)", count, time_now() - start);
+
+  for(soc::uint32 i = 1; i < count; i++) {
+    if(codes32[i - 1] > codes32[i] || codes64[i - 1] > codes64[i]) {
+      printf("ERROR: The Morton codes are not sorted\n");
+      exit(1);
+    }
+  }
+}
+
+static void bench_soa(const soc::uint32 count) {
+  std::vector<soc::Vector3> a = random_points(count);
+  std::vector<soc::Vector3> b = random_points(count);
+  std::vector<soc::Vector3> out(count);
+  std::vector<float> dots(soc::soa_padded_count(count));
+
+  std::vector<char> memory_a(soc::vec3_soa_memory_size(count));
+  std::vector<char> memory_b(soc::vec3_soa_memory_size(count));
+  soc::Vector3SoA soa_a = soc::vec3_soa_create(memory_a.data(), count);
+  soc::Vector3SoA soa_b = soc::vec3_soa_create(memory_b.data(), count);
+
+  // Normalize + cross + dot, one element at a time
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    out[i]  = soc::vec3_cross(soc::vec3_normalize(a[i]), b[i]);
+    dots[i] = soc::vec3_dot(out[i], b[i]);
+  }
+  bench_report("vec3_* per element", count, time_now() - start);
+
+  // The same thing with the SoA kernels, including both transposes
+  start = time_now();
+  soc::vec3_soa_from_aos(a.data(), count, soa_a);
+  soc::vec3_soa_from_aos(b.data(), count, soa_b);
+  double kernels_start = time_now();
+  soc::vec3_soa_normalize(soa_a, soa_a);
+  soc::vec3_soa_cross(soa_a, soa_b, soa_a);
+  soc::vec3_soa_dot(soa_a, soa_b, dots.data());
+  double kernels_end = time_now();
+  soc::vec3_soa_to_aos(soa_a, out.data());
+  bench_report("vec3_soa_* with transposes", count, time_now() - start);
+  bench_report("vec3_soa_* kernels only", count, kernels_end - kernels_start);
+}
+
+static void bench_decompose(const soc::uint32 count) {
+  std::vector<soc::Matrix4> matrices(count);
+  std::vector<soc::Transform> transforms(count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Quaternion rot = soc::quat_normalize(soc::Quaternion(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f)));
+    soc::Vector3 scale(random_float(0.5f, 2.0f), random_float(0.5f, 2.0f), random_float(0.5f, 2.0f));
+
+    matrices[i] = soc::mat4_compose(soc::Transform(soc::Vector3(random_float(-100.0f, 100.0f)), rot, scale));
+  }
+
+  std::vector<char> memory_t(soc::vec3_soa_memory_size(count));
+  std::vector<char> memory_r(soc::quat_soa_memory_size(count));
+  std::vector<char> memory_s(soc::vec3_soa_memory_size(count));
+  soc::Vector3SoA translations = soc::vec3_soa_create(memory_t.data(), count);
+  soc::QuaternionSoA rotations = soc::quat_soa_create(memory_r.data(), count);
+  soc::Vector3SoA scales       = soc::vec3_soa_create(memory_s.data(), count);
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    transforms[i] = soc::mat4_decompose(matrices[i]);
+  }
+  bench_report("mat4_decompose", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    transforms[i] = soc::mat4_decompose_polar(matrices[i]);
+  }
+  bench_report("mat4_decompose_polar", count, time_now() - start);
+
+  start = time_now();
+  soc::mat4_decompose_batch(matrices.data(), count, translations, rotations, scales);
+  bench_report("mat4_decompose_batch", count, time_now() - start);
+}
+
+static void bench_rotate(const soc::uint32 count) {
+  std::vector<soc::Vector3> vectors = random_points(count);
+  std::vector<soc::Vector3> out(count);
+  std::vector<soc::Quaternion> rotations(count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    rotations[i] = soc::quat_normalize(soc::Quaternion(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f)));
+  }
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    out[i] = soc::mat4_transform_vector(soc::quat_get_mat4(rotations[i]), vectors[i]);
+  }
+  bench_report("quat_get_mat4 + transform", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    out[i] = soc::quat_rotate_vec3(rotations[i], vectors[i]);
+  }
+  bench_report("quat_rotate_vec3", count, time_now() - start);
+
+  start = time_now();
+  soc::quat_rotate_vec3_batch(rotations.data(), vectors.data(), count, out.data());
+  bench_report("quat_rotate_vec3_batch", count, time_now() - start);
+
+  start = time_now();
+  soc::quat_rotate_vec3_batch_single(rotations[0], vectors.data(), count, out.data());
+  bench_report("quat_rotate_vec3_batch_single", count, time_now() - start);
+}
+
+static void bench_euler(const soc::uint32 count) {
+  std::vector<soc::Vector3> angles(count);
+  std::vector<soc::Quaternion> out(count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    angles[i] = soc::Vector3(random_float(-SOC_PI, SOC_PI), random_float(-SOC_PI, SOC_PI), random_float(-SOC_PI, SOC_PI));
+  }
+
+  // The old way with 3 axis rotations multiplied together
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    out[i] = soc::quat_axis_angle(soc::Vector3(0.0f, 0.0f, 1.0f), angles[i].z) * 
+             soc::quat_axis_angle(soc::Vector3(0.0f, 1.0f, 0.0f), angles[i].y) * 
+             soc::quat_axis_angle(soc::Vector3(1.0f, 0.0f, 0.0f), angles[i].x);
+  }
+  bench_report("quat_axis_angle x3", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    out[i] = soc::quat_from_euler(angles[i], soc::EULER_ORDER_XYZ);
+  }
+  bench_report("quat_from_euler", count, time_now() - start);
+
+  start = time_now();
+  soc::quat_from_euler_batch(angles.data(), count, soc::EULER_ORDER_XYZ, out.data());
+  bench_report("quat_from_euler_batch", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    angles[i] = soc::quat_to_euler(out[i], soc::EULER_ORDER_XYZ);
+  }
+  bench_report("quat_to_euler", count, time_now() - start);
+}
+
+static void bench_particles(const soc::uint32 count) {
+  std::vector<soc::Vector3> positions = random_points(count);
+  std::vector<soc::Vector3> velocities = random_points(count);
+  std::vector<float> lifetimes(count);
+
+  std::vector<char> memory(soc::particle_system_memory_size(count));
+  soc::ParticleSystem system = soc::particle_system_create(memory.data(), count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    lifetimes[i] = random_float(0.5f, 5.0f);
+    soc::particle_emit(system, positions[i], velocities[i], lifetimes[i]);
+  }
+
+  soc::Vector3 gravity(0.0f, -9.81f, 0.0f);
+  float drag = 0.1f;
+  float dt   = 1.0f / 60.0f;
+
+  // The old way with the `Vector3` operators, one particle at a time
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    velocities[i] += (gravity - velocities[i] * drag) * dt;
+    positions[i]  += velocities[i] * dt;
+    lifetimes[i]  -= dt;
+  }
+  bench_report("Vector3 operators", count, time_now() - start);
+
+  const char* names[] = {"particle_integrate euler", "particle_integrate semi-implicit", "particle_integrate verlet"};
+  for(soc::uint32 i = 0; i < 3; i++) {
+    start = time_now();
+    soc::particle_integrate(system, (soc::ParticleIntegrator)i, gravity, drag, dt, 1);
+    bench_report(names[i], count, time_now() - start);
+  }
+
+  soc::uint32 threads = std::thread::hardware_concurrency();
+  start               = time_now();
+  soc::particle_integrate(system, soc::PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER, gravity, drag, dt, threads);
+  bench_report("particle_integrate all threads", count, time_now() - start);
+
+  // Killing about 1 in 10 particles
+  soc::particle_integrate(system, soc::PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER, gravity, drag, 0.95f, 1);
+
+  start = time_now();
+  soc::particle_compact(system);
+  bench_report("particle_compact", count, time_now() - start);
+}
+
+static void bench_rigid_bodies(const soc::uint32 count) {
+  std::vector<soc::Vector3> positions  = random_points(count);
+  std::vector<soc::Vector3> velocities(count, soc::Vector3(0.0f));
+  std::vector<soc::Vector3> spins      = random_points(count);
+  std::vector<soc::Vector3> torques    = random_points(count);
+  std::vector<soc::Vector3> inertias(count);
+  std::vector<soc::Quaternion> orientations(count);
+  std::vector<soc::Matrix3> world_inertias(count);
+
+  std::vector<char> memory(soc::rigid_body_soa_memory_size(count));
+  soc::RigidBodySoA bodies = soc::rigid_body_soa_create(memory.data(), count);
+  for(soc::uint32 i = 0; i < count; i++) {
+    spins[i]        = spins[i] * 0.01f;
+    inertias[i]     = soc::Vector3(random_float(0.5f, 2.0f), random_float(0.5f, 2.0f), random_float(0.5f, 2.0f));
+    orientations[i] = soc::quat_axis_angle(soc::vec3_normalize(positions[i]), random_float(-3.0f, 3.0f));
+
+    soc::rigid_body_add(bodies, positions[i], orientations[i], 1.0f, inertias[i]);
+    bodies.angular_velocities.x[i] = spins[i].x;
+    bodies.angular_velocities.y[i] = spins[i].y;
+    bodies.angular_velocities.z[i] = spins[i].z;
+  }
+
+  soc::Vector3 gravity(0.0f, -9.81f, 0.0f);
+  float drag = 0.1f;
+  float dt   = 1.0f / 60.0f;
+
+  // A few frames each, like a real physics step
+  const soc::uint32 frames = 10;
+
+  // The old way with a whole `Matrix3` for the rotation and two matrix multiplies, one body at a time
+  double start = time_now();
+  for(soc::uint32 frame = 0; frame < frames; frame++) {
+    for(soc::uint32 i = 0; i < count; i++) {
+      soc::Matrix3 rotation = soc::quat_get_mat3(orientations[i]);
+      soc::Matrix3 inertia  = soc::mat3_transpose(rotation) * soc::Matrix3(inertias[i].x, 0.0f, 0.0f, 0.0f, inertias[i].y, 0.0f, 0.0f, 0.0f, inertias[i].z) * rotation;
+
+      velocities[i] += (gravity - velocities[i] * drag) * dt;
+      positions[i]  += velocities[i] * dt;
+      spins[i]      += ((torques[i] * inertia) - spins[i] * drag) * dt;
+
+      soc::Quaternion spin(spins[i] * (dt * 0.5f), 0.0f);
+      orientations[i]   = soc::quat_normalize(orientations[i] + (spin * orientations[i]));
+      world_inertias[i] = inertia;
+    }
+  }
+  bench_report("Matrix3 and Quaternion operators", count * frames, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 frame = 0; frame < frames; frame++) {
+    soc::rigid_body_integrate(bodies, gravity, drag, drag, dt, 1);
+  }
+  bench_report("rigid_body_integrate", count * frames, time_now() - start);
+
+  soc::uint32 threads = std::thread::hardware_concurrency();
+  start               = time_now();
+  for(soc::uint32 frame = 0; frame < frames; frame++) {
+    soc::rigid_body_integrate(bodies, gravity, drag, drag, dt, threads);
+  }
+  bench_report("rigid_body_integrate all threads", count * frames, time_now() - start);
+}
+
+static void bench_noise(const soc::uint32 count) {
+  std::vector<soc::Vector3> points = random_points(count);
+  std::vector<float> values(count);
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    values[i] = soc::noise_simplex3(points[i]);
+  }
+  bench_report("noise_simplex3 per point", count, time_now() - start);
+
+  start = time_now();
+  soc::noise_fbm3_batch(soc::NOISE_SIMPLEX, points.data(), count, 1, 2.0f, 0.5f, values.data());
+  bench_report("noise_fbm3_batch simplex", count, time_now() - start);
+
+  start = time_now();
+  soc::noise_fbm3_batch(soc::NOISE_PERLIN, points.data(), count, 1, 2.0f, 0.5f, values.data());
+  bench_report("noise_fbm3_batch perlin", count, time_now() - start);
+
+  // A square heightmap with 4 octaves, which is 4 samples per cell
+  soc::uint32 size = (soc::uint32)std::sqrt((double)count);
+  start            = time_now();
+  soc::noise_fbm2_grid(soc::NOISE_SIMPLEX, soc::Vector2(0.0f), soc::Vector2(0.01f), size, size, 4, 2.0f, 0.5f, values.data());
+  bench_report("noise_fbm2_grid 4 octaves", size * size * 4, time_now() - start);
+}
+
+static void bench_spline(const soc::uint32 count) {
+  // A camera rail with 64 control points shared by every agent
+  std::vector<soc::Vector3> points = random_points(64);
+  soc::uint32 segments             = soc::spline_segments_count(soc::SPLINE_CATMULL_ROM, 64);
+
+  std::vector<char> memory(soc::spline_memory_size(segments, segments * 8));
+  soc::Spline spline = soc::spline_create(memory.data(), soc::SPLINE_CATMULL_ROM, points.data(), 64, segments * 8);
+
+  std::vector<float> distances(count);
+  for(float& distance : distances) {
+    distance = random_float(0.0f, spline.length);
+  }
+
+  std::vector<soc::Vector3> positions(count), tangents(count);
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    float t      = soc::spline_param_at_distance(spline, distances[i]);
+    positions[i] = soc::spline_evaluate(spline, t);
+    tangents[i]  = soc::spline_tangent(spline, t);
+  }
+  bench_report("spline_evaluate per point", count, time_now() - start);
+
+  start = time_now();
+  soc::spline_evaluate_distance_batch(spline, distances.data(), count, positions.data(), tangents.data());
+  bench_report("spline_evaluate_distance_batch", count, time_now() - start);
+
+  start = time_now();
+  soc::spline_create(memory.data(), soc::SPLINE_CATMULL_ROM, points.data(), 64, segments * 8);
+  bench_report("spline_create (segments)", segments, time_now() - start);
+}
+
+static void bench_random(const soc::uint32 count) {
+  std::vector<soc::Vector3> vectors(count);
+  std::vector<float> values(count);
+
+  // The old way with `rand`
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    values[i] = random_float(0.0f, 1.0f);
+  }
+  bench_report("rand", count, time_now() - start);
+
+  soc::Random random = soc::random_create(1234, 0);
+  start              = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    values[i] = soc::random_float(random);
+  }
+  bench_report("random_float", count, time_now() - start);
+
+  soc::Randomx8 randomx8 = soc::randomx8_create(1234, 0);
+  start                  = time_now();
+  soc::random_float_batch(randomx8, 0.0f, 1.0f, count, values.data());
+  bench_report("random_float_batch", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    vectors[i] = soc::random_unit_vec3(random);
+  }
+  bench_report("random_unit_vec3", count, time_now() - start);
+
+  start = time_now();
+  soc::random_unit_vec3_batch(randomx8, count, vectors.data());
+  bench_report("random_unit_vec3_batch", count, time_now() - start);
+
+  start = time_now();
+  soc::random_vec3_in_aabb_batch(randomx8, soc::AABB(soc::Vector3(-100.0f), soc::Vector3(100.0f)), count, vectors.data());
+  bench_report("random_vec3_in_aabb_batch", count, time_now() - start);
+}
+
+static void bench_collision(const soc::uint32 count) {
+  std::vector<soc::Vector3> points = random_points(count * 4);
+
+  std::vector<soc::Sphere> spheres(count * 2);
+  std::vector<soc::Capsule> capsules(count * 2);
+  std::vector<soc::OBB> boxes(count * 2);
+
+  std::vector<char> memory(soc::sphere_soa_memory_size(count) * 2 + soc::capsule_soa_memory_size(count) * 2 + 
+                           soc::obb_soa_memory_size(count) * 2 + soc::contact_soa_memory_size(count));
+  char* ptr = memory.data();
+
+  soc::SphereSoA sphere_soas[2];
+  soc::CapsuleSoA capsule_soas[2];
+  soc::OBBSoA box_soas[2];
+  for(soc::uint32 s = 0; s < 2; s++) {
+    sphere_soas[s]  = soc::sphere_soa_create(ptr, count);
+    ptr            += soc::sphere_soa_memory_size(count);
+    capsule_soas[s] = soc::capsule_soa_create(ptr, count);
+    ptr            += soc::capsule_soa_memory_size(count);
+    box_soas[s]     = soc::obb_soa_create(ptr, count);
+    ptr            += soc::obb_soa_memory_size(count);
+  }
+  soc::ContactSoA contacts = soc::contact_soa_create(ptr, count);
+
+  // Pairs close enough to each other that about half of them touch
+  for(soc::uint32 i = 0; i < count * 2; i++) {
+    soc::uint32 s = i / count;
+    soc::uint32 j = i % count;
+
+    soc::Vector3 center = points[i] * 0.01f;
+    spheres[i]          = soc::Sphere(center, random_float(0.25f, 1.0f));
+    capsules[i]         = soc::Capsule(center, points[i + count * 2] * 0.01f, random_float(0.25f, 1.0f));
+    boxes[i]            = soc::OBB(center, soc::Vector3(random_float(0.25f, 1.0f)), soc::mat3_rotate(points[i + count * 2], random_float(-3.0f, 3.0f)));
+
+    sphere_soas[s].centers.x[j] = center.x; sphere_soas[s].centers.y[j] = center.y; sphere_soas[s].centers.z[j] = center.z;
+    sphere_soas[s].radii[j]     = spheres[i].radius;
+
+    capsule_soas[s].starts.x[j] = capsules[i].start.x; capsule_soas[s].starts.y[j] = capsules[i].start.y; capsule_soas[s].starts.z[j] = capsules[i].start.z;
+    capsule_soas[s].ends.x[j]   = capsules[i].end.x;   capsule_soas[s].ends.y[j]   = capsules[i].end.y;   capsule_soas[s].ends.z[j]   = capsules[i].end.z;
+    capsule_soas[s].radii[j]    = capsules[i].radius;
+
+    box_soas[s].centers.x[j] = center.x; box_soas[s].centers.y[j] = center.y; box_soas[s].centers.z[j] = center.z;
+    box_soas[s].extents.x[j] = boxes[i].extents.x; box_soas[s].extents.y[j] = boxes[i].extents.y; box_soas[s].extents.z[j] = boxes[i].extents.z;
+    for(soc::uint32 k = 0; k < 3; k++) {
+      soc::Vector3 axis        = soc::obb_axis(boxes[i], k);
+      box_soas[s].axes[k].x[j] = axis.x; box_soas[s].axes[k].y[j] = axis.y; box_soas[s].axes[k].z[j] = axis.z;
+    }
+  }
+
+  std::vector<soc::Contact> scalar_contacts(count);
+  std::vector<bool> scalar_hits(count);
+
+  // The old way with `vec3_distance`, one pair at a time
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar_hits[i] = soc::vec3_distance(spheres[i].center, spheres[i + count].center) <= spheres[i].radius + spheres[i + count].radius;
+  }
+  bench_report("vec3_distance spheres", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar_hits[i] = soc::sphere_contact(spheres[i], spheres[i + count], &scalar_contacts[i]);
+  }
+  bench_report("sphere_contact", count, time_now() - start);
+
+  start = time_now();
+  soc::sphere_contact_batch(sphere_soas[0], sphere_soas[1], contacts);
+  bench_report("sphere_contact_batch", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar_hits[i] = soc::capsule_contact(capsules[i], capsules[i + count], &scalar_contacts[i]);
+  }
+  bench_report("capsule_contact", count, time_now() - start);
+
+  start = time_now();
+  soc::capsule_contact_batch(capsule_soas[0], capsule_soas[1], contacts);
+  bench_report("capsule_contact_batch", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar_hits[i] = soc::obb_contact(boxes[i], boxes[i + count], &scalar_contacts[i]);
+  }
+  bench_report("obb_contact", count, time_now() - start);
+
+  start = time_now();
+  soc::obb_contact_batch(box_soas[0], box_soas[1], contacts);
+  bench_report("obb_contact_batch", count, time_now() - start);
+}
+
+// Runs `gjk_distance` on every pair of `shapes` (warm-started from `results` if `is_warm` is on) and reports it as `name`
+static void bench_gjk_pairs(const char* name, const std::vector<soc::ConvexShape>& shapes, std::vector<soc::GJKResult>& results, const bool is_warm) {
+  soc::uint32 count = (soc::uint32)results.size();
+  double iterations = 0.0;
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Vector3 axis            = is_warm ? results[i].axis : soc::Vector3(0.0f);
+    const soc::GJKSimplex* cache = is_warm ? &results[i].simplex : nullptr;
+
+    results[i]  = soc::gjk_distance(shapes[i], shapes[i + count], axis, cache);
+    iterations += results[i].iterations;
+  }
+  bench_report(name, count, time_now() - start);
+
+  printf("%-32s %10.2f iterations per pair\n", "", iterations / (double)count);
+}
+
+static void bench_gjk(const soc::uint32 count) {
+  std::vector<soc::Vector3> points = random_points(count * 4);
+
+  // The same hull for everyone, just placed differently
+  soc::Vector3 hull_points[24];
+  for(soc::Vector3& point : hull_points) {
+    point = soc::vec3_normalize(soc::Vector3(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f))) * random_float(0.5f, 1.0f);
+  }
+
+  std::vector<soc::OBB> boxes(count * 2);
+  std::vector<soc::ConvexHull> hulls(count * 2);
+  std::vector<soc::ConvexShape> box_shapes(count * 2);
+  std::vector<soc::ConvexShape> hull_shapes(count * 2);
+
+  // Pairs close enough to each other that some of them touch
+  for(soc::uint32 i = 0; i < count * 2; i++) {
+    soc::Vector3 center = points[i] * 0.01f;
+    soc::Vector3 axis   = soc::vec3_normalize(points[i + count * 2]);
+    float angle         = random_float(-3.0f, 3.0f);
+
+    boxes[i] = soc::OBB(center, soc::Vector3(random_float(0.25f, 1.0f)), soc::mat3_rotate(axis, angle));
+    hulls[i] = soc::ConvexHull(hull_points, 24, center, soc::quat_axis_angle(axis, angle));
+
+    box_shapes[i]  = soc::ConvexShape(soc::obb_support, &boxes[i]);
+    hull_shapes[i] = soc::ConvexShape(soc::convex_hull_support, &hulls[i]);
+  }
+
+  std::vector<soc::Contact> contacts(count);
+  std::vector<bool> hits(count);
+  std::vector<soc::GJKResult> results(count);
+
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    hits[i] = soc::obb_contact(boxes[i], boxes[i + count], &contacts[i]);
+  }
+  bench_report("obb_contact", count, time_now() - start);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    hits[i] = soc::convex_contact(box_shapes[i], box_shapes[i + count], soc::Vector3(0.0f), &contacts[i], nullptr);
+  }
+  bench_report("convex_contact boxes", count, time_now() - start);
+
+  bench_gjk_pairs("gjk_distance boxes", box_shapes, results, false);
+
+  // The next frame, with every second box moved a little 
+  for(soc::uint32 i = count; i < count * 2; i++) {
+    boxes[i].center += soc::Vector3(0.001f, -0.002f, 0.001f);
+  }
+  bench_gjk_pairs("gjk_distance boxes (warm)", box_shapes, results, true);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    hits[i] = soc::convex_contact(hull_shapes[i], hull_shapes[i + count], soc::Vector3(0.0f), &contacts[i], nullptr);
+  }
+  bench_report("convex_contact hulls", count, time_now() - start);
+
+  bench_gjk_pairs("gjk_distance hulls", hull_shapes, results, false);
+
+  for(soc::uint32 i = count; i < count * 2; i++) {
+    hulls[i].position += soc::Vector3(0.001f, -0.002f, 0.001f);
+  }
+  bench_gjk_pairs("gjk_distance hulls (warm)", hull_shapes, results, true);
+
+  start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    hits[i] = soc::gjk_intersect(hull_shapes[i], hull_shapes[i + count], results[i].axis, &results[i].axis);
+  }
+  bench_report("gjk_intersect hulls (warm)", count, time_now() - start);
+}
+
+static void bench_pca(const soc::uint32 count) {
+  // Meshlets of 64 points each, stretched and rotated so every one of them has its own principal axes
+  const soc::uint32 points_per_meshlet = 64;
+
+  std::vector<soc::Vector3> points(count * points_per_meshlet);
+  std::vector<soc::uint32> offsets(count + 1);
+  std::vector<soc::OBB> obbs(count);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Matrix3 rotation = soc::mat3_rotate(soc::Vector3(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f), 1.0f), random_float(-3.0f, 3.0f));
+    soc::Vector3 center(random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f));
+
+    offsets[i] = i * points_per_meshlet;
+    for(soc::uint32 j = 0; j < points_per_meshlet; j++) {
+      soc::Vector3 local(random_float(-4.0f, 4.0f), random_float(-1.0f, 1.0f), random_float(-0.25f, 0.25f));
+      points[offsets[i] + j] = center + (local * rotation);
+    }
+  }
+  offsets[count] = count * points_per_meshlet;
+
+  // The old way with a `Matrix3` sum of outer products and the projections one point at a time
+  double start = time_now();
+  for(soc::uint32 i = 0; i < count; i++) {
+    const soc::Vector3* meshlet = points.data() + offsets[i];
+
+    soc::Vector3 mean(0.0f);
+    for(soc::uint32 j = 0; j < points_per_meshlet; j++) {
+      mean += meshlet[j];
+    }
+    mean = mean / (float)points_per_meshlet;
+
+    soc::Matrix3 covariance(0.0f);
+    for(soc::uint32 j = 0; j < points_per_meshlet; j++) {
+      soc::Vector3 d = meshlet[j] - mean;
+      covariance     = covariance + soc::Matrix3(d * d.x, d * d.y, d * d.z);
+    }
+
+    soc::Matrix3 axes;
+    soc::mat3_eigen_symmetric(covariance * (1.0f / (float)points_per_meshlet), &axes, nullptr);
+
+    soc::Vector3 min(SOC_FLOAT_MAX);
+    soc::Vector3 max(-SOC_FLOAT_MAX);
+    for(soc::uint32 j = 0; j < points_per_meshlet; j++) {
+      soc::Vector3 local = (meshlet[j] - mean) * axes;
+      min                = soc::vec3_min(min, local);
+      max                = soc::vec3_max(max, local);
+    }
+
+    obbs[i] = soc::OBB(mean + (((min + max) * 0.5f) * soc::mat3_transpose(axes)), (max - min) * 0.5f, axes);
+  }
+  bench_report("Matrix3 covariance", count, time_now() - start);
+
+  start = time_now();
+  soc::obb_fit_batch(points.data(), offsets.data(), count, obbs.data(), 1);
+  bench_report("obb_fit_batch", count, time_now() - start);
+
+  soc::uint32 threads = std::thread::hardware_concurrency();
+  start               = time_now();
+  soc::obb_fit_batch(points.data(), offsets.data(), count, obbs.data(), threads);
+  bench_report("obb_fit_batch all threads", count, time_now() - start);
+
+  start = time_now();
+  soc::Covariance cov = soc::covariance_from_points(points.data(), (soc::uint32)points.size(), threads);
+  bench_report("covariance_from_points", count, time_now() - start);
+  
+  if(cov.count != points.size()) {
+    printf("covariance_from_points missed points\n");
+  }
+}
+
+static void bench_bounds(const soc::uint32 count) {
+  std::vector<soc::Vector3> points = random_points(count);
+
+  // One arena for everything, big enough for the hull (which needs the most)
+  std::vector<char> memory(soc::convex_hull_memory_size(count));
+  soc::FrameArena arena = soc::arena_create(memory.data(), memory.size());
+
+  // The old way with the center of the AABB and the farthest point from it
+  double start        = time_now();
+  soc::AABB box       = soc::aabb_from_points(points.data(), count);
+  soc::Vector3 center = (box.min + box.max) * 0.5f;
+  float max_dist2     = 0.0f;
+  for(const soc::Vector3& point : points) {
+    float dist2 = soc::vec3_dot(point - center, point - center);
+    max_dist2   = dist2 > max_dist2 ? dist2 : max_dist2;
+  }
+  soc::Sphere box_sphere(center, std::sqrt(max_dist2));
+  bench_report("AABB center sphere", count, time_now() - start);
+
+  start                     = time_now();
+  soc::Sphere ritter_sphere = soc::sphere_from_points_ritter(points.data(), count);
+  bench_report("sphere_from_points_ritter", count, time_now() - start);
+
+  soc::Sphere welzl_sphere;
+  start = time_now();
+  soc::sphere_from_points_welzl(points.data(), count, arena, &welzl_sphere);
+  bench_report("sphere_from_points_welzl", count, time_now() - start);
+
+  printf("radius: AABB center %.3f, Ritter %.3f, Welzl %.3f\n", box_sphere.radius, ritter_sphere.radius, welzl_sphere.radius);
+
+  std::vector<soc::uint32> indices((2 * count - 4) * 3);
+  start                     = time_now();
+  soc::uint32 indices_count = soc::convex_hull_from_points(points.data(), count, arena, indices.data());
+  bench_report("convex_hull_from_points", count, time_now() - start);
+
+  printf("hull: %u triangles, %.2f MB of arena used\n", indices_count / 3, (double)arena.peak / (1024.0 * 1024.0));
+}
+
+// Adds the 12 front facing (counter-clockwise from the outside) triangles of the box from `min` to `max`
+static void add_box_triangles(const soc::Vector3& min, const soc::Vector3& max, std::vector<soc::Vector3>& vertices, std::vector<soc::uint32>& indices) {
+  const soc::uint32 faces[12][3] = {
+    {0, 2, 3}, {0, 3, 1}, {4, 5, 7}, {4, 7, 6}, // -Z, +Z
+    {0, 1, 5}, {0, 5, 4}, {2, 6, 7}, {2, 7, 3}, // -Y, +Y
+    {0, 4, 6}, {0, 6, 2}, {1, 3, 7}, {1, 7, 5}, // -X, +X
+  };
+
+  soc::uint32 first = (soc::uint32)vertices.size();
+  for(soc::uint32 i = 0; i < 8; i++) {
+    vertices.push_back(soc::Vector3((i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y, (i & 4) ? max.z : min.z));
+  }
+
+  for(const soc::uint32* face : faces) {
+    indices.push_back(first + face[0]);
+    indices.push_back(first + face[1]);
+    indices.push_back(first + face[2]);
+  }
+}
+
+static void bench_occlusion(const soc::uint32 count) {
+  // A city of `count` occluder triangles (boxes on a grid with streets between them), 
+  // seen from the street at the edge of the city
+  std::vector<soc::Vector3> vertices;
+  std::vector<soc::uint32> indices;
+
+  soc::uint32 buildings = count / 12;
+  soc::uint32 side      = (soc::uint32)std::sqrt((float)buildings) + 1;
+  for(soc::uint32 i = 0; i < buildings; i++) {
+    float x = ((float)(i % side) - (float)(side / 2)) * 20.0f + 10.0f; 
+    float z = -((float)(i / side) * 20.0f + 10.0f); 
+
+    float width = random_float(8.0f, 16.0f); 
+    float depth = random_float(8.0f, 16.0f); 
+    add_box_triangles(soc::Vector3(x - width * 0.5f, 0.0f, z - depth * 0.5f), 
+                      soc::Vector3(x + width * 0.5f, random_float(10.0f, 60.0f), z + depth * 0.5f), 
+                      vertices, 
+                      indices);
+  }
+
+  // The objects to cull are scattered all over the city
+  std::vector<soc::AABB> boxes(10000);
+  for(soc::AABB& box : boxes) {
+    soc::Vector3 min(random_float(-(float)side * 10.0f, (float)side * 10.0f), 0.0f, random_float(-(float)side * 20.0f, 0.0f));
+    box = soc::AABB(min, min + soc::Vector3(random_float(0.5f, 3.0f), random_float(0.5f, 3.0f), random_float(0.5f, 3.0f)));
+  }
+
+  soc::Matrix4 view_projection = soc::mat4_perspective(1.0f, 320.0f / 192.0f, 0.5f, 2000.0f) * 
+                                 soc::mat4_look_at(soc::Vector3(0.0f, 2.0f, 5.0f), soc::Vector3(0.0f, 2.0f, -100.0f), soc::Vector3(0.0f, 1.0f, 0.0f));
+
+  std::vector<char> buffer_memory(soc::occlusion_buffer_memory_size(320, 192));
+  soc::OcclusionBuffer buffer = soc::occlusion_buffer_create(buffer_memory.data(), 320, 192);
+
+  std::vector<char> memory((count * 96) + (1 << 20));
+  soc::FrameArena arena = soc::arena_create(memory.data(), memory.size());
+
+  bool* visible = new bool[boxes.size()];
+
+  // Frustum culling only (with an empty buffer)
+  soc::occlusion_test_aabbs(buffer, view_projection, boxes.data(), (soc::uint32)boxes.size(), 1, visible);
+  soc::uint32 frustum_count = 0;
+  for(soc::uint32 i = 0; i < boxes.size(); i++) {
+    frustum_count += visible[i];
+  }
+
+  double start = time_now();
+  soc::occlusion_rasterize(buffer, view_projection, vertices.data(), (soc::uint32)vertices.size(), indices.data(), (soc::uint32)indices.size(), arena, 1);
+  bench_report("occlusion_rasterize", count, time_now() - start);
+
+  soc::uint32 threads = std::thread::hardware_concurrency();
+  start               = time_now();
+  soc::occlusion_rasterize(buffer, view_projection, vertices.data(), (soc::uint32)vertices.size(), indices.data(), (soc::uint32)indices.size(), arena, threads);
+  bench_report("occlusion_rasterize all threads", count, time_now() - start);
+
+  start = time_now();
+  soc::occlusion_test_aabbs(buffer, view_projection, boxes.data(), (soc::uint32)boxes.size(), 1, visible);
+  bench_report("occlusion_test_aabbs", (soc::uint32)boxes.size(), time_now() - start);
+
+  soc::uint32 visible_count = 0;
+  for(soc::uint32 i = 0; i < boxes.size(); i++) {
+    visible_count += visible[i];
+  }
+
+  printf("visible: %u of %u boxes (frustum only %u), %.2f MB of arena used\n", visible_count, (soc::uint32)boxes.size(), frustum_count, (double)arena.peak / (1024.0 * 1024.0));
+  delete[] visible;
+}
+
+int main(int argc, char** argv) {
+  srand(1234);
+  const char* filter = argc > 1 ? argv[1] : "";
+
+  struct Bench {
+    const char* name; 
+    void(*func)(const soc::uint32 count);
+    soc::uint32 counts[3];
+  };
+
+  Bench benches[] = {
+    {"anim",      bench_anim,      {1000, 10000, 100000}},
+    {"morton",    bench_morton,    {1000000, 4000000, 10000000}},
+    {"soa",       bench_soa,       {10000, 100000, 1000000}},
+    {"decompose", bench_decompose, {1000, 10000, 100000}},
+    {"rotate",    bench_rotate,    {10000, 100000, 1000000}},
+    {"euler",     bench_euler,     {10000, 100000, 1000000}},
+    {"particles", bench_particles, {100000, 1000000, 4000000}},
+    {"bodies",    bench_rigid_bodies, {20000, 100000, 400000}},
+    {"noise",     bench_noise,     {10000, 100000, 1000000}},
+    {"spline",    bench_spline,    {10000, 100000, 1000000}},
+    {"random",    bench_random,    {100000, 1000000, 10000000}},
+    {"collision", bench_collision, {10000, 100000, 1000000}},
+    {"gjk",       bench_gjk,       {1000, 10000, 100000}},
+    {"pca",       bench_pca,       {10000, 100000, 1000000}},
+    {"bounds",    bench_bounds,    {10000, 100000, 1000000}},
+    {"occlusion", bench_occlusion, {10000, 100000, 1000000}},
+  };
+
+  for(const Bench& bench : benches) {
+    if(strncmp(bench.name, filter, strlen(filter)) != 0) {
+      continue;
+    }
+
+    for(soc::uint32 count : bench.counts) {
+      printf("-- %s (%u)\n", bench.name, count);
+      bench.func(count);
+    }
+  }
+}
@@ -19,11 +19,14 @@ Camera3D camera_create(const soc::Vector3& position, const soc::Vector3& target)
   soc::Vector3 up_axis(0.0f, 1.0f, 0.0f);
   soc::Vector3 right_axis = soc::vec3_normalize(soc::vec3_cross(up_axis, look_dir));
   
+  soc::Vector2 yaw   = soc::sincos_fast(cam.yaw * SOC_DEG2RAD);
+  soc::Vector2 pitch = soc::sincos_fast(cam.pitch * SOC_DEG2RAD);
+
   cam.position    = position; 
   cam.up          = soc::vec3_normalize(soc::vec3_cross(look_dir, right_axis));
-  cam.direction.x = cos((cam.yaw * SOC_DEG2RAD)) * cos((cam.pitch * SOC_DEG2RAD));
-  cam.direction.y = sin((cam.pitch * SOC_DEG2RAD));
-  cam.direction.z = sin((cam.yaw * SOC_DEG2RAD)) * cos((cam.pitch * SOC_DEG2RAD));
+  cam.direction.x = yaw.y * pitch.y;
+  cam.direction.y = pitch.x;
+  cam.direction.z = yaw.x * pitch.y;
   cam.front       = soc::vec3_normalize(cam.direction);
 
   return cam;
@@ -33,9 +36,12 @@ void camera_update(Camera3D& cam) {
   cam.view_projection = soc::mat4_perspective((cam.zoom * SOC_DEG2RAD), 1280.0f / 720.0f, 0.1f, 100.0f) * 
     soc::mat4_look_at(cam.position, cam.position + cam.front, cam.up);
 
-  cam.direction.x = soc::cos((cam.yaw * SOC_DEG2RAD)) * soc::cos((cam.pitch * SOC_DEG2RAD));
-  cam.direction.y = soc::sin((cam.pitch * SOC_DEG2RAD));
-  cam.direction.z = soc::sin((cam.yaw * SOC_DEG2RAD)) * soc::cos((cam.pitch * SOC_DEG2RAD));
+  soc::Vector2 yaw   = soc::sincos_fast(cam.yaw * SOC_DEG2RAD);
+  soc::Vector2 pitch = soc::sincos_fast(cam.pitch * SOC_DEG2RAD);
+
+  cam.direction.x = yaw.y * pitch.y;
+  cam.direction.y = pitch.x;
+  cam.direction.z = yaw.x * pitch.y;
   cam.front       = soc::vec3_normalize(cam.direction);
 }
 
@@ -0,0 +1,1060 @@
+#include "socrates.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Checks the functions that promise the exact same results on every code path (SSE, AVX, `SOC_NO_SIMD`, and FMA).
+// Every check hashes the bits of what a function returns and compares the hash against a golden one taken from a
+// default x86-64 build. The checks that compare a batch function against its scalar version also count the values that differ.
+// The program fails (returns 1) if any hash or value differs, so it is meant to be run in every build.
+
+struct Check {
+  const char* name;
+  soc::uint64 golden;
+
+  soc::uint64 hash;
+  soc::uint32 mismatches;
+};
+
+// Returns `hash` with the bits of `values` mixed in (FNV-1a)
+static soc::uint64 hash_floats(soc::uint64 hash, const float* values, const soc::uint32 count) {
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::uint32 bits;
+    std::memcpy(&bits, &values[i], sizeof(bits));
+
+    for(soc::uint32 j = 0; j < 4; j++) {
+      hash ^= (bits >> (j * 8)) & 0xff;
+      hash *= 1099511628211ull;
+    }
+  }
+
+  return hash;
+}
+
+// Returns the number of values in `a` and `b` whose bits are not the same
+static soc::uint32 count_mismatches(const float* a, const float* b, const soc::uint32 count) {
+  soc::uint32 mismatches = 0;
+  for(soc::uint32 i = 0; i < count; i++) {
+    mismatches += std::memcmp(&a[i], &b[i], sizeof(float)) != 0;
+  }
+
+  return mismatches;
+}
+
+static Check check_create(const char* name, const soc::uint64 golden) {
+  return Check{name, golden, 14695981039346656037ull, 0};
+}
+
+// Returns a float in `[-range, range)` from a fixed LCG, so the inputs are the same on every platform
+// NOTE: This is only one multiply, so the compiler cannot fuse anything in here either.
+static float next_float(soc::uint32& state, const float range) {
+  state = state * 1664525u + 1013904223u;
+  return (float)((soc::int32)(state >> 8) - 8388608) * (range / 8388608.0f);
+}
+
+static Check check_noise_grid() {
+  Check check = check_create("noise_fbm3_grid", 0x84c00a391bdde04cull);
+
+  const soc::uint32 size = 32;
+  static float values[size * size * size];
+
+  soc::noise_fbm3_grid(soc::NOISE_SIMPLEX, soc::Vector3(-3.7f, 11.2f, 0.4f), soc::Vector3(0.173f), size, size, size, 4, 2.0f, 0.5f, values);
+  check.hash = hash_floats(check.hash, values, size * size * size);
+
+  soc::noise_fbm3_grid(soc::NOISE_PERLIN, soc::Vector3(-3.7f, 11.2f, 0.4f), soc::Vector3(0.173f), size, size, size, 4, 2.0f, 0.5f, values);
+  check.hash = hash_floats(check.hash, values, size * size * size);
+
+  return check;
+}
+
+static Check check_noise_batch() {
+  Check check = check_create("noise_fbm*_batch", 0x9f9190d7a540e010ull);
+
+  const soc::uint32 count = 10003;
+  static soc::Vector2 points2[count];
+  static soc::Vector4 points4[count];
+  static float values[count];
+  static float scalar[count];
+
+  soc::uint32 state = 1234;
+  for(soc::uint32 i = 0; i < count; i++) {
+    points2[i] = soc::Vector2(next_float(state, 300.0f), next_float(state, 300.0f));
+    points4[i] = soc::Vector4(next_float(state, 50.0f), next_float(state, 50.0f), next_float(state, 50.0f), next_float(state, 50.0f));
+  }
+
+  for(soc::uint32 type = soc::NOISE_SIMPLEX; type <= soc::NOISE_PERLIN; type++) {
+    soc::noise_fbm2_batch((soc::NoiseType)type, points2, count, 5, 2.0f, 0.5f, values);
+    for(soc::uint32 i = 0; i < count; i++) {
+      scalar[i] = soc::noise_fbm2((soc::NoiseType)type, points2[i], 5, 2.0f, 0.5f);
+    }
+    check.hash        = hash_floats(check.hash, values, count);
+    check.mismatches += count_mismatches(values, scalar, count);
+
+    soc::noise_fbm4_batch((soc::NoiseType)type, points4, count, 3, 2.0f, 0.5f, values);
+    for(soc::uint32 i = 0; i < count; i++) {
+      scalar[i] = soc::noise_fbm4((soc::NoiseType)type, points4[i], 3, 2.0f, 0.5f);
+    }
+    check.hash        = hash_floats(check.hash, values, count);
+    check.mismatches += count_mismatches(values, scalar, count);
+  }
+
+  return check;
+}
+
+// Returns the scalar generators of every lane of `randomx8_create(seed, 0)`
+static void random_lanes_create(const soc::uint64 seed, soc::Random* out_lanes) {
+  for(soc::uint32 i = 0; i < 8; i++) {
+    out_lanes[i] = soc::random_create(seed, i);
+  }
+}
+
+static Check check_random_batch() {
+  Check check = check_create("random_*_batch", 0x08b227f71583e7a4ull);
+
+  const soc::uint32 count = 1003;
+  static float values[count * 4];
+  static float scalar[count * 4];
+
+  soc::Random lanes[8];
+  soc::AABB aabb(soc::Vector3(-3.0f, 0.5f, -10.0f), soc::Vector3(7.0f, 1.5f, 20.0f));
+  soc::Vector3 normal(0.3f, -1.0f, 0.2f);
+
+  // The reference splitmix64 outputs for a zero state catch a `uint64` that is not really 64 bits wide
+  const soc::uint64 splitmix[3] = {0xe220a8397b1dcdafull, 0x6e789e6aa1b965f4ull, 0x06c45d188009454full};
+  soc::uint64 splitmix_state    = 0;
+  for(soc::uint32 i = 0; i < 3; i++) {
+    check.mismatches += soc::random_splitmix64(splitmix_state) != splitmix[i];
+  }
+
+  soc::Randomx8 random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_float_batch(random, -5.0f, 13.0f, count, values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar[i] = soc::random_float_range(lanes[i % 8], -5.0f, 13.0f);
+  }
+  check.hash        = hash_floats(check.hash, values, count);
+  check.mismatches += count_mismatches(values, scalar, count);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_vec2_in_disk_batch(random, count, (soc::Vector2*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Vector2*)scalar)[i] = soc::random_vec2_in_disk(lanes[i % 8]);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 2);
+  check.mismatches += count_mismatches(values, scalar, count * 2);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_unit_vec3_batch(random, count, (soc::Vector3*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Vector3*)scalar)[i] = soc::random_unit_vec3(lanes[i % 8]);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 3);
+  check.mismatches += count_mismatches(values, scalar, count * 3);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_unit_vec3_hemisphere_batch(random, normal, count, (soc::Vector3*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Vector3*)scalar)[i] = soc::random_unit_vec3_hemisphere(lanes[i % 8], normal);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 3);
+  check.mismatches += count_mismatches(values, scalar, count * 3);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_vec3_in_sphere_batch(random, count, (soc::Vector3*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Vector3*)scalar)[i] = soc::random_vec3_in_sphere(lanes[i % 8]);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 3);
+  check.mismatches += count_mismatches(values, scalar, count * 3);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_vec3_in_aabb_batch(random, aabb, count, (soc::Vector3*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Vector3*)scalar)[i] = soc::random_vec3_in_aabb(lanes[i % 8], aabb);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 3);
+  check.mismatches += count_mismatches(values, scalar, count * 3);
+
+  random = soc::randomx8_create(99, 0);
+  random_lanes_create(99, lanes);
+  soc::random_quat_batch(random, count, (soc::Quaternion*)values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    ((soc::Quaternion*)scalar)[i] = soc::random_quat(lanes[i % 8]);
+  }
+  check.hash        = hash_floats(check.hash, values, count * 4);
+  check.mismatches += count_mismatches(values, scalar, count * 4);
+
+  return check;
+}
+
+// Returns a matrix with a rotation about a single axis, a scale per column, and a translation
+// NOTE: Every entry is a single product, so the compiler has nothing to fuse while making these either.
+static soc::Matrix4 decompose_matrix(soc::uint32& state) {
+  float angle = next_float(state, 3.14f);
+  float c     = std::cos(angle);
+  float s     = std::sin(angle);
+
+  soc::uint32 axis = state % 3;
+  soc::Vector3 scale(next_float(state, 4.0f), next_float(state, 4.0f), next_float(state, 4.0f));
+
+  soc::Matrix4 m; 
+  soc::uint32 a = (axis + 1) % 3;
+  soc::uint32 b = (axis + 2) % 3;
+  m.data[a * 4 + a] = c;
+  m.data[a * 4 + b] = s;
+  m.data[b * 4 + a] = -s;
+  m.data[b * 4 + b] = c;
+
+  for(soc::uint32 col = 0; col < 3; col++) {
+    for(soc::uint32 row = 0; row < 3; row++) {
+      m.data[col * 4 + row] *= scale[col];
+    }
+  }
+
+  m.data[12] = next_float(state, 100.0f);
+  m.data[13] = next_float(state, 100.0f);
+  m.data[14] = next_float(state, 100.0f);
+
+  return m;
+}
+
+static Check check_decompose_batch() {
+  Check check = check_create("mat4_decompose_batch", 0x56b8e009ffdbce24ull);
+
+  const soc::uint32 count = 1003;
+  static soc::Matrix4 matrices[count];
+  static float values[10][count];
+  static float scalar[10][count];
+
+  soc::uint32 state = 777;
+  for(soc::uint32 i = 0; i < count; i++) {
+    matrices[i] = decompose_matrix(state);
+  }
+
+  soc::Vector3SoA translations = {values[0], values[1], values[2], count};
+  soc::QuaternionSoA rotations = {values[3], values[4], values[5], values[6], count};
+  soc::Vector3SoA scales       = {values[7], values[8], values[9], count};
+  soc::mat4_decompose_batch(matrices, count, translations, rotations, scales);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Transform transform = soc::mat4_decompose(matrices[i]);
+
+    const float components[10] = {
+      transform.translation.x, transform.translation.y, transform.translation.z, 
+      transform.rotation.x, transform.rotation.y, transform.rotation.z, transform.rotation.w, 
+      transform.scale.x, transform.scale.y, transform.scale.z,
+    };
+    for(soc::uint32 j = 0; j < 10; j++) {
+      scalar[j][i] = components[j];
+    }
+  }
+
+  for(soc::uint32 j = 0; j < 10; j++) {
+    check.hash        = hash_floats(check.hash, values[j], count);
+    check.mismatches += count_mismatches(values[j], scalar[j], count);
+  }
+
+  return check;
+}
+
+static Check check_euler_batch() {
+  Check check = check_create("quat_from_euler_batch", 0xa628211b28ba125full);
+
+  const soc::uint32 count = 1003;
+  static soc::Vector3 angles[count];
+  static soc::Quaternion values[count];
+  static soc::Quaternion scalar[count];
+
+  soc::uint32 state = 4242;
+  for(soc::uint32 i = 0; i < count; i++) {
+    angles[i] = soc::Vector3(next_float(state, 7.0f), next_float(state, 7.0f), next_float(state, 7.0f));
+  }
+
+  for(soc::uint32 order = soc::EULER_ORDER_XYZ; order <= soc::EULER_ORDER_ZYX; order++) {
+    soc::quat_from_euler_batch(angles, count, (soc::EulerOrder)order, values);
+    for(soc::uint32 i = 0; i < count; i++) {
+      scalar[i] = soc::quat_from_euler(angles[i], (soc::EulerOrder)order);
+    }
+
+    check.hash        = hash_floats(check.hash, &values[0].x, count * 4);
+    check.mismatches += count_mismatches(&values[0].x, &scalar[0].x, count * 4);
+  }
+
+  return check;
+}
+
+static Check check_rotate_batch() {
+  Check check = check_create("quat_rotate_vec3_batch", 0x66f973219396a394ull);
+
+  const soc::uint32 count = 1003;
+  static soc::Quaternion rotations[count];
+  static soc::Vector3 vectors[count];
+  static soc::Vector3 values[count];
+
+  soc::uint32 state = 5151;
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Vector3 angles(next_float(state, 3.0f), next_float(state, 3.0f), next_float(state, 3.0f));
+    rotations[i] = soc::quat_from_euler(angles, soc::EULER_ORDER_XYZ);
+    vectors[i]   = soc::Vector3(next_float(state, 50.0f), next_float(state, 50.0f), next_float(state, 50.0f));
+  }
+
+  soc::quat_rotate_vec3_batch(rotations, vectors, count, values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Vector3 scalar = soc::quat_rotate_vec3(rotations[i], vectors[i]);
+
+    check.hash        = hash_floats(check.hash, &values[i].x, 3);
+    check.mismatches += count_mismatches(&values[i].x, &scalar.x, 3);
+  }
+
+  return check;
+}
+
+// The SoA check is built without fused multiply-adds just like the SoA functions, since code built with FMA 
+// could get the per-element counterparts fused wherever they get inlined
+SOC_FP_STRICT_BEGIN
+static void soa_reference(const soc::Vector3& a, const soc::Vector3& b, const soc::Quaternion& qa, const soc::Quaternion& qb, float* out) {
+  soc::Vector3 cross      = soc::vec3_cross(a, b);
+  soc::Vector3 normalized = soc::vec3_normalize(a);
+  soc::Vector3 lerped     = soc::vec3_lerp(a, b, 0.375f);
+  soc::Quaternion nlerped = soc::quat_nlerp(qa, qb, 0.375f);
+
+  const float values[14] = {
+    soc::vec3_dot(a, b), soc::vec3_length(a), 
+    cross.x, cross.y, cross.z, 
+    normalized.x, normalized.y, normalized.z, 
+    lerped.x, lerped.y, lerped.z, 
+    nlerped.x, nlerped.y, nlerped.z,
+  };
+
+  std::memcpy(out, values, sizeof(values));
+  out[14] = nlerped.w;
+}
+
+static Check check_soa_batch() {
+  Check check = check_create("vec3_soa_*/quat_soa_*", 0x4178057ddb7e215full);
+
+  const soc::uint32 count = 1003;
+  std::vector<char> memory[7];
+  for(std::vector<char>& block : memory) {
+    block.resize(soc::quat_soa_memory_size(count));
+  }
+
+  soc::Vector3SoA a          = soc::vec3_soa_create(memory[0].data(), count);
+  soc::Vector3SoA b          = soc::vec3_soa_create(memory[1].data(), count);
+  soc::Vector3SoA cross      = soc::vec3_soa_create(memory[2].data(), count);
+  soc::Vector3SoA normalized = soc::vec3_soa_create(memory[3].data(), count);
+  soc::Vector3SoA lerped     = soc::vec3_soa_create(memory[4].data(), count);
+  soc::QuaternionSoA qa      = soc::quat_soa_create(memory[5].data(), count);
+  soc::QuaternionSoA qb      = soc::quat_soa_create(memory[6].data(), count);
+
+  soc::uint32 state = 6161;
+  for(soc::uint32 i = 0; i < count; i++) {
+    a.x[i] = next_float(state, 9.0f), a.y[i] = next_float(state, 9.0f), a.z[i] = next_float(state, 9.0f);
+    b.x[i] = next_float(state, 9.0f), b.y[i] = next_float(state, 9.0f), b.z[i] = next_float(state, 9.0f);
+
+    soc::Quaternion start = soc::quat_from_euler(soc::Vector3(a.x[i], a.y[i], a.z[i]), soc::EULER_ORDER_XYZ);
+    soc::Quaternion end   = soc::quat_from_euler(soc::Vector3(b.x[i], b.y[i], b.z[i]), soc::EULER_ORDER_XYZ);
+    qa.x[i] = start.x, qa.y[i] = start.y, qa.z[i] = start.z, qa.w[i] = start.w;
+    qb.x[i] = end.x, qb.y[i] = end.y, qb.z[i] = end.z, qb.w[i] = end.w;
+  }
+
+  std::vector<float> dots(soc::soa_padded_count(count)), lengths(soc::soa_padded_count(count));
+  soc::vec3_soa_dot(a, b, dots.data());
+  soc::vec3_soa_length(a, lengths.data());
+  soc::vec3_soa_cross(a, b, cross);
+  soc::vec3_soa_normalize(a, normalized);
+  soc::vec3_soa_lerp(a, b, 0.375f, lerped);
+  soc::quat_soa_nlerp(qa, qb, 0.375f, qa);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    const float values[15] = {
+      dots[i], lengths[i], 
+      cross.x[i], cross.y[i], cross.z[i], 
+      normalized.x[i], normalized.y[i], normalized.z[i], 
+      lerped.x[i], lerped.y[i], lerped.z[i], 
+      qa.x[i], qa.y[i], qa.z[i], qa.w[i],
+    };
+
+    float scalar[15];
+    soa_reference(soc::Vector3(a.x[i], a.y[i], a.z[i]), 
+                  soc::Vector3(b.x[i], b.y[i], b.z[i]), 
+                  soc::quat_from_euler(soc::Vector3(a.x[i], a.y[i], a.z[i]), soc::EULER_ORDER_XYZ), 
+                  soc::quat_from_euler(soc::Vector3(b.x[i], b.y[i], b.z[i]), soc::EULER_ORDER_XYZ), 
+                  scalar);
+
+    check.hash        = hash_floats(check.hash, values, 15);
+    check.mismatches += count_mismatches(values, scalar, 15);
+  }
+
+  return check;
+}
+SOC_FP_STRICT_END
+
+// An interleaved vertex, so the views below get gathered with a stride that is not `sizeof` the vector
+struct ViewVertex {
+  soc::Vector3 position;
+  soc::Vector2 uv;
+  soc::Vector4 tangent;
+  soc::Vector3 normal;
+};
+
+// The view check is built without fused multiply-adds just like the views (see the SoA check)
+SOC_FP_STRICT_BEGIN
+static void view_reference(const ViewVertex& in, const ViewVertex& end, const soc::Matrix2x3& m2, const soc::Matrix4& m4, ViewVertex& out) {
+  soc::Vector4 position = soc::mat4_transform_vec4(m4, soc::Vector4(soc::vec3_normalize(in.position), 1.0f));
+
+  out.position = soc::Vector3(position.x, position.y, position.z);
+  out.uv       = soc::mat2x3_transform_point(m2, soc::vec2_normalize(in.uv));
+  out.tangent  = soc::mat4_transform_vec4(m4, soc::vec4_normalize(in.tangent));
+  out.normal   = soc::vec3_lerp(in.normal, end.normal, 0.375f);
+}
+
+static Check check_view_batch() {
+  Check check = check_create("vec*_view_*", 0x248d21de8c57d698ull);
+
+  const soc::uint32 count = 1003;
+  static ViewVertex vertices[count];
+  static ViewVertex ends[count];
+  static ViewVertex scalar[count];
+
+  soc::uint32 state = 7171;
+  soc::Matrix2x3 m2;
+  soc::Matrix4 m4;
+  for(soc::uint32 i = 0; i < 6; i++) {
+    m2.data[i] = next_float(state, 4.0f);
+  }
+  for(soc::uint32 i = 0; i < 16; i++) {
+    m4.data[i] = next_float(state, 4.0f);
+  }
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    vertices[i].position = soc::Vector3(next_float(state, 9.0f), next_float(state, 9.0f), next_float(state, 9.0f));
+    vertices[i].uv       = soc::Vector2(next_float(state, 9.0f), next_float(state, 9.0f));
+    vertices[i].tangent  = soc::Vector4(next_float(state, 9.0f), next_float(state, 9.0f), next_float(state, 9.0f), next_float(state, 9.0f));
+    vertices[i].normal   = soc::Vector3(next_float(state, 9.0f), next_float(state, 9.0f), next_float(state, 9.0f));
+    ends[i].normal       = soc::Vector3(next_float(state, 9.0f), next_float(state, 9.0f), next_float(state, 9.0f));
+
+    view_reference(vertices[i], ends[i], m2, m4, scalar[i]);
+  }
+
+  const soc::uint32 stride = sizeof(ViewVertex);
+  soc::Vector3View positions(&vertices[0].position, stride, count);
+  soc::Vector2View uvs(&vertices[0].uv, stride, count);
+  soc::Vector4View tangents(&vertices[0].tangent, stride, count);
+  soc::Vector3View normals(&vertices[0].normal, stride, count);
+
+  soc::vec3_view_normalize(positions);
+  soc::vec3_view_transform(positions, m4, 1.0f);
+  soc::vec2_view_normalize(uvs);
+  soc::vec2_view_transform(uvs, m2);
+  soc::vec4_view_normalize(tangents);
+  soc::vec4_view_transform(tangents, m4);
+  soc::vec3_view_lerp(normals, normals, soc::Vector3View(&ends[0].normal, stride, count), 0.375f);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    const float values[12] = {
+      vertices[i].position.x, vertices[i].position.y, vertices[i].position.z, 
+      vertices[i].uv.x, vertices[i].uv.y, 
+      vertices[i].tangent.x, vertices[i].tangent.y, vertices[i].tangent.z, vertices[i].tangent.w, 
+      vertices[i].normal.x, vertices[i].normal.y, vertices[i].normal.z,
+    };
+    const float reference[12] = {
+      scalar[i].position.x, scalar[i].position.y, scalar[i].position.z, 
+      scalar[i].uv.x, scalar[i].uv.y, 
+      scalar[i].tangent.x, scalar[i].tangent.y, scalar[i].tangent.z, scalar[i].tangent.w, 
+      scalar[i].normal.x, scalar[i].normal.y, scalar[i].normal.z,
+    };
+
+    check.hash        = hash_floats(check.hash, values, 12);
+    check.mismatches += count_mismatches(values, reference, 12);
+  }
+
+  return check;
+}
+SOC_FP_STRICT_END
+
+static Check check_particles() {
+  Check check = check_create("particle_integrate", 0xc3cb1d8c2026ecdeull);
+
+  const soc::uint32 count = 1003;
+  std::vector<char> memory[2] = {
+    std::vector<char>(soc::particle_system_memory_size(count)),
+    std::vector<char>(soc::particle_system_memory_size(count)),
+  };
+  soc::ParticleSystem systems[2] = {
+    soc::particle_system_create(memory[0].data(), count),
+    soc::particle_system_create(memory[1].data(), count),
+  };
+
+  soc::uint32 state = 777;
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Vector3 position(next_float(state, 50.0f), next_float(state, 50.0f), next_float(state, 50.0f));
+    soc::Vector3 velocity(next_float(state, 10.0f), next_float(state, 10.0f), next_float(state, 10.0f));
+    float lifetime = next_float(state, 1.0f) + 1.0f;
+
+    soc::particle_emit(systems[0], position, velocity, lifetime);
+    soc::particle_emit(systems[1], position, velocity, lifetime);
+  }
+
+  // The same steps on 1 and 3 threads, with every integrator and a compaction after each step
+  static float expected[7][count];
+  for(soc::uint32 step = 0; step < 12; step++) {
+    soc::ParticleIntegrator integrator = (soc::ParticleIntegrator)(step % 3);
+    soc::particle_integrate(systems[0], integrator, soc::Vector3(0.0f, -9.81f, 0.0f), 0.3f, 1.0f / 7.0f, 1);
+    soc::particle_integrate(systems[1], integrator, soc::Vector3(0.0f, -9.81f, 0.0f), 0.3f, 1.0f / 7.0f, 3);
+
+    // The compaction is checked against a plain copy of every alive particle
+    soc::ParticleSystem& system = systems[0];
+    float* streams[7] = {
+      system.positions.x, system.positions.y, system.positions.z, 
+      system.velocities.x, system.velocities.y, system.velocities.z, 
+      system.lifetimes,
+    };
+
+    soc::uint32 alive = 0;
+    for(soc::uint32 i = 0; i < system.count; i++) {
+      if(system.lifetimes[i] > 0.0f) {
+        for(soc::uint32 j = 0; j < 7; j++) {
+          expected[j][alive] = streams[j][i];
+        }
+        alive++;
+      }
+    }
+
+    soc::particle_compact(systems[0]);
+    soc::particle_compact(systems[1]);
+    check.mismatches += (system.count != alive) + (systems[1].count != alive);
+
+    float* others[7] = {
+      systems[1].positions.x, systems[1].positions.y, systems[1].positions.z, 
+      systems[1].velocities.x, systems[1].velocities.y, systems[1].velocities.z, 
+      systems[1].lifetimes,
+    };
+    for(soc::uint32 j = 0; j < 7; j++) {
+      check.hash        = hash_floats(check.hash, streams[j], alive);
+      check.mismatches += count_mismatches(streams[j], expected[j], alive);
+      check.mismatches += count_mismatches(others[j], expected[j], alive);
+    }
+  }
+
+  return check;
+}
+
+// Returns the rotation by `angle` around the X, Y, or Z `axis` (0, 1, or 2)
+// NOTE: The entries are only sines and cosines, so the compiler cannot fuse anything in here.
+static soc::Matrix3 single_axis_rotation(const soc::uint32 axis, const float angle) {
+  soc::uint32 a = (axis + 1) % 3;
+  soc::uint32 b = (axis + 2) % 3;
+
+  soc::Matrix3 m;
+  m.data[a * 3 + a] = std::cos(angle);
+  m.data[a * 3 + b] = std::sin(angle);
+  m.data[b * 3 + a] = -std::sin(angle);
+  m.data[b * 3 + b] = std::cos(angle);
+
+  return m;
+}
+
+// Checks the `contact` of pair `i` against the one `out` has and mixes it into `check`
+static void check_contact(Check& check, const soc::ContactSoA& out, const soc::uint32 i, const bool hit, const soc::Contact& contact) {
+  bool batch_hit = (out.hits[i / 8] >> (i % 8)) & 1;
+  check.mismatches += batch_hit != hit;
+  if(!hit) {
+    return;
+  }
+
+  const float values[4] = {contact.normal.x, contact.normal.y, contact.normal.z, contact.depth};
+  const float batch[4]  = {out.normals.x[i], out.normals.y[i], out.normals.z[i], out.depths[i]};
+
+  check.hash        = hash_floats(check.hash, batch, 4);
+  check.mismatches += count_mismatches(values, batch, 4);
+}
+
+static Check check_contact_batch() {
+  Check check = check_create("*_contact_batch", 0xafe8ef735dba3298ull);
+
+  const soc::uint32 count = 1003;
+  static soc::Sphere spheres[2][count];
+  static soc::Capsule capsules[2][count];
+  static soc::AABB aabbs[2][count];
+  static soc::OBB obbs[2][count];
+
+  std::vector<char> memory(soc::sphere_soa_memory_size(count) * 2 + soc::capsule_soa_memory_size(count) * 2 + 
+                           soc::aabb_soa_memory_size(count) * 2 + soc::obb_soa_memory_size(count) * 2 + 
+                           soc::contact_soa_memory_size(count));
+  char* next = memory.data();
+
+  soc::SphereSoA sphere_soas[2];
+  soc::CapsuleSoA capsule_soas[2];
+  soc::AABBSoA aabb_soas[2];
+  soc::OBBSoA obb_soas[2];
+  for(soc::uint32 j = 0; j < 2; j++) {
+    sphere_soas[j]  = soc::sphere_soa_create(next, count);
+    next           += soc::sphere_soa_memory_size(count);
+    capsule_soas[j] = soc::capsule_soa_create(next, count);
+    next           += soc::capsule_soa_memory_size(count);
+    aabb_soas[j]    = soc::aabb_soa_create(next, count);
+    next           += soc::aabb_soa_memory_size(count);
+    obb_soas[j]     = soc::obb_soa_create(next, count);
+    next           += soc::obb_soa_memory_size(count);
+  }
+  soc::ContactSoA out = soc::contact_soa_create(next, count);
+
+  // The shapes are small next to the space they are in, so some of the pairs hit and some do not
+  soc::uint32 state = 31337;
+  for(soc::uint32 j = 0; j < 2; j++) {
+    for(soc::uint32 i = 0; i < count; i++) {
+      soc::Vector3 center(next_float(state, 2.0f), next_float(state, 2.0f), next_float(state, 2.0f));
+      soc::Vector3 extents(next_float(state, 0.5f) + 1.0f, next_float(state, 0.5f) + 1.0f, next_float(state, 0.5f) + 1.0f);
+      soc::Vector3 offset(next_float(state, 1.0f), next_float(state, 1.0f), next_float(state, 1.0f));
+      soc::Matrix3 orientation = single_axis_rotation(i % 3, next_float(state, 3.0f));
+
+      spheres[j][i]  = soc::Sphere(center, extents.x);
+      capsules[j][i] = soc::Capsule(center - offset, center + offset, extents.y * 0.5f);
+      aabbs[j][i]    = soc::AABB(center - extents, center + extents);
+      obbs[j][i]     = soc::OBB(center, extents, orientation);
+
+      const float sphere[4]   = {spheres[j][i].center.x, spheres[j][i].center.y, spheres[j][i].center.z, spheres[j][i].radius};
+      float* sphere_soa[4]    = {sphere_soas[j].centers.x, sphere_soas[j].centers.y, sphere_soas[j].centers.z, sphere_soas[j].radii};
+      const float capsule[7]  = {capsules[j][i].start.x, capsules[j][i].start.y, capsules[j][i].start.z, 
+                                 capsules[j][i].end.x, capsules[j][i].end.y, capsules[j][i].end.z, capsules[j][i].radius};
+      float* capsule_soa[7]   = {capsule_soas[j].starts.x, capsule_soas[j].starts.y, capsule_soas[j].starts.z, 
+                                 capsule_soas[j].ends.x, capsule_soas[j].ends.y, capsule_soas[j].ends.z, capsule_soas[j].radii};
+      const float aabb[6]     = {aabbs[j][i].min.x, aabbs[j][i].min.y, aabbs[j][i].min.z, aabbs[j][i].max.x, aabbs[j][i].max.y, aabbs[j][i].max.z};
+      float* aabb_soa[6]      = {aabb_soas[j].mins.x, aabb_soas[j].mins.y, aabb_soas[j].mins.z, aabb_soas[j].maxs.x, aabb_soas[j].maxs.y, aabb_soas[j].maxs.z};
+      float* obb_soa[15]      = {obb_soas[j].centers.x, obb_soas[j].centers.y, obb_soas[j].centers.z, 
+                                 obb_soas[j].extents.x, obb_soas[j].extents.y, obb_soas[j].extents.z};
+      for(soc::uint32 k = 0; k < 3; k++) {
+        obb_soa[6 + k * 3 + 0] = obb_soas[j].axes[k].x;
+        obb_soa[6 + k * 3 + 1] = obb_soas[j].axes[k].y;
+        obb_soa[6 + k * 3 + 2] = obb_soas[j].axes[k].z;
+      }
+
+      for(soc::uint32 k = 0; k < 4; k++) {
+        sphere_soa[k][i] = sphere[k];
+      }
+      for(soc::uint32 k = 0; k < 7; k++) {
+        capsule_soa[k][i] = capsule[k];
+      }
+      for(soc::uint32 k = 0; k < 6; k++) {
+        aabb_soa[k][i] = aabb[k];
+      }
+      for(soc::uint32 k = 0; k < 3; k++) {
+        obb_soa[k][i]     = center[k];
+        obb_soa[3 + k][i] = extents[k];
+      }
+      for(soc::uint32 k = 0; k < 9; k++) {
+        obb_soa[6 + k][i] = obbs[j][i].orientation.data[k];
+      }
+    }
+  }
+
+  soc::Contact contact;
+
+  soc::sphere_contact_batch(sphere_soas[0], sphere_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::sphere_contact(spheres[0][i], spheres[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::sphere_capsule_contact_batch(sphere_soas[0], capsule_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::sphere_capsule_contact(spheres[0][i], capsules[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::capsule_contact_batch(capsule_soas[0], capsule_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::capsule_contact(capsules[0][i], capsules[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::sphere_aabb_contact_batch(sphere_soas[0], aabb_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::sphere_aabb_contact(spheres[0][i], aabbs[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::sphere_obb_contact_batch(sphere_soas[0], obb_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::sphere_obb_contact(spheres[0][i], obbs[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::aabb_contact_batch(aabb_soas[0], aabb_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::aabb_contact(aabbs[0][i], aabbs[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  soc::obb_contact_batch(obb_soas[0], obb_soas[1], out);
+  for(soc::uint32 i = 0; i < count; i++) {
+    bool hit = soc::obb_contact(obbs[0][i], obbs[1][i], &contact);
+    check_contact(check, out, i, hit, contact);
+  }
+
+  return check;
+}
+
+// Returns stream `index` (out of 13) of the state that `rigid_body_integrate` moves
+static const float* rigid_body_stream(const soc::RigidBodySoA& bodies, const soc::uint32 index) {
+  const float* streams[13] = {
+    bodies.positions.x, bodies.positions.y, bodies.positions.z, 
+    bodies.linear_velocities.x, bodies.linear_velocities.y, bodies.linear_velocities.z, 
+    bodies.angular_velocities.x, bodies.angular_velocities.y, bodies.angular_velocities.z, 
+    bodies.orientations.x, bodies.orientations.y, bodies.orientations.z, bodies.orientations.w,
+  };
+
+  return streams[index];
+}
+
+static Check check_rigid_bodies() {
+  Check check = check_create("rigid_body_integrate", 0x84140296319ef1acull);
+
+  const soc::uint32 count = 1003;
+  std::vector<char> memory[2] = {
+    std::vector<char>(soc::rigid_body_soa_memory_size(count)),
+    std::vector<char>(soc::rigid_body_soa_memory_size(count)),
+  };
+  soc::RigidBodySoA bodies[2] = {
+    soc::rigid_body_soa_create(memory[0].data(), count),
+    soc::rigid_body_soa_create(memory[1].data(), count),
+  };
+
+  soc::uint32 state = 2024;
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::Vector3 position(next_float(state, 50.0f), next_float(state, 50.0f), next_float(state, 50.0f));
+    soc::Quaternion orientation = soc::quat_from_euler(soc::Vector3(next_float(state, 3.0f), next_float(state, 3.0f), next_float(state, 3.0f)), 
+                                                       soc::EULER_ORDER_XYZ);
+    float inverse_mass = i % 17 == 0 ? 0.0f : next_float(state, 0.5f) + 1.0f;
+    soc::Vector3 local_inverse_inertia(next_float(state, 0.5f) + 1.0f, next_float(state, 0.5f) + 1.0f, next_float(state, 0.5f) + 1.0f);
+
+    soc::rigid_body_add(bodies[0], position, orientation, inverse_mass, local_inverse_inertia);
+    soc::rigid_body_add(bodies[1], position, orientation, inverse_mass, local_inverse_inertia);
+  }
+
+  // The same steps on 1 and 3 threads, and the orientations and inertias against their scalar functions
+  const float delta_time = 1.0f / 7.0f;
+  static soc::Quaternion previous[count];
+  for(soc::uint32 step = 0; step < 6; step++) {
+    for(soc::uint32 i = 0; i < count; i++) {
+      soc::Vector3 force(next_float(state, 20.0f), next_float(state, 20.0f), next_float(state, 20.0f));
+      soc::Vector3 torque(next_float(state, 5.0f), next_float(state, 5.0f), next_float(state, 5.0f));
+
+      for(soc::RigidBodySoA& pool : bodies) {
+        pool.forces.x[i]  = force.x;
+        pool.forces.y[i]  = force.y;
+        pool.forces.z[i]  = force.z;
+        pool.torques.x[i] = torque.x;
+        pool.torques.y[i] = torque.y;
+        pool.torques.z[i] = torque.z;
+      }
+
+      previous[i] = soc::Quaternion(bodies[0].orientations.x[i], bodies[0].orientations.y[i], bodies[0].orientations.z[i], bodies[0].orientations.w[i]);
+    }
+
+    soc::rigid_body_integrate(bodies[0], soc::Vector3(0.0f, -9.81f, 0.0f), 0.1f, 0.2f, delta_time, 1);
+    soc::rigid_body_integrate(bodies[1], soc::Vector3(0.0f, -9.81f, 0.0f), 0.1f, 0.2f, delta_time, 3);
+
+    const soc::RigidBodySoA& pool = bodies[0];
+    for(soc::uint32 i = 0; i < count; i++) {
+      soc::Vector3 angular_velocity(pool.angular_velocities.x[i], pool.angular_velocities.y[i], pool.angular_velocities.z[i]);
+      soc::Vector3 local_inverse_inertia(pool.local_inverse_inertias.x[i], pool.local_inverse_inertias.y[i], pool.local_inverse_inertias.z[i]);
+
+      soc::Quaternion orientation = soc::quat_integrate(previous[i], angular_velocity, delta_time);
+      soc::Matrix3 inertia        = soc::rigid_body_world_inverse_inertia(orientation, local_inverse_inertia);
+
+      const float expected[10] = {orientation.x, orientation.y, orientation.z, orientation.w, 
+                                  inertia[0], inertia[4], inertia[8], inertia[1], inertia[2], inertia[5]};
+      const float values[10]   = {pool.orientations.x[i], pool.orientations.y[i], pool.orientations.z[i], pool.orientations.w[i], 
+                                  pool.world_inverse_inertias.xx[i], pool.world_inverse_inertias.yy[i], pool.world_inverse_inertias.zz[i],
+                                  pool.world_inverse_inertias.xy[i], pool.world_inverse_inertias.xz[i], pool.world_inverse_inertias.yz[i]};
+      check.mismatches += count_mismatches(values, expected, 10);
+    }
+
+    for(soc::uint32 j = 0; j < 13; j++) {
+      const float* stream = rigid_body_stream(bodies[0], j);
+      check.hash          = hash_floats(check.hash, stream, count);
+      check.mismatches   += count_mismatches(stream, rigid_body_stream(bodies[1], j), count);
+    }
+  }
+
+  return check;
+}
+
+// Checks the `Vector4` and `Vector3` versions of an RGB color batch against `scalar_func` (the alpha must be left as is)
+static void check_rgb_batch(Check& check,
+                            void (*batch4)(const soc::Vector4*, const soc::uint32, soc::Vector4*),
+                            void (*batch3)(const soc::Vector3*, const soc::uint32, soc::Vector3*),
+                            const soc::Vector3 (*scalar_func)(const soc::Vector3&),
+                            const std::vector<soc::Vector4>& colors) {
+  soc::uint32 count = (soc::uint32)colors.size();
+  std::vector<soc::Vector4> values(count), scalar(count);
+  std::vector<soc::Vector3> colors3(count), values3(count), scalar3(count);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    colors3[i] = soc::Vector3(colors[i].r, colors[i].g, colors[i].b);
+    scalar3[i] = scalar_func(colors3[i]);
+    scalar[i]  = soc::Vector4(scalar3[i], colors[i].a);
+  }
+
+  batch4(colors.data(), count, values.data());
+  check.hash        = hash_floats(check.hash, &values[0].x, count * 4);
+  check.mismatches += count_mismatches(&values[0].x, &scalar[0].x, count * 4);
+
+  batch3(colors3.data(), count, values3.data());
+  check.hash        = hash_floats(check.hash, &values3[0].x, count * 3);
+  check.mismatches += count_mismatches(&values3[0].x, &scalar3[0].x, count * 3);
+}
+
+static Check check_sprites() {
+  Check check = check_create("sprite_generate_vertices", 0xdab2568377e90629ull);
+
+  const soc::uint32 count = 1003;
+  static soc::Vector2 positions[count];
+  static float rotations[count];
+  static soc::Vector2 scales[count];
+  static soc::Vector2 origins[count];
+  static soc::Vector4 uv_rects[count];
+  static soc::SpriteVertex values[count * 4];
+  static soc::SpriteVertex scalar[count * 4];
+
+  soc::uint32 state = 8181;
+  for(soc::uint32 i = 0; i < count; i++) {
+    positions[i] = soc::Vector2(next_float(state, 500.0f), next_float(state, 500.0f));
+    rotations[i] = next_float(state, 7.0f);
+    scales[i]    = soc::Vector2(next_float(state, 64.0f), next_float(state, 64.0f));
+    origins[i]   = soc::Vector2(next_float(state, 1.0f) + 0.5f, next_float(state, 1.0f) + 0.5f);
+    uv_rects[i]  = soc::Vector4(next_float(state, 1.0f), next_float(state, 1.0f), next_float(state, 1.0f), next_float(state, 1.0f));
+  }
+
+  // The batch takes 4 sprites at a time, and one sprite at a time always goes through the scalar path
+  soc::sprite_generate_vertices(positions, rotations, scales, origins, uv_rects, count, values);
+  for(soc::uint32 i = 0; i < count; i++) {
+    soc::sprite_generate_vertices(&positions[i], &rotations[i], &scales[i], &origins[i], &uv_rects[i], 1, &scalar[i * 4]);
+  }
+
+  check.hash       = hash_floats(check.hash, &values[0].position.x, count * 16);
+  check.mismatches = count_mismatches(&values[0].position.x, &scalar[0].position.x, count * 16);
+
+  return check;
+}
+
+static Check check_color_batch() {
+  Check check = check_create("color_*_batch", 0x744b452326294556ull);
+
+  const soc::uint32 count = 1003;
+  std::vector<soc::Vector4> colors(count), values(count), scalar(count);
+  std::vector<soc::Vector3> colors3(count);
+  std::vector<soc::uint32> packed(count), packed_scalar(count);
+  std::vector<float> luminance(count), luminance_scalar(count);
+
+  soc::uint32 state = 4321;
+  for(soc::uint32 i = 0; i < count; i++) {
+    colors[i]  = soc::Vector4(next_float(state, 0.5f) + 0.5f, next_float(state, 0.5f) + 0.5f, next_float(state, 0.5f) + 0.5f, next_float(state, 0.5f) + 0.5f);
+    colors3[i] = soc::Vector3(colors[i].r, colors[i].g, colors[i].b);
+  }
+
+  check_rgb_batch(check, soc::color_srgb_to_linear_batch, soc::color_srgb_to_linear_batch, soc::color_srgb_to_linear, colors);
+  check_rgb_batch(check, soc::color_linear_to_srgb_batch, soc::color_linear_to_srgb_batch, soc::color_linear_to_srgb, colors);
+  check_rgb_batch(check, soc::color_rgb_to_hsv_batch, soc::color_rgb_to_hsv_batch, soc::color_rgb_to_hsv, colors);
+  check_rgb_batch(check, soc::color_hsv_to_rgb_batch, soc::color_hsv_to_rgb_batch, soc::color_hsv_to_rgb, colors);
+
+  for(soc::uint32 i = 0; i < count; i++) {
+    luminance_scalar[i] = soc::color_luminance(colors3[i]);
+  }
+  soc::color_luminance_batch(colors.data(), count, luminance.data());
+  check.hash        = hash_floats(check.hash, luminance.data(), count);
+  check.mismatches += count_mismatches(luminance.data(), luminance_scalar.data(), count);
+  soc::color_luminance_batch(colors3.data(), count, luminance.data());
+  check.hash        = hash_floats(check.hash, luminance.data(), count);
+  check.mismatches += count_mismatches(luminance.data(), luminance_scalar.data(), count);
+
+  soc::color_premultiply_batch(colors.data(), count, values.data());
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar[i] = soc::color_premultiply(colors[i]);
+  }
+  check.hash        = hash_floats(check.hash, &values[0].x, count * 4);
+  check.mismatches += count_mismatches(&values[0].x, &scalar[0].x, count * 4);
+
+  soc::color_pack_unorm8_batch(colors.data(), count, packed.data());
+  for(soc::uint32 i = 0; i < count; i++) {
+    packed_scalar[i] = soc::color_pack_unorm8(colors[i]);
+  }
+  check.hash        = hash_floats(check.hash, (const float*)packed.data(), count);
+  check.mismatches += count_mismatches((const float*)packed.data(), (const float*)packed_scalar.data(), count);
+
+  soc::color_unpack_unorm8_batch(packed.data(), count, values.data());
+  for(soc::uint32 i = 0; i < count; i++) {
+    scalar[i] = soc::color_unpack_unorm8(packed[i]);
+  }
+  check.hash        = hash_floats(check.hash, &values[0].x, count * 4);
+  check.mismatches += count_mismatches(&values[0].x, &scalar[0].x, count * 4);
+
+  // Infinite and NaN channels (with no `0 * inf` and never two NaNs in the same multiply, so every NaN that comes out 
+  // is one of the inputs)
+  const soc::uint32 special_count = 9;
+  soc::Vector4 special[special_count] = {
+    soc::Vector4(0.25f, 0.5f, 0.75f, INFINITY), 
+    soc::Vector4(0.25f, 0.5f, 0.75f, -INFINITY), 
+    soc::Vector4(0.25f, 0.5f, 0.75f, NAN), 
+    soc::Vector4(0.125f, -0.5f, 1.5f, INFINITY), 
+    soc::Vector4(NAN, 0.5f, 0.75f, 0.5f), 
+    soc::Vector4(0.25f, INFINITY, -INFINITY, 0.5f), 
+    soc::Vector4(INFINITY, 0.5f, 0.75f, 2.0f), 
+    soc::Vector4(0.25f, -NAN, 0.75f, 1.0f), 
+    soc::Vector4(-INFINITY, NAN, INFINITY, 0.25f), 
+  };
+
+  soc::color_premultiply_batch(special, special_count, values.data());
+  for(soc::uint32 i = 0; i < special_count; i++) {
+    scalar[i] = soc::color_premultiply(special[i]);
+  }
+  check.hash        = hash_floats(check.hash, &values[0].x, special_count * 4);
+  check.mismatches += count_mismatches(&values[0].x, &scalar[0].x, special_count * 4);
+
+  soc::color_pack_unorm8_batch(special, special_count, packed.data());
+  for(soc::uint32 i = 0; i < special_count; i++) {
+    packed_scalar[i] = soc::color_pack_unorm8(special[i]);
+  }
+  check.hash        = hash_floats(check.hash, (const float*)packed.data(), special_count);
+  check.mismatches += count_mismatches((const float*)packed.data(), (const float*)packed_scalar.data(), special_count);
+
+  return check;
+}
+
+static Check check_anim_batch() {
+  Check check = check_create("anim_sample_batch", 0x9816284c8cafe2d4ull);
+
+  // Two clips of 12 tracks (with a few single key tracks), and the instances of each clip in runs of different lengths
+  const soc::uint32 tracks_count = 12;
+  const soc::uint32 keys_count   = 17;
+  const soc::uint32 count        = 403;
+
+  std::vector<soc::uint32> offsets(tracks_count + 1);
+  std::vector<float> times;
+  std::vector<soc::Vector3> values;
+  std::vector<soc::Quaternion> rotations;
+
+  soc::uint32 state = 777;
+  for(soc::uint32 i = 0; i < tracks_count; i++) {
+    offsets[i] = (soc::uint32)times.size();
+
+    soc::uint32 keys = (i % 5) == 0 ? 1 : keys_count;
+    for(soc::uint32 j = 0; j < keys; j++) {
+      times.push_back((float)j * 0.125f);
+      values.push_back(soc::Vector3(next_float(state, 4.0f), next_float(state, 4.0f), next_float(state, 4.0f)));
+      rotations.push_back(soc::quat_from_euler(soc::Vector3(next_float(state, 3.0f), next_float(state, 3.0f), next_float(state, 3.0f)), 
+                                               soc::EULER_ORDER_XYZ));
+    }
+  }
+  offsets[tracks_count] = (soc::uint32)times.size();
+
+  soc::AnimationClip clips[2];
+  for(soc::AnimationClip& clip : clips) {
+    clip.duration            = 2.0f;
+    clip.tracks_count        = tracks_count;
+    clip.translation_offsets = offsets.data();
+    clip.translation_times   = times.data();
+    clip.translations        = values.data();
+    clip.rotation_offsets    = offsets.data();
+    clip.rotation_times      = times.data();
+    clip.rotations           = rotations.data();
+    clip.scale_offsets       = offsets.data();
+    clip.scale_times         = times.data();
+    clip.scales              = values.data();
+  }
+
+  std::vector<soc::uint32> cursors[2];
+  std::vector<soc::Vector3> translations[2], scales[2];
+  std::vector<soc::Quaternion> pose_rotations[2];
+  std::vector<soc::AnimationInstance> instances[2];
+  std::vector<soc::AnimationPose> poses[2];
+
+  for(soc::uint32 j = 0; j < 2; j++) {
+    cursors[j].resize(count * tracks_count * 3);
+    translations[j].resize(count * tracks_count);
+    scales[j].resize(count * tracks_count);
+    pose_rotations[j].resize(count * tracks_count);
+    instances[j].resize(count);
+    poses[j].resize(count);
+  }
+
+  soc::uint32 run = 0;
+  for(soc::uint32 i = 0; i < count; i++) {
+    run = (i % 7) == 0 ? run + 1 : run;
+    float time = next_float(state, 1.0f) + 1.0f;
+
+    for(soc::uint32 j = 0; j < 2; j++) {
+      instances[j][i]            = soc::anim_instance_create(clips[run % 2], &cursors[j][i * tracks_count * 3]);
+      instances[j][i].time       = time;
+      instances[j][i].is_looping = (i % 3) != 0;
+      poses[j][i]                = soc::AnimationPose{&translations[j][i * tracks_count], &pose_rotations[j][i * tracks_count], &scales[j][i * tracks_count]};
+    }
+  }
+
+  // A power of 2 step at a speed of 1 keeps the times exact (so they do not depend on how this file gets compiled), 
+  // and the last frames play the clips in reverse
+  for(soc::uint32 frame = 0; frame < 60; frame++) {
+    float delta = frame == 20 ? -0.75f : (frame < 40 ? 0.015625f : -0.0625f);
+
+    soc::anim_sample_batch(instances[0].data(), poses[0].data(), count, delta);
+    for(soc::uint32 i = 0; i < count; i++) {
+      soc::anim_instance_advance(instances[1][i], delta);
+      soc::anim_sample(instances[1][i], poses[1][i]);
+    }
+
+    check.hash        = hash_floats(check.hash, &translations[0][0].x, count * tracks_count * 3);
+    check.hash        = hash_floats(check.hash, &pose_rotations[0][0].x, count * tracks_count * 4);
+    check.hash        = hash_floats(check.hash, &scales[0][0].x, count * tracks_count * 3);
+    check.mismatches += count_mismatches(&translations[0][0].x, &translations[1][0].x, count * tracks_count * 3);
+    check.mismatches += count_mismatches(&pose_rotations[0][0].x, &pose_rotations[1][0].x, count * tracks_count * 4);
+    check.mismatches += count_mismatches(&scales[0][0].x, &scales[1][0].x, count * tracks_count * 3);
+    check.mismatches += count_mismatches((const float*)cursors[0].data(), (const float*)cursors[1].data(), count * tracks_count * 3);
+  }
+
+  return check;
+}
+
+int main() {
+  Check results[] = {
+    check_noise_grid(),
+    check_noise_batch(),
+    check_random_batch(),
+    check_decompose_batch(),
+    check_euler_batch(),
+    check_rotate_batch(),
+    check_soa_batch(),
+    check_view_batch(),
+    check_particles(),
+    check_contact_batch(),
+    check_rigid_bodies(),
+    check_sprites(),
+    check_color_batch(),
+    check_anim_batch(),
+  };
+
+  bool has_failed = false;
+
+  printf("%-24s %18s %18s %10s %s\n", "function", "hash", "golden", "mismatches", "result");
+  for(const Check& check : results) {
+    bool passed = check.hash == check.golden && check.mismatches == 0;
+    has_failed  = has_failed || !passed;
+
+    printf("%-24s %18llx %18llx %10u %s\n",
+           check.name,
+           (unsigned long long)check.hash,
+           (unsigned long long)check.golden,
+           check.mismatches,
+           passed ? "PASS" : "FAIL");
+  }
+
+  return has_failed ? 1 : 0;
+}
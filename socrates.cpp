@@ -0,0 +1,6 @@
+// Compiles the out-of-line functions of Socrates (the ones marked with `SOC_API`) exactly once.
+// Link against this translation unit (or the `socrates_static` target) and define `SOC_STATIC_LIB` 
+// everywhere else "socrates.h" gets included.
+
+#define SOC_IMPLEMENTATION
+#include "socrates.h"
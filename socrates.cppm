@@ -0,0 +1,37 @@
+// The `socrates` C++20 module. Use `import socrates;` instead of including "socrates.h".
+//
+// The module exports everything inside the `soc` namespace. The out-of-line functions (the ones marked 
+// with `SOC_API`) are compiled once inside the module instead of being inlined in every importer.
+// NOTE: Macros (like `SOC_PI` or `SOC_DEG2RAD`) cannot be exported from a module. Include "socrates.h" as well 
+// if you need them.
+
+module;
+
+// The headers that "socrates.h" includes have to be included here first
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(SOC_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <immintrin.h>
+#endif
+
+#ifndef SOC_NO_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+export module socrates;
+
+#define SOC_MODULE_EXPORT export
+
+// GCC crashes while writing `#pragma GCC optimize` into a module, so the module gets built with `-ffp-contract=off` 
+// and `-fno-tree-slp-vectorize` instead (the `socrates_module` target passes them on to the importers as well)
+#if defined(__GNUC__) && !defined(__clang__)
+#define SOC_FP_STRICT_BEGIN 
+#define SOC_FP_STRICT_END 
+#endif
+
+#define SOC_IMPLEMENTATION
+#include "socrates.h"
@@ -10,8 +10,40 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// SIMD support
+// NOTE: SSE is used automatically whenever the compiler targets it (which is always the case on x86-64).
+// Define `SOC_NO_SIMD` before including the library to force the scalar code paths instead.
+#if !defined(SOC_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SOC_SIMD_SSE 1
+#include <immintrin.h>
+#endif
+
+// NOTE: AVX is only used by the 8 lanes wide types, and only when the compiler targets it (`-mavx` or `-march=native`).
+#if defined(SOC_SIMD_SSE) && defined(__AVX__)
+#define SOC_SIMD_AVX 1
+#endif
+
+// Threads support
+// NOTE: Some of the batch functions can split their work across multiple threads with a pool of `std::thread`s.
+// Define `SOC_NO_THREADS` before including the library to always run them on the calling thread instead.
+#ifndef SOC_NO_THREADS
+#define SOC_THREADS 1
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// NOTE: Any new header included above should also be included in the global module fragment of "socrates.cppm"
+
+// Used by "socrates.cppm" to export everything inside the `soc` namespace
+#ifndef SOC_MODULE_EXPORT
+#define SOC_MODULE_EXPORT
+#endif
 
-namespace soc { // Start of soc
+SOC_MODULE_EXPORT namespace soc { // Start of soc
 
 // Platform defines
 ///////////////////////////////////////////////////////////////
@@ -26,6 +58,45 @@ namespace soc { // Start of soc
 #define SOC_NOINLINE 
 #endif
 
+// Strict floating-point math
+// NOTE: When the compiler targets FMA instructions (`-mfma` or `-march=native`), GCC and Clang fuse multiplies and adds 
+// into one instruction wherever they see fit, which is different for every code path (SSE, AVX, or `SOC_NO_SIMD`). 
+// Everything between `SOC_FP_STRICT_BEGIN` and `SOC_FP_STRICT_END` is compiled without that, so the functions that promise 
+// the exact same results on every code path keep that promise with FMA too. GCC also needs its SLP vectorizer turned off 
+// there, since it fuses `a * b - c` and `a * b + c` in neighbouring lanes into one `vfmaddsub` even with `-ffp-contract=off`. 
+// With GCC, these functions do not get inlined into code that is built with other options, unless that code is also 
+// built with `-ffp-contract=off -fno-tree-slp-vectorize`. None of this is needed when targeting x86 without FMA (nothing 
+// can get fused there), and MSVC does not fuse unless `/fp:contract` or `/fp:fast` is given.
+#if defined(SOC_FP_STRICT_BEGIN)
+// Already defined before including the library (like "socrates.cppm" does)
+#elif (defined(__x86_64__) || defined(__i386__)) && !defined(__FMA__) && !defined(__FMA4__)
+#define SOC_FP_STRICT_BEGIN 
+#define SOC_FP_STRICT_END 
+#elif defined(__clang__)
+#define SOC_FP_STRICT_BEGIN _Pragma("float_control(push)") _Pragma("clang fp contract(off)")
+#define SOC_FP_STRICT_END   _Pragma("float_control(pop)")
+#elif defined(__GNUC__)
+#define SOC_FP_STRICT_BEGIN _Pragma("GCC push_options") _Pragma("GCC optimize(\"fp-contract=off\", \"no-tree-slp-vectorize\")")
+#define SOC_FP_STRICT_END   _Pragma("GCC pop_options")
+#else
+#define SOC_FP_STRICT_BEGIN 
+#define SOC_FP_STRICT_END 
+#endif
+
+// Out-of-line functions
+// NOTE: By default, every function in Socrates is inlined and lives in this header. However, if `SOC_STATIC_LIB` 
+// is defined, the bigger functions (the ones marked with `SOC_API`) are only declared here and are instead compiled once 
+// in the translation unit that defines `SOC_IMPLEMENTATION` before including this file (like "socrates.cpp" does).
+#if defined(SOC_STATIC_LIB) || defined(SOC_IMPLEMENTATION)
+#define SOC_API 
+#else 
+#define SOC_API SOC_INLINE
+#endif
+
+#if defined(SOC_STATIC_LIB) && !defined(SOC_IMPLEMENTATION)
+#define SOC_DECLARE_ONLY
+#endif
+
 ///////////////////////////////////////////////////////////////
 
 // Defines
@@ -60,8 +131,8 @@ typedef short int16;
 // int
 typedef int   int32; 
 
-// long
-typedef long  int64;
+// long long (`long` is only 32 bits on Windows)
+typedef long long int64;
 
 // unsigned char
 typedef unsigned char  uint8;
@@ -72,8 +143,8 @@ typedef unsigned short uint16;
 // unsigned int
 typedef unsigned int   uint32; 
 
-// unsigned long
-typedef unsigned long  uint64;
+// unsigned long long (`unsigned long` is only 32 bits on Windows)
+typedef unsigned long long uint64;
 
 // float
 typedef float  float32;
@@ -81,6 +152,8 @@ typedef float  float32;
 // double
 typedef double float64;
 
+static_assert(sizeof(int64) == 8 && sizeof(uint64) == 8, "The 64-bit types need to be 64 bits wide");
+
 ///////////////////////////////////////////////////////////////
 
 // Socrates types
@@ -251,6 +324,82 @@ union Vector4 {
   }
 };
 
+// Three component vector padded and aligned to 16 bytes
+// NOTE: Unlike `Vector3`, arrays of `Vector3A` never straddle SIMD lanes, so every vector is loaded 
+// and stored with a single aligned SIMD instruction. The 4th component (`padding`) is NOT part of the vector. 
+// It is ignored by every function and its value is unspecified after any operation.
+union alignas(16) Vector3A {
+  float32 components[4];
+
+  struct {
+    float32 x, y, z, padding;
+  };
+
+  struct {
+    float32 r, g, b; 
+  };
+
+#ifdef SOC_SIMD_SSE
+  __m128 simd;
+
+  // Takes the SIMD register of the vector
+  Vector3A(const __m128 simd) 
+    :simd(simd)
+  {}
+#endif
+
+  // Default CTOR
+  Vector3A() 
+    :x(0.0f), y(0.0f), z(0.0f), padding(0.0f)
+  {}
+
+  // Takes the `x`, `y`, and `z` components of the vector 
+  Vector3A(float32 x, float32 y, float32 z) 
+    :x(x), y(y), z(z), padding(0.0f)
+  {}
+
+  // Takes a `Vector2` to fill the `x` and `y` components and also a `z` component
+  Vector3A(const Vector2& v, float32 z) 
+    :x(v.x), y(v.y), z(z), padding(0.0f)
+  {}
+
+  // Takes the `x`, `y`, and `z` components of the given `Vector3`
+  Vector3A(const Vector3& v) 
+    :x(v.x), y(v.y), z(v.z), padding(0.0f)
+  {}
+
+  // Takes the `x`, `y`, and `z` components of the given `Vector4` and drops the `w` component
+  Vector3A(const Vector4& v) 
+    :x(v.x), y(v.y), z(v.z), padding(0.0f)
+  {}
+
+  // Fils all of the components with the given value 
+  Vector3A(float32 s)
+    :x(s), y(s), z(s), padding(0.0f)
+  {}
+
+  // Index operator overload into the components
+  // NOTE: This indexing operator overload and all other overloads of this type 
+  // will NOT check for out of bounds indices. Please keep this in mind
+  float32 operator[](const uint32 index) {
+    if(index > 2) {
+      // @TODO: Should assert here
+      return 0.0f;
+    }
+
+    return components[index];
+  }
+  
+  float32 operator[](const uint32 index) const {
+    if(index > 2) {
+      // @TODO: Should assert here
+      return 0.0f;
+    }
+
+    return components[index];
+  }
+};
+
 // A 3x3 matrix 
 struct Matrix3 {
   // Entries
@@ -384,6 +533,65 @@ union Matrix4 {
   }
 };
 
+// A 2x3 affine matrix for 2D transformations
+// NOTE: The entries are stored as three columns: the X axis (`data[0]`, `data[1]`), 
+// the Y axis (`data[2]`, `data[3]`), and the translation (`data[4]`, `data[5]`).
+struct Matrix2x3 {
+  // Entries
+  float32 data[6];
+
+  // Default CTOR where the matrix gets initialized as an identity matrix
+  Matrix2x3() {
+    data[0] = 1; data[1] = 0; 
+    data[2] = 0; data[3] = 1; 
+    data[4] = 0; data[5] = 0;
+  }
+
+  // Takes in every single entry for the matrix
+  Matrix2x3(float32 m0, float32 m1, 
+            float32 m2, float32 m3, 
+            float32 m4, float32 m5) {
+    data[0] = m0; data[1] = m1; 
+    data[2] = m2; data[3] = m3; 
+    data[4] = m4; data[5] = m5;
+  }
+
+  // Takes in an array of floats and fills the entries of the matrix 
+  // NOTE: The constructor does not check if the array of values given 
+  // is valid or has the same size as the matrix. 
+  Matrix2x3(float32* values) {
+    for(uint8 i = 0; i < 6; i++) {
+      data[i] = values[i];
+    }
+  }
+
+  // Fills the columns of the matrix with the given vectors 
+  Matrix2x3(const Vector2& col1, const Vector2& col2, const Vector2& col3) {
+    data[0] = col1.x; data[1] = col1.y; 
+    data[2] = col2.x; data[3] = col2.y; 
+    data[4] = col3.x; data[5] = col3.y;
+  }
+  
+  // Index operator overload into the components
+  // NOTE: This indexing operator overload and all other overloads of this type 
+  // will NOT check for out of bounds indices. Please keep this in mind
+  float32 operator[](const uint32 index) {
+    if(index > 5) {
+      return 0.0f;
+    }
+
+    return data[index];
+  }
+
+  float32 operator[](const uint32 index) const {
+    if(index > 5) {
+      return 0.0f;
+    }
+
+    return data[index];
+  }
+};
+
 // A quaternion 
 union Quaternion {
   struct {
@@ -412,6 +620,33 @@ union Quaternion {
   {}
 };
 
+// An axis-aligned bounding box
+struct AABB {
+  Vector3 min; 
+  Vector3 max;
+
+  // Default CTOR where both `min` and `max` are at the origin
+  AABB() 
+    :min(0.0f), max(0.0f)
+  {}
+
+  // Takes the `min` and `max` corners of the box
+  AABB(const Vector3& min, const Vector3& max) 
+    :min(min), max(max)
+  {}
+};
+
+// The order Euler angles get applied in. `EULER_ORDER_XYZ`, for example, rotates around 
+// the X axis first, then the Y axis, and then the Z axis (the same as `Rz * Ry * Rx`).
+enum EulerOrder {
+  EULER_ORDER_XYZ = 0, 
+  EULER_ORDER_XZY, 
+  EULER_ORDER_YXZ, 
+  EULER_ORDER_YZX, 
+  EULER_ORDER_ZXY, 
+  EULER_ORDER_ZYX,
+};
+
 ///////////////////////////////////////////////////////////////
 
 // Vector2 operator overloading
@@ -646,6 +881,127 @@ SOC_INLINE Vector4 operator-(const Vector4& v) {
 
 ///////////////////////////////////////////////////////////////
 
+// Vector3A operator overloading
+///////////////////////////////////////////////////////////////
+
+#ifdef SOC_SIMD_SSE
+
+SOC_INLINE Vector3A operator+(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(_mm_add_ps(v1.simd, v2.simd));
+}
+
+SOC_INLINE Vector3A operator+(const Vector3A& v, const float32 s) {
+  return Vector3A(_mm_add_ps(v.simd, _mm_set1_ps(s)));
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(_mm_sub_ps(v1.simd, v2.simd));
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v, const float32 s) {
+  return Vector3A(_mm_sub_ps(v.simd, _mm_set1_ps(s)));
+}
+
+SOC_INLINE Vector3A operator*(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(_mm_mul_ps(v1.simd, v2.simd));
+}
+
+SOC_INLINE Vector3A operator*(const Vector3A& v, const float32 s) {
+  return Vector3A(_mm_mul_ps(v.simd, _mm_set1_ps(s)));
+}
+
+SOC_INLINE Vector3A operator/(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(_mm_div_ps(v1.simd, v2.simd));
+}
+
+SOC_INLINE Vector3A operator/(const Vector3A& v, const float32 s) {
+  return Vector3A(_mm_div_ps(v.simd, _mm_set1_ps(s)));
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v) {
+  return Vector3A(_mm_xor_ps(v.simd, _mm_set1_ps(-0.0f)));
+}
+
+#else
+
+SOC_INLINE Vector3A operator+(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+}
+
+SOC_INLINE Vector3A operator+(const Vector3A& v, const float32 s) {
+  return Vector3A(v.x + s, v.y + s, v.z + s);
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v, const float32 s) {
+  return Vector3A(v.x - s, v.y - s, v.z - s);
+}
+
+SOC_INLINE Vector3A operator*(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+SOC_INLINE Vector3A operator*(const Vector3A& v, const float32 s) {
+  return Vector3A(v.x * s, v.y * s, v.z * s);
+}
+
+SOC_INLINE Vector3A operator/(const Vector3A& v1, const Vector3A& v2) {
+  return Vector3A(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
+}
+
+SOC_INLINE Vector3A operator/(const Vector3A& v, const float32 s) {
+  return Vector3A(v.x / s, v.y / s, v.z / s);
+}
+
+SOC_INLINE Vector3A operator-(const Vector3A& v) {
+  return Vector3A(-v.x, -v.y, -v.z);
+}
+
+#endif
+
+SOC_INLINE Vector3A operator*(const Vector3A& v, const Matrix3& m) {
+  return Vector3A((v.x * m[0]) + (v.y * m[1]) + (v.z * m[2]), 
+                  (v.x * m[3]) + (v.y * m[4]) + (v.z * m[5]), 
+                  (v.x * m[6]) + (v.y * m[7]) + (v.z * m[8]));
+}
+
+SOC_INLINE void operator+=(Vector3A& v1, const Vector3A& v2) {
+  v1 = v1 + v2;
+}
+
+SOC_INLINE void operator+=(Vector3A& v, const float32& s) {
+  v = v + s;
+}
+
+SOC_INLINE void operator-=(Vector3A& v1, const Vector3A& v2) {
+  v1 = v1 - v2;
+}
+
+SOC_INLINE void operator-=(Vector3A& v, const float32& s) {
+  v = v - s;
+}
+
+SOC_INLINE void operator*=(Vector3A& v1, const Vector3A& v2) {
+  v1 = v1 * v2;
+}
+
+SOC_INLINE void operator*=(Vector3A& v, const float32& s) {
+  v = v * s;
+}
+
+SOC_INLINE void operator/=(Vector3A& v1, const Vector3A& v2) {
+  v1 = v1 / v2;
+}
+
+SOC_INLINE void operator/=(Vector3A& v, const float32& s) {
+  v = v / s;
+}
+
+///////////////////////////////////////////////////////////////
+
 // Matrix3 operator overloading
 ///////////////////////////////////////////////////////////////
 
@@ -860,6 +1216,32 @@ SOC_INLINE void operator*=(Matrix4& m, const float32 s) {
 
 ///////////////////////////////////////////////////////////////
 
+// Matrix2x3 operator overloading
+///////////////////////////////////////////////////////////////
+
+// Returns the combined transformation of `m1` and `m2`, where `m2` gets applied first
+SOC_INLINE Matrix2x3 operator*(const Matrix2x3& m1, const Matrix2x3& m2) {
+  return Matrix2x3((m1[0] * m2[0]) + (m1[2] * m2[1]),         // m0
+                   (m1[1] * m2[0]) + (m1[3] * m2[1]),         // m1
+                   (m1[0] * m2[2]) + (m1[2] * m2[3]),         // m2
+                   (m1[1] * m2[2]) + (m1[3] * m2[3]),         // m3
+                   (m1[0] * m2[4]) + (m1[2] * m2[5]) + m1[4], // m4
+                   (m1[1] * m2[4]) + (m1[3] * m2[5]) + m1[5]  // m5
+                  );
+}
+
+// Returns the point `v` transformed by `m`
+SOC_INLINE Vector2 operator*(const Vector2& v, const Matrix2x3& m) {
+  return Vector2((v.x * m[0]) + (v.y * m[2]) + m[4], 
+                 (v.x * m[1]) + (v.y * m[3]) + m[5]);
+}
+
+SOC_INLINE void operator*=(Matrix2x3& m1, const Matrix2x3& m2) {
+  m1 = m1 * m2;
+}
+
+///////////////////////////////////////////////////////////////
+
 // Quaternion operator overloading
 ///////////////////////////////////////////////////////////////
 
@@ -900,94 +1282,619 @@ SOC_INLINE const void operator*=(Quaternion& q, const float32 s) {
 
 ///////////////////////////////////////////////////////////////
 
-// Misc. functions
+// SIMD functions
 ///////////////////////////////////////////////////////////////
 
-// Returns a float scalar between `min` and `max`
-SOC_INLINE float32 float_clamp(const float32 value, const float32 min, const float32 max) {
-  if(value > max) {
-    return max;
-  }
-  else if(value < min) {
-    return value;
-  }
-
-  return value;
-}
+#ifdef SOC_SIMD_SSE
 
-// Returns a int scalar between `min` and `max`
-SOC_INLINE int32 int_clamp(const int32 value, const int32 min, const int32 max) {
-  if(value > max) {
-    return max;
-  }
-  else if(value < min) {
-    return value;
-  }
+// Returns the cross product of the first three lanes of `a` and `b`. The last lane is always 0
+SOC_INLINE __m128 simd_cross3(const __m128 a, const __m128 b) {
+  __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+  __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+  __m128 c     = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
 
-  return value;
+  return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
 }
 
-// Sin of `x`
-SOC_INLINE float64 sin(const float64 x) {
-  return std::sin(x);
+// Returns the sum of all the lanes of `a` in every lane
+SOC_INLINE __m128 simd_hadd(const __m128 a) {
+  __m128 sum = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
 }
 
-// Cos of `x`
-SOC_INLINE float64 cos(const float64 x) {
-  return std::cos(x);
-}
+// Loads the 4 tightly packed 3D vectors in the 12 `values` into the `x`, `y`, and `z` registers (from AoS to SoA)
+SOC_INLINE void simd_load_vec3(const float32* values, __m128* x, __m128* y, __m128* z) {
+  // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+  __m128 a = _mm_loadu_ps(values);
+  __m128 b = _mm_loadu_ps(values + 4);
+  __m128 c = _mm_loadu_ps(values + 8);
 
-// Tan of `x`
-SOC_INLINE float64 tan(const float64 x) {
-  return std::tan(x);
-}
+  __m128 x_hi = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+  __m128 y_lo = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)); // y0 y0 y1 y1
+  __m128 y_hi = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+  __m128 z_lo = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)); // z0 z0 z1 z1
 
-// Atan of `x`
-SOC_INLINE float64 atan(const float64 x) {
-  return std::atan(x);
+  *x = _mm_shuffle_ps(a, x_hi, _MM_SHUFFLE(2, 0, 3, 0));
+  *y = _mm_shuffle_ps(y_lo, y_hi, _MM_SHUFFLE(2, 0, 2, 0));
+  *z = _mm_shuffle_ps(z_lo, c, _MM_SHUFFLE(3, 0, 2, 0));
 }
 
-// Atan2 of `y` and `x`
-SOC_INLINE float64 atan2(const float64 y, const float64 x) {
-  return std::atan2(y, x);
-}
+// Stores the `x`, `y`, and `z` registers into 4 tightly packed 3D vectors in the 12 `out_values` (from SoA to AoS)
+SOC_INLINE void simd_store_vec3(const __m128 x, const __m128 y, const __m128 z, float32* out_values) {
+  __m128 v[4] = {x, y, z, _mm_setzero_ps()};
+  _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
 
-// Floor of `x`
-SOC_INLINE float64 floor(const float64 x) {
-  return std::floor(x);
-}
+  // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+  __m128 a = _mm_shuffle_ps(v[0], _mm_shuffle_ps(v[0], v[1], _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+  __m128 b = _mm_shuffle_ps(v[1], v[2], _MM_SHUFFLE(1, 0, 2, 1));
+  __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(v[2], v[3], _MM_SHUFFLE(0, 0, 2, 2)), v[3], _MM_SHUFFLE(2, 1, 2, 0));
 
-// Square root of `x` 
-SOC_INLINE float64 sqrt(const float64 x) {
-  return std::sqrt(x);
+  _mm_storeu_ps(out_values, a);
+  _mm_storeu_ps(out_values + 4, b);
+  _mm_storeu_ps(out_values + 8, c);
 }
 
-// Returns the smallest number between `x` and `y` 
-SOC_INLINE float64 min(const float64 x, const float64 y) {
-  return std::min(x, y);
-}
+// Returns `a` with every lane set to lane `index` of `a`
+#define SOC_SIMD_SPLAT(a, index) _mm_shuffle_ps((a), (a), _MM_SHUFFLE(index, index, index, index))
 
-// Returns the biggest number between `x` and `y` 
-SOC_INLINE float64 max(const float64 x, const float64 y) {
-  return std::max(x, y);
-}
+// Computes the sine and cosine of every lane of `x` RADIANS into `out_sin` and `out_cos` 
+// NOTE: This is the same algorithm as `sincos_fast` and it gives the exact same results. Like `sincos_fast`, it is 
+// compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so that stays true in every build.
+SOC_FP_STRICT_BEGIN
+SOC_INLINE void simd_sincos(const __m128 x, __m128* out_sin, __m128* out_cos) {
+  __m128i q        = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.63661977236758134f)));
+  __m128 quadrant  = _mm_cvtepi32_ps(q);
 
-// Returns the linear interpolation with the given `start`, `end`, and `amount` 
-SOC_INLINE float32 lerp(const float32 start, const float32 end, const float32 amount) {
-  return start + amount * (end - start);
-}
+  __m128 r = _mm_sub_ps(x, _mm_mul_ps(quadrant, _mm_set1_ps(1.5703125f)));
+  r        = _mm_sub_ps(r, _mm_mul_ps(quadrant, _mm_set1_ps(4.837512969970703125e-4f)));
+  r        = _mm_sub_ps(r, _mm_mul_ps(quadrant, _mm_set1_ps(7.54978995489188216e-8f)));
 
-// Remaps the given `value` from the old range to a new range 
-SOC_INLINE float32 remap(const float32 value, const float32 old_min, const float32 old_max, const float32 new_min, const float32 new_max) {
-  return (value - old_min) / (old_max - old_min) * (new_max - new_min) + new_max;
-}
+  __m128 r2 = _mm_mul_ps(r, r);
 
-///////////////////////////////////////////////////////////////
+  __m128 s_poly = _mm_add_ps(_mm_set1_ps(8.3321608736e-3f), _mm_mul_ps(r2, _mm_set1_ps(-1.9515295891e-4f)));
+  s_poly        = _mm_add_ps(_mm_set1_ps(-1.6666654611e-1f), _mm_mul_ps(r2, s_poly));
+  __m128 s      = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), s_poly));
 
-// Vector2 functions
-///////////////////////////////////////////////////////////////
+  __m128 c_poly = _mm_add_ps(_mm_set1_ps(-1.388731625493765e-3f), _mm_mul_ps(r2, _mm_set1_ps(2.443315711809948e-5f)));
+  c_poly        = _mm_add_ps(_mm_set1_ps(4.166664568298827e-2f), _mm_mul_ps(r2, c_poly));
+  __m128 c      = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), c_poly));
 
-// Returns the dot product of `v1` and `v2` 
+  // Odd quadrants swap the sine and the cosine 
+  __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+  __m128 sin  = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+  __m128 cos  = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+  // Flip the signs based on the quadrant
+  __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+  __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+  *out_sin = _mm_xor_ps(sin, sin_sign);
+  *out_cos = _mm_xor_ps(cos, cos_sign);
+}
+
+// Returns the natural logarithm of every lane of `x` 
+// NOTE: This is the same algorithm as `log_fast` and it gives the exact same results (neither of them fuses any multiply-adds).
+SOC_INLINE __m128 simd_log(const __m128 x) {
+  __m128i bits = _mm_castps_si128(x);
+  __m128 e     = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+  __m128 m     = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+
+  // Move the mantissa into [sqrt(0.5) - 1, sqrt(2) - 1]
+  __m128 is_small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+  e               = _mm_sub_ps(e, _mm_and_ps(is_small, _mm_set1_ps(1.0f)));
+  m               = _mm_add_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_and_ps(is_small, m));
+
+  __m128 z = _mm_mul_ps(m, m);
+  __m128 y = _mm_set1_ps(7.0376836292e-2f);
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.1514610310e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.2420140846e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.6668057665e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-2.4999993993e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174e-1f));
+  y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+
+  y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+  y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+
+  return _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+}
+
+// Returns `e` raised to the power of every lane of `x` 
+// NOTE: This is the same algorithm as `exp_fast` and it gives the exact same results (neither of them fuses any multiply-adds).
+SOC_INLINE __m128 simd_exp(const __m128 x) {
+  __m128 v = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-87.0f)), _mm_set1_ps(88.0f));
+
+  // Floor of `v / ln(2) + 0.5`
+  __m128 fx    = _mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f));
+  __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+  fx           = _mm_sub_ps(trunc, _mm_and_ps(_mm_cmpgt_ps(trunc, fx), _mm_set1_ps(1.0f)));
+
+  v = _mm_sub_ps(v, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+  v = _mm_sub_ps(v, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+
+  __m128 z = _mm_mul_ps(v, v);
+  __m128 y = _mm_set1_ps(1.9875691500e-4f);
+  y = _mm_add_ps(_mm_mul_ps(y, v), _mm_set1_ps(1.3981999507e-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, v), _mm_set1_ps(8.3334519073e-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, v), _mm_set1_ps(4.1665795894e-2f));
+  y = _mm_add_ps(_mm_mul_ps(y, v), _mm_set1_ps(1.6666665459e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, v), _mm_set1_ps(5.0000001201e-1f));
+  y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), v), _mm_set1_ps(1.0f));
+
+  // Multiply by 2^fx by building the exponent directly
+  __m128i pow2 = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fx), _mm_set1_epi32(127)), 23);
+  return _mm_mul_ps(y, _mm_castsi128_ps(pow2));
+}
+
+// Returns every lane of `x` raised to the power of `y` (for positive `x` only)
+SOC_INLINE __m128 simd_pow(const __m128 x, const __m128 y) {
+  return simd_exp(_mm_mul_ps(y, simd_log(x)));
+}
+SOC_FP_STRICT_END
+
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Parallel functions
+///////////////////////////////////////////////////////////////
+
+// The maximum number of threads `parallel_for` can split its work across
+#define SOC_MAX_THREADS 64
+
+// The function that gets called on each range of a `parallel_for`
+typedef void(*ParallelFunc)(void* user_data, const uint32 begin, const uint32 end);
+
+// Splits `[0, count)` into `threads_count` contiguous ranges and calls `func` on all of them in parallel, 
+// passing `user_data` along. The last range always runs on the calling thread, and the function only returns 
+// once every range is done.
+// NOTE: The other ranges run on a pool of worker threads that get created the first time they are needed and then 
+// sleep until the next call (they are joined when the program exits), so a call does not pay for creating any threads. 
+// The pool runs one call at a time. A call that comes in while the pool is busy (from another thread, or from inside 
+// of a range) creates its own threads instead, just like it would without a pool. 
+// `threads_count` gets clamped to `[1, SOC_MAX_THREADS]`. If `SOC_NO_THREADS` is defined, 
+// all the ranges run one after the other on the calling thread instead.
+SOC_API void parallel_for(const uint32 count, const uint32 threads_count, ParallelFunc func, void* user_data);
+
+#ifndef SOC_DECLARE_ONLY
+
+#ifdef SOC_THREADS
+
+// The worker threads of `parallel_for` and the call they are working on
+struct ThreadPool {
+  std::mutex mutex;       // Guards everything below
+  std::condition_variable wake;
+  std::condition_variable done;
+
+  std::thread workers[SOC_MAX_THREADS - 1];
+  uint32 workers_count;
+  uint64 generation;      // Bumped by every call, so the workers know there is new work
+  bool is_busy;           // Set while a `parallel_for` is running on the pool
+  bool is_quitting;
+
+  ParallelFunc func;
+  void* user_data;
+  uint32 count;
+  uint32 threads;
+  uint32 pending;         // The number of ranges the workers have not finished yet
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      is_quitting = true;
+    }
+    wake.notify_all();
+
+    for(uint32 i = 0; i < workers_count; i++) {
+      workers[i].join();
+    }
+  }
+};
+
+// Returns the pool that `parallel_for` runs on
+// NOTE: The pool is zero-initialized like any other static, so it starts out with no workers.
+SOC_INLINE ThreadPool& thread_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+// Runs range number `index` of every call to `parallel_for` that has one, until the pool quits
+SOC_INLINE void thread_pool_worker(ThreadPool* pool, const uint32 index, uint64 generation) {
+  std::unique_lock<std::mutex> lock(pool->mutex);
+
+  while(true) {
+    pool->wake.wait(lock, [&] { return pool->is_quitting || pool->generation != generation; });
+    if(pool->is_quitting) {
+      return;
+    }
+
+    generation = pool->generation;
+    if(index >= pool->threads - 1) {
+      continue;
+    }
+
+    ParallelFunc func = pool->func;
+    void* user_data   = pool->user_data;
+    uint32 begin      = (uint32)(((uint64)pool->count * index) / pool->threads);
+    uint32 end        = (uint32)(((uint64)pool->count * (index + 1)) / pool->threads);
+
+    lock.unlock();
+    func(user_data, begin, end);
+    lock.lock();
+
+    pool->pending--;
+    if(pool->pending == 0) {
+      pool->done.notify_one();
+    }
+  }
+}
+
+#endif
+
+SOC_API void parallel_for(const uint32 count, const uint32 threads_count, ParallelFunc func, void* user_data) {
+  uint32 threads = threads_count < 1 ? 1 : (threads_count > SOC_MAX_THREADS ? SOC_MAX_THREADS : threads_count);
+  threads        = threads > count ? (count > 0 ? count : 1) : threads;
+
+#ifdef SOC_THREADS
+  if(threads == 1) {
+    func(user_data, 0, count);
+    return;
+  }
+
+  ThreadPool& pool = thread_pool();
+  bool is_pooled   = false;
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+
+    if(!pool.is_busy) {
+      is_pooled      = true;
+      pool.is_busy   = true;
+      pool.func      = func;
+      pool.user_data = user_data;
+      pool.count     = count;
+      pool.threads   = threads;
+      pool.pending   = threads - 1;
+      pool.generation++;
+
+      // The new workers start out one generation behind, so they pick this call up right away
+      for(; pool.workers_count < threads - 1; pool.workers_count++) {
+        pool.workers[pool.workers_count] = std::thread(thread_pool_worker, &pool, pool.workers_count, pool.generation - 1);
+      }
+    }
+  }
+
+  // The pool is busy, so this call gets its own threads
+  if(!is_pooled) {
+    std::thread workers[SOC_MAX_THREADS - 1];
+
+    for(uint32 i = 0; i < threads - 1; i++) {
+      uint32 begin = (uint32)(((uint64)count * i) / threads);
+      uint32 end   = (uint32)(((uint64)count * (i + 1)) / threads);
+
+      workers[i] = std::thread(func, user_data, begin, end);
+    }
+
+    func(user_data, (uint32)(((uint64)count * (threads - 1)) / threads), count);
+
+    for(uint32 i = 0; i < threads - 1; i++) {
+      workers[i].join();
+    }
+
+    return;
+  }
+
+  pool.wake.notify_all();
+
+  func(user_data, (uint32)(((uint64)count * (threads - 1)) / threads), count);
+
+  std::unique_lock<std::mutex> lock(pool.mutex);
+  pool.done.wait(lock, [&] { return pool.pending == 0; });
+  pool.is_busy = false;
+#else
+  for(uint32 i = 0; i < threads; i++) {
+    func(user_data, (uint32)(((uint64)count * i) / threads), (uint32)(((uint64)count * (i + 1)) / threads));
+  }
+#endif
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Arena types
+///////////////////////////////////////////////////////////////
+
+// A linear allocator for temporary memory that only lives for a frame (or any other short scope)
+// NOTE: The arena does NOT own its memory. Give it a big enough block once (see `arena_create`) and it will 
+// hand out pieces of it by just bumping an offset. Allocations are never freed one by one. Instead, use 
+// `arena_marker` and `arena_rewind` to free everything allocated after a certain point, or `arena_reset` to free 
+// everything at once (usually at the start of every frame). So once the arena is set up, there are no heap allocations at all.
+// An arena is NOT thread-safe. Every thread should have its own arena (see `arena_per_thread`).
+struct FrameArena {
+  uint8* memory; 
+  uint64 capacity;
+  uint64 offset;
+
+  // The biggest `offset` the arena has ever reached, which is useful to find out how big the arena should be
+  uint64 peak;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Arena functions
+///////////////////////////////////////////////////////////////
+
+// Creates and returns an empty arena that allocates out of the given `memory` of `capacity` bytes
+SOC_INLINE const FrameArena arena_create(void* memory, const uint64 capacity) {
+  return FrameArena{(uint8*)memory, capacity, 0, 0};
+}
+
+// Allocates and returns `size` bytes from `arena`, aligned to `alignment` bytes 
+// NOTE: `alignment` must be a power of 2. Returns `nullptr` (and leaves `arena` as it was) if there is no room left.
+SOC_INLINE void* arena_alloc(FrameArena& arena, const uint64 size, const uint64 alignment) {
+  uintptr_t address = (uintptr_t)(arena.memory + arena.offset);
+  uint64 padding    = ((address + (alignment - 1)) & ~(alignment - 1)) - address;
+
+  if(arena.offset + padding + size > arena.capacity) {
+    return nullptr;
+  }
+
+  void* ptr     = arena.memory + arena.offset + padding;
+  arena.offset += padding + size;
+  arena.peak    = arena.offset > arena.peak ? arena.offset : arena.peak;
+
+  return ptr;
+}
+
+// Returns the current position of `arena`, which can be given to `arena_rewind` later
+SOC_INLINE const uint64 arena_marker(const FrameArena& arena) {
+  return arena.offset;
+}
+
+// Frees everything that was allocated from `arena` after `marker` was taken
+SOC_INLINE void arena_rewind(FrameArena& arena, const uint64 marker) {
+  arena.offset = marker;
+}
+
+// Frees everything that was allocated from `arena`
+SOC_INLINE void arena_reset(FrameArena& arena) {
+  arena.offset = 0;
+}
+
+// Returns the arena of the calling thread 
+// NOTE: The arena starts out empty with no memory, so every thread has to call `arena_create` on it once before using it.
+SOC_INLINE FrameArena& arena_per_thread() {
+  thread_local FrameArena arena = {nullptr, 0, 0, 0};
+  return arena;
+}
+
+///////////////////////////////////////////////////////////////
+
+// Misc. functions
+///////////////////////////////////////////////////////////////
+
+// Returns a float scalar between `min` and `max`
+SOC_INLINE float32 float_clamp(const float32 value, const float32 min, const float32 max) {
+  if(value > max) {
+    return max;
+  }
+  else if(value < min) {
+    return value;
+  }
+
+  return value;
+}
+
+// Returns a int scalar between `min` and `max`
+SOC_INLINE int32 int_clamp(const int32 value, const int32 min, const int32 max) {
+  if(value > max) {
+    return max;
+  }
+  else if(value < min) {
+    return value;
+  }
+
+  return value;
+}
+
+// Sin of `x`
+SOC_INLINE float64 sin(const float64 x) {
+  return std::sin(x);
+}
+
+// Cos of `x`
+SOC_INLINE float64 cos(const float64 x) {
+  return std::cos(x);
+}
+
+// Tan of `x`
+SOC_INLINE float64 tan(const float64 x) {
+  return std::tan(x);
+}
+
+// Atan of `x`
+SOC_INLINE float64 atan(const float64 x) {
+  return std::atan(x);
+}
+
+// Atan2 of `y` and `x`
+SOC_INLINE float64 atan2(const float64 y, const float64 x) {
+  return std::atan2(y, x);
+}
+
+// Floor of `x`
+SOC_INLINE float64 floor(const float64 x) {
+  return std::floor(x);
+}
+
+// Square root of `x` 
+SOC_INLINE float64 sqrt(const float64 x) {
+  return std::sqrt(x);
+}
+
+// Returns the smallest number between `x` and `y` 
+SOC_INLINE float64 min(const float64 x, const float64 y) {
+  return std::min(x, y);
+}
+
+// Returns the biggest number between `x` and `y` 
+SOC_INLINE float64 max(const float64 x, const float64 y) {
+  return std::max(x, y);
+}
+
+// Returns the linear interpolation with the given `start`, `end`, and `amount` 
+SOC_INLINE float32 lerp(const float32 start, const float32 end, const float32 amount) {
+  return start + amount * (end - start);
+}
+
+// Remaps the given `value` from the old range to a new range 
+SOC_INLINE float32 remap(const float32 value, const float32 old_min, const float32 old_max, const float32 new_min, const float32 new_max) {
+  return (value - old_min) / (old_max - old_min) * (new_max - new_min) + new_max;
+}
+
+// Returns an approximation of `1 / sqrt(x)` 
+// NOTE: Uses the hardware estimate refined with one Newton-Raphson step when SIMD is available.
+// The maximum error is 4 ULP compared to `1 / sqrt(x)` for any normal, positive `x`.
+SOC_INLINE float32 rsqrt_fast(const float32 x) {
+#ifdef SOC_SIMD_SSE
+  __m128 v   = _mm_set_ss(x);
+  __m128 est = _mm_rsqrt_ss(v);
+
+  // est * (1.5 - 0.5 * x * est * est)
+  __m128 half_x = _mm_mul_ss(v, _mm_set_ss(0.5f));
+  __m128 muls   = _mm_mul_ss(_mm_mul_ss(half_x, est), est);
+  est = _mm_mul_ss(est, _mm_sub_ss(_mm_set_ss(1.5f), muls));
+
+  return _mm_cvtss_f32(est);
+#else
+  return 1.0f / std::sqrt(x);
+#endif
+}
+
+// Returns the sine (in `x`) and the cosine (in `y`) of `x` RADIANS, computed together in float32
+// NOTE: This is an approximation that is only accurate for `|x| <= 8192`. The maximum error is 
+// 2 ULP relative to the float32 magnitude of the larger of the two results compared to `soc::sin` and `soc::cos`. 
+// It is compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), since the random sampling functions rely on it.
+SOC_FP_STRICT_BEGIN
+SOC_INLINE const Vector2 sincos_fast(const float32 x) {
+  // Reduce `x` into [-PI/4, PI/4] using an extended precision PI/2 (Cody-Waite)
+  float32 quadrant = std::nearbyint(x * 0.63661977236758134f);
+  int32 q          = (int32)quadrant;
+
+  float32 r = x - quadrant * 1.5703125f;
+  r        -= quadrant * 4.837512969970703125e-4f;
+  r        -= quadrant * 7.54978995489188216e-8f;
+
+  float32 r2 = r * r;
+
+  float32 s = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+  float32 c = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+  switch(q & 3) {
+    case 0:
+      return Vector2(s, c);
+    case 1:
+      return Vector2(c, -s);
+    case 2:
+      return Vector2(-s, -c);
+    default:
+      return Vector2(-c, s);
+  }
+}
+SOC_FP_STRICT_END
+
+// The same as `sincos_fast` but only returns the sine
+SOC_INLINE float32 sin_fast(const float32 x) {
+  return sincos_fast(x).x;
+}
+
+// The same as `sincos_fast` but only returns the cosine
+SOC_INLINE float32 cos_fast(const float32 x) {
+  return sincos_fast(x).y;
+}
+
+// NOTE: `log_fast`, `exp_fast`, and `pow_fast` are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), 
+// so their SIMD versions (and the color functions that use them) give the exact same results in every build.
+SOC_FP_STRICT_BEGIN
+
+// Returns an approximation of the natural logarithm of `x` in float32
+// NOTE: Only valid for positive, normal values of `x`. The maximum error is 2 ULP compared to `std::log`.
+SOC_INLINE float32 log_fast(const float32 x) {
+  int32 bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+
+  float32 e = (float32)((int32)((uint32)bits >> 23) - 126);
+  bits      = (bits & 0x007fffff) | 0x3f000000;
+
+  float32 m;
+  std::memcpy(&m, &bits, sizeof(m));
+
+  // Move the mantissa into [sqrt(0.5) - 1, sqrt(2) - 1]
+  bool is_small = m < 0.707106781186547524f;
+  e = is_small ? e - 1.0f : e;
+  m = is_small ? (m - 1.0f) + m : m - 1.0f;
+
+  float32 z = m * m;
+  float32 y = 7.0376836292e-2f;
+  y = (y * m) + -1.1514610310e-1f;
+  y = (y * m) + 1.1676998740e-1f;
+  y = (y * m) + -1.2420140846e-1f;
+  y = (y * m) + 1.4249322787e-1f;
+  y = (y * m) + -1.6668057665e-1f;
+  y = (y * m) + 2.0000714765e-1f;
+  y = (y * m) + -2.4999993993e-1f;
+  y = (y * m) + 3.3333331174e-1f;
+  y = (y * m) * z;
+
+  y = y + (e * -2.12194440e-4f);
+  y = y - (z * 0.5f);
+
+  return (m + y) + (e * 0.693359375f);
+}
+
+// Returns an approximation of `e` raised to the power of `x` in float32
+// NOTE: The input gets clamped to [-87, 88]. The maximum error is 2 ULP compared to `std::exp`.
+SOC_INLINE float32 exp_fast(const float32 x) {
+  float32 v = x < -87.0f ? -87.0f : (x > 88.0f ? 88.0f : x);
+
+  float32 fx = std::floor((v * 1.44269504088896341f) + 0.5f);
+
+  v = v - (fx * 0.693359375f);
+  v = v - (fx * -2.12194440e-4f);
+
+  float32 z = v * v;
+  float32 y = 1.9875691500e-4f;
+  y = (y * v) + 1.3981999507e-3f;
+  y = (y * v) + 8.3334519073e-3f;
+  y = (y * v) + 4.1665795894e-2f;
+  y = (y * v) + 1.6666665459e-1f;
+  y = (y * v) + 5.0000001201e-1f;
+  y = ((y * z) + v) + 1.0f;
+
+  // Multiply by 2^fx by building the exponent directly
+  int32 bits = ((int32)fx + 127) << 23;
+  float32 pow2;
+  std::memcpy(&pow2, &bits, sizeof(pow2));
+
+  return y * pow2;
+}
+
+// Returns an approximation of `x` raised to the power of `y` in float32
+// NOTE: Only valid for positive, normal values of `x`. Since the error grows with the size of `y * log(x)`, 
+// the maximum error is about `2 + 1.5 * |y * log(x)|` ULP compared to `std::pow`.
+SOC_INLINE float32 pow_fast(const float32 x, const float32 y) {
+  return exp_fast(y * log_fast(x));
+}
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Vector2 functions
+///////////////////////////////////////////////////////////////
+
+// Returns the dot product of `v1` and `v2` 
 SOC_INLINE const float32 vec2_dot(const Vector2& v1, const Vector2& v2) {
   return (v1.x * v2.x) + (v1.y * v2.y);
 }
@@ -997,6 +1904,11 @@ SOC_INLINE const float32 vec2_length(const Vector2& v) {
   return sqrt((v.x * v.x) + (v.y * v.y));
 }
 
+// Returns the squared length/magnitude of `v`, which skips the square root of `vec2_length`
+SOC_INLINE const float32 vec2_length_squared(const Vector2& v) {
+  return (v.x * v.x) + (v.y * v.y);
+}
+
 // Returns the normalized version of the vector `v`
 SOC_INLINE const Vector2 vec2_normalize(const Vector2& v) {
   return v / vec2_length(v);
@@ -1021,6 +1933,11 @@ SOC_INLINE const float32 vec2_distance(const Vector2& v1, const Vector2& v2) {
   return vec2_length(diff);
 }
 
+// Returns the squared distance between `v1` and `v2`, which skips the square root of `vec2_distance`
+SOC_INLINE const float32 vec2_distance_squared(const Vector2& v1, const Vector2& v2) {
+  return vec2_length_squared(v2 - v1);
+}
+
 // Returns the linear interpolation between `start` and `end` by `amount` 
 SOC_INLINE const Vector2 vec2_lerp(const Vector2& start, const Vector2& end, const float32 amount) {
   return Vector2(lerp(start.x, end.x, amount), lerp(start.y, end.y, amount));
@@ -1073,11 +1990,22 @@ SOC_INLINE const float32 vec3_length(const Vector3& v) {
   return sqrt((v.x * v.x) + (v.y * v.y) + (v.z * v.z));
 }
 
+// Returns the squared length/magnitude of `v`, which skips the square root of `vec3_length`
+SOC_INLINE const float32 vec3_length_squared(const Vector3& v) {
+  return (v.x * v.x) + (v.y * v.y) + (v.z * v.z);
+}
+
 // Returns the normalized version of the vector `v`
 SOC_INLINE const Vector3 vec3_normalize(const Vector3& v) {
   return v / vec3_length(v);
 }
 
+// The same as `vec3_normalize` but uses `rsqrt_fast` instead of a square root and a division
+// NOTE: The maximum error is 6 ULP compared to `vec3_normalize` (measured on the largest component).
+SOC_INLINE const Vector3 vec3_normalize_fast(const Vector3& v) {
+  return v * rsqrt_fast((v.x * v.x) + (v.y * v.y) + (v.z * v.z));
+}
+
 // Returns the cross product of `v1` and `v2`
 SOC_INLINE const Vector3 vec3_cross(const Vector3& v1, const Vector3& v2) {
   return Vector3((v1.y * v2.z) - (v1.z * v2.y), 
@@ -1104,6 +2032,11 @@ SOC_INLINE const float32 vec3_distance(const Vector3& v1, const Vector3& v2) {
   return vec3_length(diff);
 }
 
+// Returns the squared distance between `v1` and `v2`, which skips the square root of `vec3_distance`
+SOC_INLINE const float32 vec3_distance_squared(const Vector3& v1, const Vector3& v2) {
+  return vec3_length_squared(v2 - v1);
+}
+
 // Returns the linear interpolation between `start` and `end` by `amount` 
 SOC_INLINE const Vector3 vec3_lerp(const Vector3& start, const Vector3& end, const float32 amount) {
   return Vector3(lerp(start.x, end.x, amount), lerp(start.y, end.y, amount), lerp(start.z, end.z, amount));
@@ -1156,6 +2089,11 @@ SOC_INLINE const float32 vec4_length(const Vector4& v) {
   return sqrt((v.x * v.x) + (v.y * v.y) + (v.z * v.z) + (v.w * v.w));
 }
 
+// Returns the squared length/magnitude of `v`, which skips the square root of `vec4_length`
+SOC_INLINE const float32 vec4_length_squared(const Vector4& v) {
+  return (v.x * v.x) + (v.y * v.y) + (v.z * v.z) + (v.w * v.w);
+}
+
 // Returns the normalized version of the vector `v`
 SOC_INLINE const Vector4 vec4_normalize(const Vector4& v) {
   return v / vec4_length(v);
@@ -1207,40 +2145,162 @@ SOC_INLINE const Vector4 vec4_max(const Vector4& v1, const Vector4& v2) {
 
 ///////////////////////////////////////////////////////////////
 
-// Matrix3 functions
+// Vector3A functions 
 ///////////////////////////////////////////////////////////////
 
-// Returns the determinant of the matrix `m`
-SOC_INLINE const float32 mat3_det(const Matrix3& m) {
-  return (m[0] * m[4] * m[8]) + (m[1] * m[5] * m[6]) + (m[2] * m[3] * m[7]) -
-         (m[0] * m[5] * m[7]) - (m[1] * m[3] * m[8]) - (m[2] * m[4] * m[6]);
+// NOTE: Every `vec3a_*` function works exactly like its `vec3_*` counterpart, and the SIMD paths add the components 
+// in the same order. So both give the same results within rounding. They are only bit-for-bit the same when nothing 
+// gets fused: code built with FMA (`-mfma` or `-march=native`) can fuse the multiplies and adds of either one differently.
+
+// Returns the `Vector3` version of `v`
+SOC_INLINE const Vector3 vec3a_to_vec3(const Vector3A& v) {
+  return Vector3(v.x, v.y, v.z);
 }
 
-// Returns the transposed (rows and columns switched) version of the matrix `m`
-SOC_INLINE const Matrix3 mat3_transpose(const Matrix3& m) {
-  return Matrix3(m[0], m[3], m[6], 
-                 m[1], m[4], m[7], 
-                 m[2], m[5], m[8]);
+// Returns the `Vector4` version of `v` with the given `w` component
+SOC_INLINE const Vector4 vec3a_to_vec4(const Vector3A& v, const float32 w) {
+  return Vector4(v.x, v.y, v.z, w);
 }
 
-// Returns the inverse matrix of the given `m` matrix
-SOC_INLINE const Matrix3 mat3_inverse(const Matrix3& m) {
-  Vector3 v1(m[0], m[3], m[6]); 
-  Vector3 v2(m[1], m[4], m[7]); 
-  Vector3 v3(m[2], m[5], m[8]); 
+// Returns the dot product of `v1` and `v2` 
+SOC_INLINE const float32 vec3a_dot(const Vector3A& v1, const Vector3A& v2) {
+#ifdef SOC_SIMD_SSE
+  __m128 mul = _mm_mul_ps(v1.simd, v2.simd);
+  __m128 sum = _mm_add_ss(_mm_add_ss(mul, _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(mul, mul));
 
-  Vector3 r0 = vec3_cross(v2, v3);
-  Vector3 r1 = vec3_cross(v3, v1);
-  Vector3 r2 = vec3_cross(v1, v2);
+  return _mm_cvtss_f32(sum);
+#else
+  return (v1.x * v2.x) + (v1.y * v2.y) + (v1.z * v2.z);
+#endif
+}
 
-  float32 inv_det = 1.0f / vec3_dot(r2, v3);
+// Returns the length/magnitude of `v`
+SOC_INLINE const float32 vec3a_length(const Vector3A& v) {
+  return sqrt(vec3a_dot(v, v));
+}
 
-  return Matrix3(r0.x * inv_det, r1.x * inv_det, r2.x * inv_det,
-                 r0.y * inv_det, r1.y * inv_det, r2.y * inv_det,
-                 r0.z * inv_det, r1.z * inv_det, r2.z * inv_det);
+// Returns the normalized version of the vector `v`
+SOC_INLINE const Vector3A vec3a_normalize(const Vector3A& v) {
+#ifdef SOC_SIMD_SSE
+  __m128 len = _mm_sqrt_ss(_mm_set_ss(vec3a_dot(v, v)));
+  return Vector3A(_mm_div_ps(v.simd, SOC_SIMD_SPLAT(len, 0)));
+#else
+  return v / vec3a_length(v);
+#endif
 }
 
-// Using the given `angle`, returns the rotation matrix on the X-axis
+// The same as `vec3a_normalize` but uses `rsqrt_fast` instead of a square root and a division
+// NOTE: The maximum error is 6 ULP compared to `vec3a_normalize` (measured on the largest component).
+SOC_INLINE const Vector3A vec3a_normalize_fast(const Vector3A& v) {
+  return v * rsqrt_fast(vec3a_dot(v, v));
+}
+
+// Returns the cross product of `v1` and `v2`
+SOC_INLINE const Vector3A vec3a_cross(const Vector3A& v1, const Vector3A& v2) {
+#ifdef SOC_SIMD_SSE
+  return Vector3A(simd_cross3(v1.simd, v2.simd));
+#else
+  return Vector3A((v1.y * v2.z) - (v1.z * v2.y), 
+                  (v1.z * v2.x) - (v1.x * v2.z), 
+                  (v1.x * v2.y) - (v1.y * v2.x));
+#endif
+}
+
+// Returns a vector between `min` and `max`
+SOC_INLINE const Vector3A vec3a_clamp(const Vector3A& value, const Vector3A& min, const Vector3A& max) {
+  if((value.x > max.x) && (value.y > max.y) && (value.z > max.z)) {
+    return max;
+  }
+  else if((value.x < min.x) && (value.y < min.y) && (value.z < min.z)) {
+    return min;
+  }
+  else {
+    return value;
+  }
+}
+
+// Returns the distance between `v1` and `v2` 
+SOC_INLINE const float32 vec3a_distance(const Vector3A& v1, const Vector3A& v2) {
+  return vec3a_length(v2 - v1);
+}
+
+// Returns the linear interpolation between `start` and `end` by `amount` 
+SOC_INLINE const Vector3A vec3a_lerp(const Vector3A& start, const Vector3A& end, const float32 amount) {
+  return start + ((end - start) * amount);
+}
+
+// Retruns the smallest vector between `v1` and `v2` 
+SOC_INLINE const Vector3A vec3a_min(const Vector3A& v1, const Vector3A& v2) {
+  float32 v1_sum = v1.x + v1.y + v1.z;
+  float32 v2_sum = v2.x + v2.y + v2.z;
+
+  // `v2` is the smallest vector
+  if(v1_sum > v2_sum) {
+    return v2;
+  }
+
+  return v1;
+}
+
+// Retruns the biggest vector between `v1` and `v2` 
+SOC_INLINE const Vector3A vec3a_max(const Vector3A& v1, const Vector3A& v2) {
+  float32 v1_sum = v1.x + v1.y + v1.z;
+  float32 v2_sum = v2.x + v2.y + v2.z;
+
+  // `v1` is the biggest vector
+  if(v1_sum > v2_sum) {
+    return v1;
+  }
+
+  return v2;
+}
+
+// Returns the angle in RADIANS between `point1` and `point2` 
+SOC_INLINE const float32 vec3a_angle(const Vector3A& point1, const Vector3A& point2) {
+  Vector3A diff = point2 - point1;
+  return atan2(diff.y, diff.x);
+}
+
+///////////////////////////////////////////////////////////////
+
+// Matrix3 functions
+///////////////////////////////////////////////////////////////
+
+// Returns the determinant of the matrix `m`
+SOC_INLINE const float32 mat3_det(const Matrix3& m) {
+  return (m[0] * m[4] * m[8]) + (m[1] * m[5] * m[6]) + (m[2] * m[3] * m[7]) -
+         (m[0] * m[5] * m[7]) - (m[1] * m[3] * m[8]) - (m[2] * m[4] * m[6]);
+}
+
+// Returns the transposed (rows and columns switched) version of the matrix `m`
+SOC_INLINE const Matrix3 mat3_transpose(const Matrix3& m) {
+  return Matrix3(m[0], m[3], m[6], 
+                 m[1], m[4], m[7], 
+                 m[2], m[5], m[8]);
+}
+
+// Returns the inverse matrix of the given `m` matrix
+SOC_API const Matrix3 mat3_inverse(const Matrix3& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Matrix3 mat3_inverse(const Matrix3& m) {
+  Vector3 v1(m[0], m[3], m[6]); 
+  Vector3 v2(m[1], m[4], m[7]); 
+  Vector3 v3(m[2], m[5], m[8]); 
+
+  Vector3 r0 = vec3_cross(v2, v3);
+  Vector3 r1 = vec3_cross(v3, v1);
+  Vector3 r2 = vec3_cross(v1, v2);
+
+  float32 inv_det = 1.0f / vec3_dot(r2, v3);
+
+  return Matrix3(r0.x * inv_det, r1.x * inv_det, r2.x * inv_det,
+                 r0.y * inv_det, r1.y * inv_det, r2.y * inv_det,
+                 r0.z * inv_det, r1.z * inv_det, r2.z * inv_det);
+}
+#endif
+
+// Using the given `angle`, returns the rotation matrix on the X-axis
 SOC_INLINE const Matrix3 mat3_rotate_x(const float32 angle) {
   float32 c = cos(angle);
   float32 s = sin(angle);
@@ -1273,7 +2333,10 @@ SOC_INLINE const Matrix3 mat3_rotate_z(const float32 angle) {
 // Returns rotation matrix around the given `axis` by `angle` RADIANS
 // NOTE: The given `axis` vector gets normalized inside the function so there's no 
 // need to normalize it yourself.
-SOC_INLINE const Matrix3 mat3_rotate(const Vector3& axis, const float32 angle) {
+SOC_API const Matrix3 mat3_rotate(const Vector3& axis, const float32 angle);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Matrix3 mat3_rotate(const Vector3& axis, const float32 angle) {
   float32 c = cos(angle);
   float32 s = sin(angle);
   float32 d = (1.0f - c);
@@ -1297,6 +2360,7 @@ SOC_INLINE const Matrix3 mat3_rotate(const Vector3& axis, const float32 angle) {
                  cz * norm_axis.y - s  * norm_axis.x, // 7
                  c    + cz * norm_axis.z);// 8
 }
+#endif
 
 // Returns the scale matrix on the given `axis` 
 SOC_INLINE const Matrix3 mat3_scale(const Vector3& scale) {
@@ -1358,7 +2422,10 @@ SOC_INLINE const Matrix4 mat3_to_mat4(const Matrix3& m) {
 ///////////////////////////////////////////////////////////////
 
 // Returns the determinant of the given `m` matrix
-SOC_INLINE const float32 mat4_det(const Matrix4& m) {
+SOC_API const float32 mat4_det(const Matrix4& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const float32 mat4_det(const Matrix4& m) {
   return (m[3] * m[6] * m[9]  * m[12]) - (m[2] * m[7] * m[9]  * m[12]) - 
          (m[3] * m[5] * m[10] * m[12]) + (m[1] * m[7] * m[10] * m[12]) + 
          (m[2] * m[5] * m[11] * m[12]) - (m[1] * m[6] * m[11] * m[12]) - 
@@ -1372,6 +2439,7 @@ SOC_INLINE const float32 mat4_det(const Matrix4& m) {
          (m[2] * m[4] * m[9]  * m[15]) - (m[0] * m[6] * m[9]  * m[15]) - 
          (m[1] * m[4] * m[10] * m[15]) + (m[0] * m[5] * m[10] * m[15]); 
 }
+#endif
 
 // Returns the transposed (rows and columns switched) version of the matrix `m`
 SOC_INLINE const Matrix4 mat4_transpose(const Matrix4& m) {
@@ -1382,15 +2450,20 @@ SOC_INLINE const Matrix4 mat4_transpose(const Matrix4& m) {
 }
 
 // Returns the inverse matrix of the given `m` matrix
-SOC_INLINE const Matrix4 mat4_inverse(const Matrix4& m) {
-  Vector3 a(m[0], m[4], m[8]);
-  Vector3 b(m[1], m[5], m[9]);
-  Vector3 c(m[2], m[6], m[10]);
-  Vector3 d(m[3], m[7], m[11]);
-
-  float32 x = m[12];
-  float32 y = m[13];
-  float32 z = m[14];
+// NOTE: The maximum error is 16 ULP compared to the exact inverse (measured on the largest entry) for well-conditioned matrices.
+SOC_API const Matrix4 mat4_inverse(const Matrix4& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Matrix4 mat4_inverse(const Matrix4& m) {
+  // The first three entries of each column and the last row
+  Vector3 a(m[0],  m[1],  m[2]);
+  Vector3 b(m[4],  m[5],  m[6]);
+  Vector3 c(m[8],  m[9],  m[10]);
+  Vector3 d(m[12], m[13], m[14]);
+
+  float32 x = m[3];
+  float32 y = m[7];
+  float32 z = m[11];
   float32 w = m[15];
 
   Vector3 s = vec3_cross(a, b);
@@ -1414,6 +2487,75 @@ SOC_INLINE const Matrix4 mat4_inverse(const Matrix4& m) {
                  r0.z, r1.z, r2.z, r3.z, 
                 -vec3_dot(b, t), vec3_dot(a, t), -vec3_dot(d, s), vec3_dot(c, s));
 }
+#endif
+
+// The same as `mat4_inverse` but uses SIMD when available
+// NOTE: The maximum error is 16 ULP compared to the exact inverse (measured on the largest entry) 
+// for well-conditioned matrices, which is the same bound as `mat4_inverse`. The two only differ in the last bits 
+// when the compiler fuses some of their multiplies and adds into FMA instructions.
+SOC_API const Matrix4 mat4_inverse_fast(const Matrix4& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Matrix4 mat4_inverse_fast(const Matrix4& m) {
+#ifdef SOC_SIMD_SSE
+  // Each column holds `a`, `b`, `c`, and `d` from `mat4_inverse` in the first three lanes 
+  // and `x`, `y`, `z`, and `w` in the last lane
+  __m128 a = _mm_loadu_ps(&m.data[0]);
+  __m128 b = _mm_loadu_ps(&m.data[4]);
+  __m128 c = _mm_loadu_ps(&m.data[8]);
+  __m128 d = _mm_loadu_ps(&m.data[12]);
+
+  __m128 x = SOC_SIMD_SPLAT(a, 3);
+  __m128 y = SOC_SIMD_SPLAT(b, 3);
+  __m128 z = SOC_SIMD_SPLAT(c, 3);
+  __m128 w = SOC_SIMD_SPLAT(d, 3);
+
+  __m128 s = simd_cross3(a, b);
+  __m128 t = simd_cross3(c, d);
+  __m128 u = _mm_sub_ps(_mm_mul_ps(a, y), _mm_mul_ps(b, x)); 
+  __m128 v = _mm_sub_ps(_mm_mul_ps(c, w), _mm_mul_ps(d, z)); 
+
+  // The last lanes of `u` and `v` are not part of the 3D vectors 
+  __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  u = _mm_and_ps(u, mask);
+  v = _mm_and_ps(v, mask);
+
+  __m128 det     = simd_hadd(_mm_add_ps(_mm_mul_ps(s, v), _mm_mul_ps(t, u)));
+  __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+  s = _mm_mul_ps(s, inv_det);
+  t = _mm_mul_ps(t, inv_det);
+  u = _mm_mul_ps(u, inv_det);
+  v = _mm_mul_ps(v, inv_det);
+
+  __m128 r0 = _mm_add_ps(simd_cross3(b, v), _mm_mul_ps(t, y));
+  __m128 r1 = _mm_sub_ps(simd_cross3(v, a), _mm_mul_ps(t, x));
+  __m128 r2 = _mm_add_ps(simd_cross3(d, u), _mm_mul_ps(s, w));
+  __m128 r3 = _mm_sub_ps(simd_cross3(u, c), _mm_mul_ps(s, z));
+
+  // The last row is (-dot(b, t), dot(a, t), -dot(d, s), dot(c, s))
+  __m128 bt = _mm_mul_ps(b, t);
+  __m128 at = _mm_mul_ps(a, t);
+  __m128 ds = _mm_mul_ps(d, s);
+  __m128 cs = _mm_mul_ps(c, s);
+  _MM_TRANSPOSE4_PS(bt, at, ds, cs);
+  
+  __m128 last_row = _mm_add_ps(_mm_add_ps(bt, at), ds);
+  last_row        = _mm_xor_ps(last_row, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f));
+
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+  Matrix4 result;
+  _mm_storeu_ps(&result.data[0], r0);
+  _mm_storeu_ps(&result.data[4], r1);
+  _mm_storeu_ps(&result.data[8], r2);
+  _mm_storeu_ps(&result.data[12], last_row);
+
+  return result;
+#else
+  return mat4_inverse(m);
+#endif
+}
+#endif
 
 // Returns the translation matrix using the given `position`
 // NOTE: The function uses an identity matrix (the diagonal entries of the matrix are all 1) 
@@ -1472,6 +2614,58 @@ SOC_INLINE const Matrix4 mat4_scale(const Vector3& scale) {
   return iden_mat;
 }
 
+// Returns `v` transformed by `m`, the same way a matrix gets applied in a vertex shader (`m * v`) 
+// NOTE: Unlike `operator*(Vector4, Matrix4)`, this function applies the translation in `data[12]`, `data[13]`, and `data[14]`.
+SOC_INLINE const Vector4 mat4_transform_vec4(const Matrix4& m, const Vector4& v) {
+  return Vector4((m[0] * v.x) + (m[4] * v.y) + (m[8]  * v.z) + (m[12] * v.w), 
+                 (m[1] * v.x) + (m[5] * v.y) + (m[9]  * v.z) + (m[13] * v.w), 
+                 (m[2] * v.x) + (m[6] * v.y) + (m[10] * v.z) + (m[14] * v.w), 
+                 (m[3] * v.x) + (m[7] * v.y) + (m[11] * v.z) + (m[15] * v.w));
+}
+
+// Returns the `point` transformed by `m` (the same as `mat4_transform_vec4` with a `w` of 1)
+// NOTE: There is no perspective divide.
+SOC_INLINE const Vector3 mat4_transform_point(const Matrix4& m, const Vector3& point) {
+  return Vector3((m[0] * point.x) + (m[4] * point.y) + (m[8]  * point.z) + m[12], 
+                 (m[1] * point.x) + (m[5] * point.y) + (m[9]  * point.z) + m[13], 
+                 (m[2] * point.x) + (m[6] * point.y) + (m[10] * point.z) + m[14]);
+}
+
+// Returns the `direction` transformed by `m` (the same as `mat4_transform_vec4` with a `w` of 0)
+SOC_INLINE const Vector3 mat4_transform_vector(const Matrix4& m, const Vector3& direction) {
+  return Vector3((m[0] * direction.x) + (m[4] * direction.y) + (m[8]  * direction.z), 
+                 (m[1] * direction.x) + (m[5] * direction.y) + (m[9]  * direction.z), 
+                 (m[2] * direction.x) + (m[6] * direction.y) + (m[10] * direction.z));
+}
+
+// The same as `mat4_transform_point` but for a `Vector3A`
+// NOTE: With SIMD, the whole transformation is done in a single register, with the 
+// columns of `m` loaded as they are. The result is the same as `mat4_transform_point`.
+SOC_INLINE const Vector3A mat4_transform_point3a(const Matrix4& m, const Vector3A& point) {
+#ifdef SOC_SIMD_SSE
+  __m128 res = _mm_mul_ps(_mm_loadu_ps(&m.data[0]), SOC_SIMD_SPLAT(point.simd, 0));
+  res        = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m.data[4]), SOC_SIMD_SPLAT(point.simd, 1)));
+  res        = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m.data[8]), SOC_SIMD_SPLAT(point.simd, 2)));
+
+  return Vector3A(_mm_add_ps(res, _mm_loadu_ps(&m.data[12])));
+#else
+  return Vector3A(mat4_transform_point(m, Vector3(point.x, point.y, point.z)));
+#endif
+}
+
+// The same as `mat4_transform_vector` but for a `Vector3A`
+SOC_INLINE const Vector3A mat4_transform_vector3a(const Matrix4& m, const Vector3A& direction) {
+#ifdef SOC_SIMD_SSE
+  __m128 res = _mm_mul_ps(_mm_loadu_ps(&m.data[0]), SOC_SIMD_SPLAT(direction.simd, 0));
+  res        = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m.data[4]), SOC_SIMD_SPLAT(direction.simd, 1)));
+  res        = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m.data[8]), SOC_SIMD_SPLAT(direction.simd, 2)));
+
+  return Vector3A(res);
+#else
+  return Vector3A(mat4_transform_vector(m, Vector3(direction.x, direction.y, direction.z)));
+#endif
+}
+
 // Converts the given 'm' Matrix4 to a Matrix3
 SOC_INLINE const Matrix3 mat4_to_mat3(const Matrix4& m) {
   return Matrix3(m[0], m[1], m[2], 
@@ -1523,6 +2717,89 @@ SOC_INLINE const Matrix4 mat4_look_at(const Vector3& eye, const Vector3& target,
 
 ///////////////////////////////////////////////////////////////
 
+// Matrix2x3 functions
+///////////////////////////////////////////////////////////////
+
+// Returns the determinant of the 2x2 (rotation and scale) part of the matrix `m`
+SOC_INLINE const float32 mat2x3_det(const Matrix2x3& m) {
+  return (m[0] * m[3]) - (m[2] * m[1]);
+}
+
+// Returns the inverse matrix of the given `m` matrix
+SOC_INLINE const Matrix2x3 mat2x3_inverse(const Matrix2x3& m) {
+  float32 inv_det = 1.0f / mat2x3_det(m);
+
+  float32 a =  m[3] * inv_det;
+  float32 b = -m[1] * inv_det;
+  float32 c = -m[2] * inv_det;
+  float32 d =  m[0] * inv_det;
+
+  return Matrix2x3(a, b, 
+                   c, d, 
+                   -((a * m[4]) + (c * m[5])), -((b * m[4]) + (d * m[5])));
+}
+
+// Returns the `point` transformed by `m` (the translation gets applied)
+SOC_INLINE const Vector2 mat2x3_transform_point(const Matrix2x3& m, const Vector2& point) {
+  return point * m;
+}
+
+// Returns the `direction` transformed by `m` (the translation does NOT get applied)
+SOC_INLINE const Vector2 mat2x3_transform_vector(const Matrix2x3& m, const Vector2& direction) {
+  return Vector2((direction.x * m[0]) + (direction.y * m[2]), 
+                 (direction.x * m[1]) + (direction.y * m[3]));
+}
+
+// Returns the translation matrix using the given `position`
+SOC_INLINE const Matrix2x3 mat2x3_translate(const Vector2& position) {
+  return Matrix2x3(1.0f, 0.0f, 
+                   0.0f, 1.0f, 
+                   position.x, position.y);
+}
+
+// Returns the rotation matrix by `angle` in RADIANS
+SOC_INLINE const Matrix2x3 mat2x3_rotate(const float32 angle) {
+  Vector2 sc = sincos_fast(angle);
+
+  return Matrix2x3(sc.y, sc.x, 
+                   -sc.x, sc.y, 
+                   0.0f, 0.0f);
+}
+
+// Returns the scale matrix on the given `scale`
+SOC_INLINE const Matrix2x3 mat2x3_scale(const Vector2& scale) {
+  return Matrix2x3(scale.x, 0.0f, 
+                   0.0f, scale.y, 
+                   0.0f, 0.0f);
+}
+
+// Returns the full transformation of `position`, `rotation` in RADIANS, and `scale` around the given `origin` 
+// NOTE: This is the same as `translate(position) * rotate(rotation) * scale(scale) * translate(-origin)`, 
+// just without the extra multiplications.
+SOC_INLINE const Matrix2x3 mat2x3_transform(const Vector2& position, const float32 rotation, const Vector2& scale, const Vector2& origin) {
+  Vector2 sc = sincos_fast(rotation);
+
+  float32 a =  sc.y * scale.x;
+  float32 b =  sc.x * scale.x;
+  float32 c = -sc.x * scale.y;
+  float32 d =  sc.y * scale.y;
+
+  return Matrix2x3(a, b, 
+                   c, d, 
+                   position.x - ((a * origin.x) + (c * origin.y)), 
+                   position.y - ((b * origin.x) + (d * origin.y)));
+}
+
+// Converts the given `m` Matrix2x3 into a Matrix3
+// NOTE: The last row of the final matrix is: 0.0f, 0.0f, 1.0f
+SOC_INLINE const Matrix3 mat2x3_to_mat3(const Matrix2x3& m) {
+  return Matrix3(m[0], m[1], 0.0f, 
+                 m[2], m[3], 0.0f, 
+                 m[4], m[5], 1.0f);
+}
+
+///////////////////////////////////////////////////////////////
+
 // Quaternion functions
 ///////////////////////////////////////////////////////////////
 
@@ -1550,7 +2827,10 @@ SOC_INLINE const Matrix4 quat_get_mat4(const Quaternion& q) {
 }
 
 // Sets and returns the rotation of a quaternion using the given matrix `m`
-SOC_INLINE const Quaternion quat_set_mat3(const Matrix3& m) {
+SOC_API const Quaternion quat_set_mat3(const Matrix3& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Quaternion quat_set_mat3(const Matrix3& m) {
   Quaternion q; 
 
   float32 m00 = m[0];
@@ -1593,6 +2873,42 @@ SOC_INLINE const Quaternion quat_set_mat3(const Matrix3& m) {
 
   return q;
 }
+#endif
+
+// The same as `quat_set_mat3` but picks the largest component with selects instead of branches,
+// which makes it a better fit for batches
+// NOTE: The given `m` should be a pure rotation matrix. The maximum error is 16 ULP compared 
+// to `quat_set_mat3` (measured on the largest component, ignoring the sign of the quaternion).
+SOC_INLINE const Quaternion quat_set_mat3_fast(const Matrix3& m) {
+  float32 m00 = m.data[0];
+  float32 m11 = m.data[4];
+  float32 m22 = m.data[8];
+
+  // Four times the squares of `w`, `x`, `y`, and `z`
+  float32 tw = 1.0f + m00 + m11 + m22;
+  float32 tx = 1.0f + m00 - m11 - m22;
+  float32 ty = 1.0f - m00 + m11 - m22;
+  float32 tz = 1.0f - m00 - m11 + m22;
+
+  float32 yz_diff = m.data[5] - m.data[7];
+  float32 zx_diff = m.data[6] - m.data[2];
+  float32 xy_diff = m.data[1] - m.data[3];
+  float32 yz_sum  = m.data[5] + m.data[7];
+  float32 zx_sum  = m.data[6] + m.data[2];
+  float32 xy_sum  = m.data[1] + m.data[3];
+
+  bool is_w = (tw >= tx) && (tw >= ty) && (tw >= tz);
+  bool is_x = !is_w && (tx >= ty) && (tx >= tz);
+  bool is_y = !is_w && !is_x && (ty >= tz);
+
+  float32 t = is_w ? tw : (is_x ? tx : (is_y ? ty : tz));
+  Quaternion q = is_w ? Quaternion(yz_diff, zx_diff, xy_diff, tw) : 
+                 is_x ? Quaternion(tx, xy_sum, zx_sum, yz_diff) : 
+                 is_y ? Quaternion(xy_sum, ty, yz_sum, zx_diff) : 
+                        Quaternion(zx_sum, yz_sum, tz, xy_diff);
+
+  return q * (0.5f / std::sqrt(t));
+}
 
 // Same as `quat_set_mat3` but uses a Matrix4 instead
 SOC_INLINE const Quaternion quat_set_mat4(const Matrix4& m) {
@@ -1605,6 +2921,10502 @@ SOC_INLINE const Quaternion quat_axis_angle(const Vector3& axis, const float32 a
   return Quaternion(axis * s, cos(angle * 0.5f));
 }
 
+// Returns the vector `v` rotated by the quaternion `q`, the same way a matrix gets applied in a shader (`quat_get_mat3(q) * v`, 
+// with `v` as a column vector) 
+// NOTE: Unlike `operator*(Vector3, Matrix3)`, which dots `v` with the columns and so gives the inverse rotation, 
+// this matches `m[0..2] * v.x + m[3..5] * v.y + m[6..8] * v.z` (up to rounding).
+// This uses `v + 2w(u x v) + 2u x (u x v)` (where `u` is the vector part of `q`), which is cheaper than 
+// building the whole matrix when the rotation is only used once. The quaternion `q` is assumed to be normalized. 
+// It is compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so that `quat_rotate_vec3_batch` gives the exact same results.
+SOC_FP_STRICT_BEGIN
+SOC_INLINE const Vector3 quat_rotate_vec3(const Quaternion& q, const Vector3& v) {
+  // Written out instead of using `vec3_cross`, since GCC does not always inline it and the outlined copy can fuse
+  float32 tx = ((q.y * v.z) - (q.z * v.y)) * 2.0f;
+  float32 ty = ((q.z * v.x) - (q.x * v.z)) * 2.0f;
+  float32 tz = ((q.x * v.y) - (q.y * v.x)) * 2.0f;
+
+  return Vector3(v.x + (tx * q.w) + ((q.y * tz) - (q.z * ty)), 
+                 v.y + (ty * q.w) + ((q.z * tx) - (q.x * tz)), 
+                 v.z + (tz * q.w) + ((q.x * ty) - (q.y * tx)));
+}
+SOC_FP_STRICT_END
+
+// Returns the sign of the Euler `order` and writes the indices of its axes into `out_axes` in the order they get applied 
+// NOTE: The sign is 1 when the axes are an even permutation of XYZ (`XYZ`, `YZX`, and `ZXY`) and -1 otherwise.
+SOC_INLINE const float32 euler_order_axes(const EulerOrder order, uint32* out_axes) {
+  const uint32 axes[6][3] = {
+    {0, 1, 2}, 
+    {0, 2, 1}, 
+    {1, 0, 2}, 
+    {1, 2, 0}, 
+    {2, 0, 1}, 
+    {2, 1, 0},
+  };
+
+  out_axes[0] = axes[order][0];
+  out_axes[1] = axes[order][1];
+  out_axes[2] = axes[order][2];
+
+  return (order == EULER_ORDER_XYZ || order == EULER_ORDER_YZX || order == EULER_ORDER_ZXY) ? 1.0f : -1.0f;
+}
+
+// Returns the rotation of the Euler `angles` (in RADIANS, where `angles.x` is the angle around the X axis and so on) 
+// applied in the given `order`
+// NOTE: The sines and cosines come from `sincos_fast`, so each angle needs to be within `|x| <= 16384`. 
+// It is compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so that `quat_from_euler_batch` gives the exact same results.
+SOC_FP_STRICT_BEGIN
+SOC_INLINE const Quaternion quat_from_euler(const Vector3& angles, const EulerOrder order) {
+  uint32 axes[3];
+  float32 sign = euler_order_axes(order, axes);
+
+  Vector2 first  = sincos_fast(angles.components[axes[0]] * 0.5f);
+  Vector2 second = sincos_fast(angles.components[axes[1]] * 0.5f);
+  Vector2 third  = sincos_fast(angles.components[axes[2]] * 0.5f);
+
+  // The product of the 3 axis rotations (`third * second * first`)
+  Vector3 v;
+  v.components[axes[2]] = (third.x * second.y * first.y) - sign * (third.y * second.x * first.x);
+  v.components[axes[1]] = (third.y * second.x * first.y) + sign * (third.x * second.y * first.x);
+  v.components[axes[0]] = (third.y * second.y * first.x) - sign * (third.x * second.x * first.y);
+
+  return Quaternion(v, (third.y * second.y * first.y) + sign * (third.x * second.x * first.x));
+}
+SOC_FP_STRICT_END
+
+// Returns the Euler angles (in RADIANS) of the rotation `q` when applied in the given `order`
+// NOTE: The angle of the second axis is always within `[-PI/2, PI/2]`. When it gets to `PI/2` (gimbal lock) 
+// the first and third axes line up, so the angle of the third axis is set to 0 and the first one takes the whole rotation.
+SOC_API const Vector3 quat_to_euler(const Quaternion& q, const EulerOrder order);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Vector3 quat_to_euler(const Quaternion& q, const EulerOrder order) {
+  uint32 axes[3];
+  float32 sign = euler_order_axes(order, axes);
+
+  uint32 i = axes[0];
+  uint32 j = axes[1];
+  uint32 k = axes[2];
+
+  // The matrix is column-major, so `row` and `col` is at `col * 3 + row`
+  Matrix3 m = quat_get_mat3(q);
+
+  // The cosine of the second angle comes from the other two entries of column `i` rather than from the sine, 
+  // which keeps the angle accurate close to `PI/2` (where `asin` loses most of its precision)
+  float32 sin_j = -sign * m[i * 3 + k];
+  float32 cos_j = std::hypot(m[i * 3 + i], m[i * 3 + j]);
+
+  Vector3 angles;
+  angles.components[j] = std::atan2(sin_j, cos_j);
+  angles.components[k] = cos_j > 1e-6f ? std::atan2(sign * m[i * 3 + j], m[i * 3 + i]) : 0.0f;
+
+  // The first angle is whatever is left after taking the third one out, so the angles always give back 
+  // the same rotation, even at (or close to) the gimbal lock
+  float32 sin_k = std::sin(angles.components[k]);
+  float32 cos_k = std::cos(angles.components[k]);
+  angles.components[i] = std::atan2((sin_k * m[k * 3 + i]) - (sign * cos_k * m[k * 3 + j]), 
+                                    (cos_k * m[j * 3 + j]) - (sign * sin_k * m[j * 3 + i]));
+
+  return angles;
+}
+#endif
+
+// Returns the dot product of `q1` and `q2`
+SOC_INLINE const float32 quat_dot(const Quaternion& q1, const Quaternion& q2) {
+  return (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z) + (q1.w * q2.w);
+}
+
+// Returns the length/magnitude of `q`
+SOC_INLINE const float32 quat_length(const Quaternion& q) {
+  return sqrt(quat_dot(q, q));
+}
+
+// Returns the normalized version of the quaternion `q`
+SOC_INLINE const Quaternion quat_normalize(const Quaternion& q) {
+  return q * (1.0f / quat_length(q));
+}
+
+// Returns the normalized linear interpolation between `start` and `end` by `amount`
+// NOTE: The interpolation always takes the shortest path, so `end` gets negated
+// if both quaternions are in opposite hemispheres.
+SOC_INLINE const Quaternion quat_nlerp(const Quaternion& start, const Quaternion& end, const float32 amount) {
+  float32 sign = quat_dot(start, end) < 0.0f ? -1.0f : 1.0f;
+
+  Quaternion q(lerp(start.x, end.x * sign, amount),
+               lerp(start.y, end.y * sign, amount),
+               lerp(start.z, end.z * sign, amount),
+               lerp(start.w, end.w * sign, amount));
+
+  return quat_normalize(q);
+}
+
+// Returns the spherical linear interpolation between `start` and `end` by `amount`
+// NOTE: Just like `quat_nlerp`, the interpolation always takes the shortest path.
+// The function also falls back to `quat_nlerp` when both quaternions are almost parallel.
+SOC_INLINE const Quaternion quat_slerp(const Quaternion& start, const Quaternion& end, const float32 amount) {
+  float32 cos_theta = quat_dot(start, end);
+  float32 sign      = 1.0f;
+
+  if(cos_theta < 0.0f) {
+    cos_theta = -cos_theta;
+    sign      = -1.0f;
+  }
+
+  if(cos_theta > 0.9995f) {
+    return quat_nlerp(start, end, amount);
+  }
+
+  float32 theta     = std::acos(cos_theta);
+  float32 inv_sin   = 1.0f / std::sin(theta);
+  float32 start_amt = std::sin((1.0f - amount) * theta) * inv_sin;
+  float32 end_amt   = std::sin(amount * theta) * inv_sin * sign;
+
+  return Quaternion(start.x * start_amt + end.x * end_amt,
+                    start.y * start_amt + end.y * end_amt,
+                    start.z * start_amt + end.z * end_amt,
+                    start.w * start_amt + end.w * end_amt);
+}
+
+///////////////////////////////////////////////////////////////
+
+// AABB functions
+///////////////////////////////////////////////////////////////
+
+// Returns the center point of `box`
+SOC_INLINE const Vector3 aabb_center(const AABB& box) {
+  return (box.min + box.max) * 0.5f;
+}
+
+// Returns the half size of `box` on each axis
+SOC_INLINE const Vector3 aabb_extents(const AABB& box) {
+  return (box.max - box.min) * 0.5f;
+}
+
+// Returns the smallest box that contains both `box` and `point`
+SOC_INLINE const AABB aabb_expand(const AABB& box, const Vector3& point) {
+  return AABB(Vector3(std::fmin(box.min.x, point.x), std::fmin(box.min.y, point.y), std::fmin(box.min.z, point.z)), 
+              Vector3(std::fmax(box.max.x, point.x), std::fmax(box.max.y, point.y), std::fmax(box.max.z, point.z)));
+}
+
+// Returns the smallest box that contains both `box1` and `box2`
+SOC_INLINE const AABB aabb_merge(const AABB& box1, const AABB& box2) {
+  return aabb_expand(aabb_expand(box1, box2.min), box2.max);
+}
+
+// Returns true if `point` is inside (or on the surface of) `box`
+SOC_INLINE const bool aabb_contains(const AABB& box, const Vector3& point) {
+  return point.x >= box.min.x && point.x <= box.max.x && 
+         point.y >= box.min.y && point.y <= box.max.y && 
+         point.z >= box.min.z && point.z <= box.max.z;
+}
+
+// Returns the smallest box that contains all of the `count` `points`
+// NOTE: `count` must be bigger than 0.
+SOC_INLINE const AABB aabb_from_points(const Vector3* points, const uint32 count) {
+  AABB box(points[0], points[0]);
+
+  for(uint32 i = 1; i < count; i++) {
+    box = aabb_expand(box, points[i]);
+  }
+
+  return box;
+}
+
+///////////////////////////////////////////////////////////////
+
+// Animation types
+///////////////////////////////////////////////////////////////
+
+// A keyframed animation clip with translation, rotation, and scale tracks
+//
+// The keys of every channel are stored as SoA: all the key times of every track
+// live in one array and all the key values live in another, sorted by track and then by time.
+// The `*_offsets` arrays have `tracks_count + 1` entries where the keys of track `i`
+// are in the range `[offsets[i], offsets[i + 1])`.
+//
+// NOTE: The clip does NOT own any of its memory. It only points to the arrays
+// given by the caller, so make sure they outlive the clip.
+// NOTE: Every track needs at least one key.
+struct AnimationClip {
+  float32 duration;
+  uint32 tracks_count;
+
+  const uint32* translation_offsets;
+  const float32* translation_times;
+  const Vector3* translations;
+
+  const uint32* rotation_offsets;
+  const float32* rotation_times;
+  const Quaternion* rotations;
+
+  const uint32* scale_offsets;
+  const float32* scale_times;
+  const Vector3* scales;
+};
+
+// A single playing instance of an `AnimationClip`
+//
+// The `cursors` array remembers the last key of each track that was used (`3 * tracks_count` entries
+// laid out as translation, rotation, and then scale cursors). Since playback mostly moves forward
+// by a small step each frame, finding the next key is O(1) amortized instead of a binary search.
+// NOTE: The `cursors` array is owned by the caller and should be zeroed before the first use.
+struct AnimationInstance {
+  const AnimationClip* clip;
+  uint32* cursors;
+
+  float32 time;
+  float32 speed;
+  bool is_looping;
+};
+
+// The local pose output of a sampled `AnimationInstance`
+// NOTE: Each array should have at least `tracks_count` entries.
+struct AnimationPose {
+  Vector3* translations;
+  Quaternion* rotations;
+  Vector3* scales;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Animation functions
+///////////////////////////////////////////////////////////////
+
+SOC_FP_STRICT_BEGIN
+
+// Moves `cursor` to the key in `times` (of length `count`) that is right before `time` and returns it
+// NOTE: The cursor steps backwards just like it steps forwards, so playing a clip in reverse only walks over the keys 
+// it passes.
+SOC_INLINE const uint32 anim_advance_cursor(const float32* times, const uint32 count, uint32 cursor, const float32 time) {
+  if(count < 2) {
+    return 0;
+  }
+
+  cursor = cursor > count - 2 ? count - 2 : cursor;
+
+  while(cursor > 0 && time < times[cursor]) {
+    cursor--;
+  }
+
+  while(cursor < count - 2 && times[cursor + 1] <= time) {
+    cursor++;
+  }
+
+  return cursor;
+}
+
+// Returns the interpolation amount between the keys `cursor` and `cursor + 1` at `time`
+SOC_INLINE const float32 anim_key_amount(const float32* times, const uint32 count, const uint32 cursor, const float32 time) {
+  if(count < 2) {
+    return 0.0f;
+  }
+
+  float32 start  = times[cursor];
+  float32 length = times[cursor + 1] - start;
+  float32 amount = length > 0.0f ? (time - start) / length : 0.0f;
+
+  return amount < 0.0f ? 0.0f : (amount > 1.0f ? 1.0f : amount);
+}
+
+// Creates and returns an animation instance of the given `clip` using the given `cursors`
+// NOTE: The `cursors` array must have at least `3 * clip.tracks_count` entries.
+SOC_INLINE const AnimationInstance anim_instance_create(const AnimationClip& clip, uint32* cursors) {
+  AnimationInstance inst;
+
+  inst.clip       = &clip;
+  inst.cursors    = cursors;
+  inst.time       = 0.0f;
+  inst.speed      = 1.0f;
+  inst.is_looping = true;
+
+  for(uint32 i = 0; i < clip.tracks_count * 3; i++) {
+    cursors[i] = 0;
+  }
+
+  return inst;
+}
+
+// Advances the playback time of `inst` by `delta` seconds, looping or clamping at the end of the clip
+SOC_INLINE void anim_instance_advance(AnimationInstance& inst, const float32 delta) {
+  float32 duration = inst.clip->duration;
+  inst.time += delta * inst.speed;
+
+  if(duration <= 0.0f) {
+    inst.time = 0.0f;
+  }
+  else if(inst.is_looping) {
+    inst.time = std::fmod(inst.time, duration);
+    inst.time = inst.time < 0.0f ? inst.time + duration : inst.time;
+  }
+  else {
+    inst.time = inst.time < 0.0f ? 0.0f : (inst.time > duration ? duration : inst.time);
+  }
+}
+
+// Samples every track of `inst` at its current time and writes the local pose into `pose`
+// NOTE: This function updates the cursors of `inst`.
+SOC_API void anim_sample(AnimationInstance& inst, const AnimationPose& pose);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void anim_sample(AnimationInstance& inst, const AnimationPose& pose) {
+  const AnimationClip& clip = *inst.clip;
+
+  uint32* t_cursors = inst.cursors;
+  uint32* r_cursors = inst.cursors + clip.tracks_count;
+  uint32* s_cursors = inst.cursors + clip.tracks_count * 2;
+
+  float32 time = inst.time;
+
+  for(uint32 i = 0; i < clip.tracks_count; i++) {
+    // Translation
+    uint32 begin          = clip.translation_offsets[i];
+    uint32 count          = clip.translation_offsets[i + 1] - begin;
+    const float32* times  = clip.translation_times + begin;
+    const Vector3* values = clip.translations + begin;
+
+    uint32 key   = anim_advance_cursor(times, count, t_cursors[i], time);
+    float32 amt  = anim_key_amount(times, count, key, time);
+    t_cursors[i] = key;
+
+    pose.translations[i] = count < 2 ? values[0] : vec3_lerp(values[key], values[key + 1], amt);
+
+    // Rotation
+    begin                    = clip.rotation_offsets[i];
+    count                    = clip.rotation_offsets[i + 1] - begin;
+    times                    = clip.rotation_times + begin;
+    const Quaternion* rots   = clip.rotations + begin;
+
+    key          = anim_advance_cursor(times, count, r_cursors[i], time);
+    amt          = anim_key_amount(times, count, key, time);
+    r_cursors[i] = key;
+
+    pose.rotations[i] = count < 2 ? rots[0] : quat_nlerp(rots[key], rots[key + 1], amt);
+
+    // Scale
+    begin  = clip.scale_offsets[i];
+    count  = clip.scale_offsets[i + 1] - begin;
+    times  = clip.scale_times + begin;
+    values = clip.scales + begin;
+
+    key          = anim_advance_cursor(times, count, s_cursors[i], time);
+    amt          = anim_key_amount(times, count, key, time);
+    s_cursors[i] = key;
+
+    pose.scales[i] = count < 2 ? values[0] : vec3_lerp(values[key], values[key + 1], amt);
+  }
+}
+#endif
+
+#if defined(SOC_SIMD_SSE) && !defined(SOC_DECLARE_ONLY)
+
+// Moves the cursors at `cursor_index` of the 4 `instances` along the track with the `count` key `times` 
+// (see `anim_advance_cursor`), writes them into `out_keys`, and returns the interpolation amounts at `time` 
+// (see `anim_key_amount`)
+// NOTE: The track must have at least 2 keys.
+SOC_INLINE __m128 anim_track_amounts_x4(AnimationInstance* instances, 
+                                        const float32* times, 
+                                        const uint32 count, 
+                                        const uint32 cursor_index, 
+                                        const __m128 time, 
+                                        uint32* out_keys) {
+  for(uint32 j = 0; j < 4; j++) {
+    uint32& cursor = instances[j].cursors[cursor_index];
+    cursor         = anim_advance_cursor(times, count, cursor, instances[j].time);
+    out_keys[j]    = cursor;
+  }
+
+  // Every key is right before the one after it, so each lane loads both of its times at once
+  __m128 pairs[4];
+  for(uint32 j = 0; j < 4; j++) {
+    pairs[j] = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)(times + out_keys[j])));
+  }
+
+  __m128 low    = _mm_unpacklo_ps(pairs[0], pairs[1]);
+  __m128 high   = _mm_unpacklo_ps(pairs[2], pairs[3]);
+  __m128 start  = _mm_movelh_ps(low, high);
+  __m128 end    = _mm_movehl_ps(high, low);
+  __m128 length = _mm_sub_ps(end, start);
+
+  // The same selects as `anim_key_amount` (`_mm_max_ps` and `_mm_min_ps` would not keep the NaNs)
+  __m128 zero   = _mm_setzero_ps();
+  __m128 one    = _mm_set1_ps(1.0f);
+  __m128 amount = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_div_ps(_mm_sub_ps(time, start), length));
+
+  __m128 is_over = _mm_cmpgt_ps(amount, one);
+  amount         = _mm_or_ps(_mm_and_ps(is_over, one), _mm_andnot_ps(is_over, amount));
+  return _mm_andnot_ps(_mm_cmplt_ps(amount, zero), amount);
+}
+
+// Interpolates the `values` of the 4 `keys` (and the keys right after them) by `amount` 
+// and writes them into track `track` of `out_values` of the 4 poses
+SOC_INLINE void anim_lerp_vec3_x4(const Vector3* values, const uint32* keys, const __m128 amount, Vector3* const* out_values, const uint32 track) {
+  // The 6 floats of the two keys of every lane are loaded as `x0 y0 z0 x1` and `z0 x1 y1 z1` (which never 
+  // goes past the second key), so the transposes give the components of both keys
+  __m128 start[4], end[4];
+  for(uint32 j = 0; j < 4; j++) {
+    const float32* key = values[keys[j]].components;
+
+    start[j] = _mm_loadu_ps(key);
+    end[j]   = _mm_loadu_ps(key + 2);
+  }
+  _MM_TRANSPOSE4_PS(start[0], start[1], start[2], start[3]);
+  _MM_TRANSPOSE4_PS(end[0], end[1], end[2], end[3]);
+
+  __m128 x = _mm_add_ps(start[0], _mm_mul_ps(amount, _mm_sub_ps(end[1], start[0])));
+  __m128 y = _mm_add_ps(start[1], _mm_mul_ps(amount, _mm_sub_ps(end[2], start[1])));
+  __m128 z = _mm_add_ps(start[2], _mm_mul_ps(amount, _mm_sub_ps(end[3], start[2])));
+  __m128 w = _mm_setzero_ps();
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+
+  __m128 lanes[4] = {x, y, z, w};
+  for(uint32 j = 0; j < 4; j++) {
+    float32* out = out_values[j][track].components;
+
+    _mm_storel_pi((__m64*)out, lanes[j]);
+    _mm_store_ss(out + 2, _mm_movehl_ps(lanes[j], lanes[j]));
+  }
+}
+
+// The same as `quat_nlerp` between the `rotations` of the 4 `keys` and the keys right after them, 
+// writing them into track `track` of `out_rotations` of the 4 poses
+SOC_INLINE void anim_nlerp_x4(const Quaternion* rotations, const uint32* keys, const __m128 amount, Quaternion* const* out_rotations, const uint32 track) {
+  __m128 start[4], end[4];
+  for(uint32 j = 0; j < 4; j++) {
+    start[j] = _mm_loadu_ps(&rotations[keys[j]].x);
+    end[j]   = _mm_loadu_ps(&rotations[keys[j] + 1].x);
+  }
+  _MM_TRANSPOSE4_PS(start[0], start[1], start[2], start[3]);
+  _MM_TRANSPOSE4_PS(end[0], end[1], end[2], end[3]);
+
+  __m128 dot = _mm_mul_ps(start[0], end[0]);
+  for(uint32 c = 1; c < 4; c++) {
+    dot = _mm_add_ps(dot, _mm_mul_ps(start[c], end[c]));
+  }
+
+  __m128 sign = _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f)));
+
+  __m128 q[4];
+  __m128 len2 = _mm_setzero_ps();
+  for(uint32 c = 0; c < 4; c++) {
+    q[c] = _mm_add_ps(start[c], _mm_mul_ps(amount, _mm_sub_ps(_mm_mul_ps(end[c], sign), start[c])));
+    len2 = c == 0 ? _mm_mul_ps(q[c], q[c]) : _mm_add_ps(len2, _mm_mul_ps(q[c], q[c]));
+  }
+
+  __m128 inv_len = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(len2));
+  for(uint32 c = 0; c < 4; c++) {
+    q[c] = _mm_mul_ps(q[c], inv_len);
+  }
+
+  _MM_TRANSPOSE4_PS(q[0], q[1], q[2], q[3]);
+  for(uint32 j = 0; j < 4; j++) {
+    _mm_storeu_ps(&out_rotations[j][track].x, q[j]);
+  }
+}
+
+// The same as `anim_sample` but on the 4 `instances` (which all play the same clip) at once
+SOC_INLINE void anim_sample_x4(AnimationInstance* instances, const AnimationPose* poses) {
+  const AnimationClip& clip = *instances[0].clip;
+
+  __m128 time = _mm_setr_ps(instances[0].time, instances[1].time, instances[2].time, instances[3].time);
+  uint32 keys[4];
+
+  Vector3* translations[4] = {poses[0].translations, poses[1].translations, poses[2].translations, poses[3].translations};
+  Quaternion* rotations[4] = {poses[0].rotations, poses[1].rotations, poses[2].rotations, poses[3].rotations};
+  Vector3* scales[4]       = {poses[0].scales, poses[1].scales, poses[2].scales, poses[3].scales};
+
+  // The tracks with a single key get copied as they are (just like `anim_sample`), which is the same for every instance
+  for(uint32 i = 0; i < clip.tracks_count; i++) {
+    // Translation
+    uint32 begin = clip.translation_offsets[i];
+    uint32 count = clip.translation_offsets[i + 1] - begin;
+
+    if(count < 2) {
+      for(uint32 j = 0; j < 4; j++) {
+        instances[j].cursors[i] = 0;
+        translations[j][i]      = clip.translations[begin];
+      }
+    }
+    else {
+      __m128 amount = anim_track_amounts_x4(instances, clip.translation_times + begin, count, i, time, keys);
+      anim_lerp_vec3_x4(clip.translations + begin, keys, amount, translations, i);
+    }
+
+    // Rotation
+    begin = clip.rotation_offsets[i];
+    count = clip.rotation_offsets[i + 1] - begin;
+
+    if(count < 2) {
+      for(uint32 j = 0; j < 4; j++) {
+        instances[j].cursors[clip.tracks_count + i] = 0;
+        rotations[j][i]                             = clip.rotations[begin];
+      }
+    }
+    else {
+      __m128 amount = anim_track_amounts_x4(instances, clip.rotation_times + begin, count, clip.tracks_count + i, time, keys);
+      anim_nlerp_x4(clip.rotations + begin, keys, amount, rotations, i);
+    }
+
+    // Scale
+    begin = clip.scale_offsets[i];
+    count = clip.scale_offsets[i + 1] - begin;
+
+    if(count < 2) {
+      for(uint32 j = 0; j < 4; j++) {
+        instances[j].cursors[(clip.tracks_count * 2) + i] = 0;
+        scales[j][i]                                      = clip.scales[begin];
+      }
+    }
+    else {
+      __m128 amount = anim_track_amounts_x4(instances, clip.scale_times + begin, count, (clip.tracks_count * 2) + i, time, keys);
+      anim_lerp_vec3_x4(clip.scales + begin, keys, amount, scales, i);
+    }
+  }
+}
+
+#endif
+
+// Advances every instance in `instances` by `delta` seconds and samples it into the matching pose in `poses`
+// NOTE: Every 4 instances in a row that play the same clip get sampled at once, with their keys gathered into SIMD 
+// registers, so keep the instances of every clip next to each other. The other instances get sampled one at a time. 
+// The animation functions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so the poses are 
+// the exact same as the ones `anim_sample` gives in every build. Both `instances` and `poses` should have 
+// at least `count` entries.
+SOC_API void anim_sample_batch(AnimationInstance* instances, const AnimationPose* poses, const uint32 count, const float32 delta);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void anim_sample_batch(AnimationInstance* instances, const AnimationPose* poses, const uint32 count, const float32 delta) {
+  uint32 i = 0;
+
+  while(i < count) {
+#ifdef SOC_SIMD_SSE
+    if(i + 4 <= count && 
+       instances[i + 1].clip == instances[i].clip && 
+       instances[i + 2].clip == instances[i].clip && 
+       instances[i + 3].clip == instances[i].clip) {
+      for(uint32 j = i; j < i + 4; j++) {
+        anim_instance_advance(instances[j], delta);
+      }
+
+      anim_sample_x4(instances + i, poses + i);
+      i += 4;
+      continue;
+    }
+#endif
+
+    anim_instance_advance(instances[i], delta);
+    anim_sample(instances[i], poses[i]);
+    i++;
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Sprite types
+///////////////////////////////////////////////////////////////
+
+// A single vertex of a sprite quad
+struct SpriteVertex {
+  Vector2 position;
+  Vector2 uv;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Sprite functions
+///////////////////////////////////////////////////////////////
+
+SOC_FP_STRICT_BEGIN
+
+// Generates the 4 vertices of `count` sprites into `out_vertices` 
+//
+// Each sprite is a unit quad that gets moved by `-origins[i]`, scaled by `scales[i]`, rotated by `rotations[i]` RADIANS, 
+// and then moved to `positions[i]` (the same as `mat2x3_transform`). The vertices are written in the order 
+// top-left, top-right, bottom-right, and bottom-left (in local space), with the UVs taken from `uv_rects[i]` 
+// as `(u_min, v_min, u_max, v_max)`. 
+//
+// NOTE: `out_vertices` must have at least `4 * count` entries.
+// NOTE: `uv_rects` can be `nullptr`, in which case every sprite uses the full texture.
+// NOTE: Four sprites are generated at once when SIMD is available. Both code paths give the exact same results 
+// in every build, since they are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`).
+SOC_API void sprite_generate_vertices(const Vector2* positions, 
+                                      const float32* rotations, 
+                                      const Vector2* scales, 
+                                      const Vector2* origins, 
+                                      const Vector4* uv_rects, 
+                                      const uint32 count, 
+                                      SpriteVertex* out_vertices);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void sprite_generate_vertices(const Vector2* positions, 
+                                      const float32* rotations, 
+                                      const Vector2* scales, 
+                                      const Vector2* origins, 
+                                      const Vector4* uv_rects, 
+                                      const uint32 count, 
+                                      SpriteVertex* out_vertices) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    const float32* pos = positions[i].components;
+    const float32* scl = scales[i].components;
+    const float32* org = origins[i].components;
+    
+    // De-interleave the `Vector2`s into `x` and `y` registers
+    __m128 pos_a = _mm_loadu_ps(pos);
+    __m128 pos_b = _mm_loadu_ps(pos + 4);
+    __m128 pos_x = _mm_shuffle_ps(pos_a, pos_b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 pos_y = _mm_shuffle_ps(pos_a, pos_b, _MM_SHUFFLE(3, 1, 3, 1));
+    
+    __m128 scl_a = _mm_loadu_ps(scl);
+    __m128 scl_b = _mm_loadu_ps(scl + 4);
+    __m128 scl_x = _mm_shuffle_ps(scl_a, scl_b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 scl_y = _mm_shuffle_ps(scl_a, scl_b, _MM_SHUFFLE(3, 1, 3, 1));
+    
+    __m128 org_a = _mm_loadu_ps(org);
+    __m128 org_b = _mm_loadu_ps(org + 4);
+    __m128 org_x = _mm_shuffle_ps(org_a, org_b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 org_y = _mm_shuffle_ps(org_a, org_b, _MM_SHUFFLE(3, 1, 3, 1));
+
+    __m128 sin, cos;
+    simd_sincos(_mm_loadu_ps(&rotations[i]), &sin, &cos);
+
+    // The local edges of the quad 
+    __m128 left   = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), org_x), scl_x);
+    __m128 right  = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), org_x), scl_x);
+    __m128 top    = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), org_y), scl_y);
+    __m128 bottom = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), org_y), scl_y);
+
+    __m128 left_cos   = _mm_mul_ps(left, cos);
+    __m128 left_sin   = _mm_mul_ps(left, sin);
+    __m128 right_cos  = _mm_mul_ps(right, cos);
+    __m128 right_sin  = _mm_mul_ps(right, sin);
+    __m128 top_cos    = _mm_mul_ps(top, cos);
+    __m128 top_sin    = _mm_mul_ps(top, sin);
+    __m128 bottom_cos = _mm_mul_ps(bottom, cos);
+    __m128 bottom_sin = _mm_mul_ps(bottom, sin);
+
+    __m128 corners_x[4] = {
+      _mm_add_ps(pos_x, _mm_sub_ps(left_cos, top_sin)), 
+      _mm_add_ps(pos_x, _mm_sub_ps(right_cos, top_sin)), 
+      _mm_add_ps(pos_x, _mm_sub_ps(right_cos, bottom_sin)), 
+      _mm_add_ps(pos_x, _mm_sub_ps(left_cos, bottom_sin)), 
+    };
+    
+    __m128 corners_y[4] = {
+      _mm_add_ps(pos_y, _mm_add_ps(left_sin, top_cos)), 
+      _mm_add_ps(pos_y, _mm_add_ps(right_sin, top_cos)), 
+      _mm_add_ps(pos_y, _mm_add_ps(right_sin, bottom_cos)), 
+      _mm_add_ps(pos_y, _mm_add_ps(left_sin, bottom_cos)), 
+    };
+
+    // UV rects as `u_min`, `v_min`, `u_max`, and `v_max` registers
+    __m128 u_min = _mm_setzero_ps();
+    __m128 v_min = _mm_setzero_ps();
+    __m128 u_max = _mm_set1_ps(1.0f);
+    __m128 v_max = _mm_set1_ps(1.0f);
+    if(uv_rects) {
+      u_min = _mm_loadu_ps(uv_rects[i + 0].components);
+      v_min = _mm_loadu_ps(uv_rects[i + 1].components);
+      u_max = _mm_loadu_ps(uv_rects[i + 2].components);
+      v_max = _mm_loadu_ps(uv_rects[i + 3].components);
+      _MM_TRANSPOSE4_PS(u_min, v_min, u_max, v_max);
+    }
+
+    __m128 corners_u[4] = {u_min, u_max, u_max, u_min};
+    __m128 corners_v[4] = {v_min, v_min, v_max, v_max};
+
+    // Transpose each corner back into one `SpriteVertex` per sprite
+    float32* out = out_vertices[i * 4].position.components;
+    for(uint32 corner = 0; corner < 4; corner++) {
+      __m128 x = corners_x[corner];
+      __m128 y = corners_y[corner];
+      __m128 u = corners_u[corner];
+      __m128 v = corners_v[corner];
+      _MM_TRANSPOSE4_PS(x, y, u, v);
+
+      _mm_storeu_ps(out + (0 * 16) + (corner * 4), x);
+      _mm_storeu_ps(out + (1 * 16) + (corner * 4), y);
+      _mm_storeu_ps(out + (2 * 16) + (corner * 4), u);
+      _mm_storeu_ps(out + (3 * 16) + (corner * 4), v);
+    }
+  }
+#endif
+
+  for(; i < count; i++) {
+    Vector2 sc = sincos_fast(rotations[i]);
+
+    float32 left   = (0.0f - origins[i].x) * scales[i].x;
+    float32 right  = (1.0f - origins[i].x) * scales[i].x;
+    float32 top    = (0.0f - origins[i].y) * scales[i].y;
+    float32 bottom = (1.0f - origins[i].y) * scales[i].y;
+
+    Vector4 uv = uv_rects ? uv_rects[i] : Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    SpriteVertex* out = &out_vertices[i * 4];
+
+    out[0].position = positions[i] + Vector2((left * sc.y) - (top * sc.x), (left * sc.x) + (top * sc.y));
+    out[1].position = positions[i] + Vector2((right * sc.y) - (top * sc.x), (right * sc.x) + (top * sc.y));
+    out[2].position = positions[i] + Vector2((right * sc.y) - (bottom * sc.x), (right * sc.x) + (bottom * sc.y));
+    out[3].position = positions[i] + Vector2((left * sc.y) - (bottom * sc.x), (left * sc.x) + (bottom * sc.y));
+
+    out[0].uv = Vector2(uv.x, uv.y);
+    out[1].uv = Vector2(uv.z, uv.y);
+    out[2].uv = Vector2(uv.z, uv.w);
+    out[3].uv = Vector2(uv.x, uv.w);
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Color functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: All of the color functions work on the `r`, `g`, `b`, and `a` components of `Vector3` and `Vector4`. 
+// The batch versions take either RGB `Vector3`s or RGBA `Vector4`s, and never touch the alpha (unless stated otherwise).
+// Every SIMD batch function gives the exact same results as its scalar version, in every build, since the color
+// functions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`).
+
+SOC_FP_STRICT_BEGIN
+
+// The Rec. 709 (sRGB) luminance weights of linear RGB
+#define SOC_LUMINANCE_R 0.2126f
+#define SOC_LUMINANCE_G 0.7152f
+#define SOC_LUMINANCE_B 0.0722f
+
+// Converts one sRGB encoded channel `c` into linear space
+// NOTE: The maximum error is 16 ULP compared to the exact transfer function (see `pow_fast`).
+SOC_INLINE float32 color_srgb_to_linear_channel(const float32 c) {
+  float32 curve = pow_fast((c + 0.055f) * (1.0f / 1.055f), 2.4f);
+  return c <= 0.04045f ? c * (1.0f / 12.92f) : curve;
+}
+
+// Converts one linear channel `c` into sRGB space
+// NOTE: The maximum error is 12 ULP compared to the exact transfer function (see `pow_fast`).
+SOC_INLINE float32 color_linear_to_srgb_channel(const float32 c) {
+  float32 curve = (1.055f * pow_fast(c, 1.0f / 2.4f)) - 0.055f;
+  return c <= 0.0031308f ? c * 12.92f : curve;
+}
+
+// Returns the sRGB encoded `color` converted into linear space
+SOC_INLINE const Vector3 color_srgb_to_linear(const Vector3& color) {
+  return Vector3(color_srgb_to_linear_channel(color.r), 
+                 color_srgb_to_linear_channel(color.g), 
+                 color_srgb_to_linear_channel(color.b));
+}
+
+// Returns the linear `color` converted into sRGB space
+SOC_INLINE const Vector3 color_linear_to_srgb(const Vector3& color) {
+  return Vector3(color_linear_to_srgb_channel(color.r), 
+                 color_linear_to_srgb_channel(color.g), 
+                 color_linear_to_srgb_channel(color.b));
+}
+
+// Returns the RGB `color` converted into HSV, where the hue, saturation, and value are all in [0, 1]
+SOC_INLINE const Vector3 color_rgb_to_hsv(const Vector3& color) {
+  // Branchless selects so that the batch version gives the same results
+  bool g_less   = color.g < color.b;
+  Vector4 p     = g_less ? Vector4(color.b, color.g, -1.0f, 2.0f / 3.0f) : Vector4(color.g, color.b, 0.0f, -1.0f / 3.0f);
+  bool r_less   = color.r < p.x;
+  Vector4 q     = r_less ? Vector4(p.x, p.y, p.w, color.r) : Vector4(color.r, p.y, p.z, p.x);
+
+  float32 d = q.x - (q.w < q.y ? q.w : q.y);
+  float32 h = std::fabs(q.z + (q.w - q.y) / ((6.0f * d) + 1e-10f));
+  float32 s = d / (q.x + 1e-10f);
+
+  return Vector3(h, s, q.x);
+}
+
+// Returns the HSV `color` (with every component in [0, 1]) converted into RGB
+SOC_INLINE const Vector3 color_hsv_to_rgb(const Vector3& color) {
+  Vector3 k(1.0f, 2.0f / 3.0f, 1.0f / 3.0f);
+  Vector3 rgb;
+
+  for(uint32 i = 0; i < 3; i++) {
+    float32 h = color.x + k.components[i];
+    float32 p = std::fabs(((h - (float32)(int32)h) * 6.0f) - 3.0f) - 1.0f;
+    p         = p < 0.0f ? 0.0f : (p > 1.0f ? 1.0f : p);
+
+    rgb.components[i] = color.z * (1.0f + (color.y * (p - 1.0f)));
+  }
+
+  return rgb;
+}
+
+// Returns the relative luminance of the linear `color` 
+SOC_INLINE const float32 color_luminance(const Vector3& color) {
+  return ((color.r * SOC_LUMINANCE_R) + (color.g * SOC_LUMINANCE_G)) + (color.b * SOC_LUMINANCE_B);
+}
+
+// Returns the `color` with its RGB multiplied by its alpha 
+SOC_INLINE const Vector4 color_premultiply(const Vector4& color) {
+  return Vector4(color.r * color.a, color.g * color.a, color.b * color.a, color.a);
+}
+
+// Returns the `color` packed into 8 bits per channel, with the `r` channel in the lowest byte 
+// NOTE: The channels get clamped to [0, 1] (with NaNs going to 0) and rounded to the nearest value.
+SOC_INLINE const uint32 color_pack_unorm8(const Vector4& color) {
+  uint32 packed = 0;
+
+  for(uint32 i = 0; i < 4; i++) {
+    float32 c = color.components[i];
+    c         = c > 0.0f ? (c < 1.0f ? c : 1.0f) : 0.0f;
+
+    packed |= (uint32)std::nearbyint(c * 255.0f) << (i * 8);
+  }
+
+  return packed;
+}
+
+// Returns the 8 bits per channel `packed` color (with the `r` channel in the lowest byte) as floats in [0, 1]
+SOC_INLINE const Vector4 color_unpack_unorm8(const uint32 packed) {
+  return Vector4((float32)((packed >> 0)  & 0xff) * (1.0f / 255.0f), 
+                 (float32)((packed >> 8)  & 0xff) * (1.0f / 255.0f), 
+                 (float32)((packed >> 16) & 0xff) * (1.0f / 255.0f), 
+                 (float32)((packed >> 24) & 0xff) * (1.0f / 255.0f));
+}
+
+// Returns the lookup table of every 8-bit sRGB value converted into linear space
+// NOTE: The table gets computed (exactly) the first time it's needed.
+SOC_INLINE const float32* color_srgb8_table() {
+  struct Table {
+    float32 values[256];
+
+    Table() {
+      for(uint32 i = 0; i < 256; i++) {
+        float64 c = (float64)i / 255.0;
+        values[i] = (float32)(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+      }
+    }
+  };
+
+  static const Table table;
+  return table.values;
+}
+
+#if defined(SOC_SIMD_SSE) && !defined(SOC_DECLARE_ONLY)
+
+// Loads the 4 `colors` into the `r`, `g`, `b`, and `a` registers (from AoS to SoA)
+SOC_INLINE void simd_load_rgba(const Vector4* colors, __m128* r, __m128* g, __m128* b, __m128* a) {
+  *r = _mm_loadu_ps(colors[0].components);
+  *g = _mm_loadu_ps(colors[1].components);
+  *b = _mm_loadu_ps(colors[2].components);
+  *a = _mm_loadu_ps(colors[3].components);
+  _MM_TRANSPOSE4_PS(*r, *g, *b, *a);
+}
+
+// Stores the `r`, `g`, `b`, and `a` registers into the 4 `out` colors (from SoA to AoS)
+SOC_INLINE void simd_store_rgba(__m128 r, __m128 g, __m128 b, __m128 a, Vector4* out) {
+  _MM_TRANSPOSE4_PS(r, g, b, a);
+  _mm_storeu_ps(out[0].components, r);
+  _mm_storeu_ps(out[1].components, g);
+  _mm_storeu_ps(out[2].components, b);
+  _mm_storeu_ps(out[3].components, a);
+}
+
+// The same as `color_srgb_to_linear_channel` but on 4 channels
+SOC_INLINE __m128 simd_srgb_to_linear(const __m128 c) {
+  __m128 curve = simd_pow(_mm_mul_ps(_mm_add_ps(c, _mm_set1_ps(0.055f)), _mm_set1_ps(1.0f / 1.055f)), _mm_set1_ps(2.4f));
+  __m128 lin   = _mm_mul_ps(c, _mm_set1_ps(1.0f / 12.92f));
+
+  __m128 is_lin = _mm_cmple_ps(c, _mm_set1_ps(0.04045f));
+  return _mm_or_ps(_mm_and_ps(is_lin, lin), _mm_andnot_ps(is_lin, curve));
+}
+
+// The same as `color_linear_to_srgb_channel` but on 4 channels
+SOC_INLINE __m128 simd_linear_to_srgb(const __m128 c) {
+  __m128 curve = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.055f), simd_pow(c, _mm_set1_ps(1.0f / 2.4f))), _mm_set1_ps(0.055f));
+  __m128 lin   = _mm_mul_ps(c, _mm_set1_ps(12.92f));
+
+  __m128 is_lin = _mm_cmple_ps(c, _mm_set1_ps(0.0031308f));
+  return _mm_or_ps(_mm_and_ps(is_lin, lin), _mm_andnot_ps(is_lin, curve));
+}
+
+// The same as `color_rgb_to_hsv` but on 4 colors (the `rgb` registers get replaced with HSV)
+SOC_INLINE void simd_rgb_to_hsv(__m128* rgb) {
+  __m128 r = rgb[0];
+  __m128 g = rgb[1];
+  __m128 b = rgb[2];
+
+  __m128 g_less = _mm_cmplt_ps(g, b);
+  __m128 px     = _mm_or_ps(_mm_and_ps(g_less, b), _mm_andnot_ps(g_less, g));
+  __m128 py     = _mm_or_ps(_mm_and_ps(g_less, g), _mm_andnot_ps(g_less, b));
+  __m128 pz     = _mm_or_ps(_mm_and_ps(g_less, _mm_set1_ps(-1.0f)), _mm_andnot_ps(g_less, _mm_setzero_ps()));
+  __m128 pw     = _mm_or_ps(_mm_and_ps(g_less, _mm_set1_ps(2.0f / 3.0f)), _mm_andnot_ps(g_less, _mm_set1_ps(-1.0f / 3.0f)));
+
+  __m128 r_less = _mm_cmplt_ps(r, px);
+  __m128 qx     = _mm_or_ps(_mm_and_ps(r_less, px), _mm_andnot_ps(r_less, r));
+  __m128 qy     = py;
+  __m128 qz     = _mm_or_ps(_mm_and_ps(r_less, pw), _mm_andnot_ps(r_less, pz));
+  __m128 qw     = _mm_or_ps(_mm_and_ps(r_less, r), _mm_andnot_ps(r_less, px));
+
+  __m128 w_less = _mm_cmplt_ps(qw, qy);
+  __m128 d      = _mm_sub_ps(qx, _mm_or_ps(_mm_and_ps(w_less, qw), _mm_andnot_ps(w_less, qy)));
+
+  __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  __m128 h = _mm_add_ps(qz, _mm_div_ps(_mm_sub_ps(qw, qy), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(6.0f), d), _mm_set1_ps(1e-10f))));
+
+  rgb[0] = _mm_and_ps(h, abs_mask);
+  rgb[1] = _mm_div_ps(d, _mm_add_ps(qx, _mm_set1_ps(1e-10f)));
+  rgb[2] = qx;
+}
+
+// The same as `color_hsv_to_rgb` but on 4 colors (the `hsv` registers get replaced with RGB)
+SOC_INLINE void simd_hsv_to_rgb(__m128* hsv) {
+  __m128 k[3]     = {_mm_set1_ps(1.0f), _mm_set1_ps(2.0f / 3.0f), _mm_set1_ps(1.0f / 3.0f)};
+  __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+  __m128 h = hsv[0];
+  __m128 s = hsv[1];
+  __m128 v = hsv[2];
+
+  for(uint32 j = 0; j < 3; j++) {
+    __m128 hk   = _mm_add_ps(h, k[j]);
+    __m128 frac = _mm_sub_ps(hk, _mm_cvtepi32_ps(_mm_cvttps_epi32(hk)));
+    __m128 p    = _mm_sub_ps(_mm_and_ps(_mm_sub_ps(_mm_mul_ps(frac, _mm_set1_ps(6.0f)), _mm_set1_ps(3.0f)), abs_mask), _mm_set1_ps(1.0f));
+    p           = _mm_min_ps(_mm_max_ps(p, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+    hsv[j] = _mm_mul_ps(v, _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(s, _mm_sub_ps(p, _mm_set1_ps(1.0f)))));
+  }
+}
+
+// The same as `color_luminance` but on 4 colors
+SOC_INLINE __m128 simd_luminance(const __m128 r, const __m128 g, const __m128 b) {
+  __m128 lum = _mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(SOC_LUMINANCE_R)), _mm_mul_ps(g, _mm_set1_ps(SOC_LUMINANCE_G)));
+  return _mm_add_ps(lum, _mm_mul_ps(b, _mm_set1_ps(SOC_LUMINANCE_B)));
+}
+
+#endif
+
+// Converts `count` sRGB encoded `colors` into linear space and writes them into `out`
+// NOTE: Converts 4 colors at a time with only their RGB channels in the SIMD registers, so the alpha is never touched.
+SOC_API void color_srgb_to_linear_batch(const Vector4* colors, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_srgb_to_linear_batch(const Vector4* colors, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b, a;
+    simd_load_rgba(colors + i, &r, &g, &b, &a);
+    simd_store_rgba(simd_srgb_to_linear(r), simd_srgb_to_linear(g), simd_srgb_to_linear(b), a, out + i);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = Vector4(color_srgb_to_linear(Vector3(colors[i].r, colors[i].g, colors[i].b)), colors[i].a);
+  }
+}
+#endif
+
+// Converts `count` sRGB encoded RGB `colors` into linear space and writes them into `out`
+SOC_API void color_srgb_to_linear_batch(const Vector3* colors, const uint32 count, Vector3* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_srgb_to_linear_batch(const Vector3* colors, const uint32 count, Vector3* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b;
+    simd_load_vec3(colors[i].components, &r, &g, &b);
+    simd_store_vec3(simd_srgb_to_linear(r), simd_srgb_to_linear(g), simd_srgb_to_linear(b), out[i].components);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_srgb_to_linear(colors[i]);
+  }
+}
+#endif
+
+// Converts `count` linear `colors` into sRGB space and writes them into `out`
+// NOTE: Converts 4 colors at a time with only their RGB channels in the SIMD registers, so the alpha is never touched.
+SOC_API void color_linear_to_srgb_batch(const Vector4* colors, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_linear_to_srgb_batch(const Vector4* colors, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b, a;
+    simd_load_rgba(colors + i, &r, &g, &b, &a);
+    simd_store_rgba(simd_linear_to_srgb(r), simd_linear_to_srgb(g), simd_linear_to_srgb(b), a, out + i);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = Vector4(color_linear_to_srgb(Vector3(colors[i].r, colors[i].g, colors[i].b)), colors[i].a);
+  }
+}
+#endif
+
+// Converts `count` linear RGB `colors` into sRGB space and writes them into `out`
+SOC_API void color_linear_to_srgb_batch(const Vector3* colors, const uint32 count, Vector3* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_linear_to_srgb_batch(const Vector3* colors, const uint32 count, Vector3* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b;
+    simd_load_vec3(colors[i].components, &r, &g, &b);
+    simd_store_vec3(simd_linear_to_srgb(r), simd_linear_to_srgb(g), simd_linear_to_srgb(b), out[i].components);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_linear_to_srgb(colors[i]);
+  }
+}
+#endif
+
+// Converts `count` RGB `colors` into HSV and writes them into `out`
+SOC_API void color_rgb_to_hsv_batch(const Vector4* colors, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_rgb_to_hsv_batch(const Vector4* colors, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 c[3], a;
+    simd_load_rgba(colors + i, &c[0], &c[1], &c[2], &a);
+    simd_rgb_to_hsv(c);
+    simd_store_rgba(c[0], c[1], c[2], a, out + i);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = Vector4(color_rgb_to_hsv(Vector3(colors[i].r, colors[i].g, colors[i].b)), colors[i].a);
+  }
+}
+#endif
+
+// Converts `count` RGB `colors` into HSV and writes them into `out`
+SOC_API void color_rgb_to_hsv_batch(const Vector3* colors, const uint32 count, Vector3* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_rgb_to_hsv_batch(const Vector3* colors, const uint32 count, Vector3* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 c[3];
+    simd_load_vec3(colors[i].components, &c[0], &c[1], &c[2]);
+    simd_rgb_to_hsv(c);
+    simd_store_vec3(c[0], c[1], c[2], out[i].components);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_rgb_to_hsv(colors[i]);
+  }
+}
+#endif
+
+// Converts `count` HSV `colors` into RGB and writes them into `out`
+SOC_API void color_hsv_to_rgb_batch(const Vector4* colors, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_hsv_to_rgb_batch(const Vector4* colors, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 c[3], a;
+    simd_load_rgba(colors + i, &c[0], &c[1], &c[2], &a);
+    simd_hsv_to_rgb(c);
+    simd_store_rgba(c[0], c[1], c[2], a, out + i);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = Vector4(color_hsv_to_rgb(Vector3(colors[i].r, colors[i].g, colors[i].b)), colors[i].a);
+  }
+}
+#endif
+
+// Converts `count` HSV `colors` into RGB and writes them into `out`
+SOC_API void color_hsv_to_rgb_batch(const Vector3* colors, const uint32 count, Vector3* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_hsv_to_rgb_batch(const Vector3* colors, const uint32 count, Vector3* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 c[3];
+    simd_load_vec3(colors[i].components, &c[0], &c[1], &c[2]);
+    simd_hsv_to_rgb(c);
+    simd_store_vec3(c[0], c[1], c[2], out[i].components);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_hsv_to_rgb(colors[i]);
+  }
+}
+#endif
+
+// Computes the luminance of `count` linear `colors` and writes them into `out`
+SOC_API void color_luminance_batch(const Vector4* colors, const uint32 count, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_luminance_batch(const Vector4* colors, const uint32 count, float32* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b, a;
+    simd_load_rgba(colors + i, &r, &g, &b, &a);
+    _mm_storeu_ps(&out[i], simd_luminance(r, g, b));
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_luminance(Vector3(colors[i].r, colors[i].g, colors[i].b));
+  }
+}
+#endif
+
+// Computes the luminance of `count` linear RGB `colors` and writes them into `out`
+SOC_API void color_luminance_batch(const Vector3* colors, const uint32 count, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_luminance_batch(const Vector3* colors, const uint32 count, float32* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= count; i += 4) {
+    __m128 r, g, b;
+    simd_load_vec3(colors[i].components, &r, &g, &b);
+    _mm_storeu_ps(&out[i], simd_luminance(r, g, b));
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_luminance(colors[i]);
+  }
+}
+#endif
+
+// Premultiplies `count` `colors` by their alpha and writes them into `out`
+SOC_API void color_premultiply_batch(const Vector4* colors, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_premultiply_batch(const Vector4* colors, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 rgb_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+  for(; i < count; i++) {
+    __m128 c     = _mm_loadu_ps(colors[i].components);
+    __m128 alpha = SOC_SIMD_SPLAT(c, 3);
+
+    // Only the RGB gets multiplied, so the alpha goes through untouched (even when it's infinite or NaN)
+    __m128 rgb = _mm_and_ps(_mm_mul_ps(c, alpha), rgb_mask);
+    _mm_storeu_ps(out[i].components, _mm_or_ps(rgb, _mm_andnot_ps(rgb_mask, c)));
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_premultiply(colors[i]);
+  }
+}
+#endif
+
+// Packs `count` `colors` into 8 bits per channel (see `color_pack_unorm8`) and writes them into `out`
+SOC_API void color_pack_unorm8_batch(const Vector4* colors, const uint32 count, uint32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_pack_unorm8_batch(const Vector4* colors, const uint32 count, uint32* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 zero  = _mm_setzero_ps();
+  __m128 one   = _mm_set1_ps(1.0f);
+  __m128 scale = _mm_set1_ps(255.0f);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128i c0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(colors[i + 0].components), zero), one), scale));
+    __m128i c1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(colors[i + 1].components), zero), one), scale));
+    __m128i c2 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(colors[i + 2].components), zero), one), scale));
+    __m128i c3 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(colors[i + 3].components), zero), one), scale));
+
+    __m128i packed = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+    _mm_storeu_si128((__m128i*)&out[i], packed);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_pack_unorm8(colors[i]);
+  }
+}
+#endif
+
+// Unpacks `count` 8 bits per channel `packed` colors (see `color_unpack_unorm8`) and writes them into `out`
+SOC_API void color_unpack_unorm8_batch(const uint32* packed, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_unpack_unorm8_batch(const uint32* packed, const uint32 count, Vector4* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128i zero = _mm_setzero_si128();
+  __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128i bytes = _mm_loadu_si128((const __m128i*)&packed[i]);
+    __m128i lo    = _mm_unpacklo_epi8(bytes, zero);
+    __m128i hi    = _mm_unpackhi_epi8(bytes, zero);
+
+    _mm_storeu_ps(out[i + 0].components, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+    _mm_storeu_ps(out[i + 1].components, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+    _mm_storeu_ps(out[i + 2].components, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+    _mm_storeu_ps(out[i + 3].components, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+  }
+#endif
+
+  for(; i < count; i++) {
+    out[i] = color_unpack_unorm8(packed[i]);
+  }
+}
+#endif
+
+// Unpacks `count` 8 bits per channel sRGB `packed` colors straight into linear space and writes them into `out`
+// NOTE: Uses an exact lookup table for the RGB channels. The alpha is only unpacked.
+SOC_API void color_srgb8_to_linear_batch(const uint32* packed, const uint32 count, Vector4* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void color_srgb8_to_linear_batch(const uint32* packed, const uint32 count, Vector4* out) {
+  const float32* table = color_srgb8_table();
+
+  for(uint32 i = 0; i < count; i++) {
+    uint32 c = packed[i];
+    out[i]   = Vector4(table[(c >> 0)  & 0xff], 
+                       table[(c >> 8)  & 0xff], 
+                       table[(c >> 16) & 0xff], 
+                       (float32)((c >> 24) & 0xff) * (1.0f / 255.0f));
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Strided view types
+///////////////////////////////////////////////////////////////
+
+// NOTE: The strided views point to vectors that live inside bigger structs, like the positions or the normals 
+// of an interleaved vertex buffer. `data` points to the first vector, and `stride` is the number of bytes between 
+// two consecutive vectors (`sizeof` the vertex struct). The views do NOT own any of their memory.
+
+// A strided view over `Vector2`s
+struct Vector2View {
+  uint8* data;
+  uint32 stride; 
+  uint32 count;
+
+  // Takes the address of the first vector, the stride in bytes, and the number of vectors
+  Vector2View(void* data, const uint32 stride, const uint32 count) 
+    :data((uint8*)data), stride(stride), count(count)
+  {}
+
+  // Returns the vector at `index` 
+  // NOTE: Does NOT check for out of bounds indices.
+  Vector2& operator[](const uint32 index) const {
+    return *(Vector2*)(data + (uint64)index * stride);
+  }
+};
+
+// A strided view over `Vector3`s
+struct Vector3View {
+  uint8* data;
+  uint32 stride; 
+  uint32 count;
+
+  // Takes the address of the first vector, the stride in bytes, and the number of vectors
+  Vector3View(void* data, const uint32 stride, const uint32 count) 
+    :data((uint8*)data), stride(stride), count(count)
+  {}
+
+  // Returns the vector at `index` 
+  // NOTE: Does NOT check for out of bounds indices.
+  Vector3& operator[](const uint32 index) const {
+    return *(Vector3*)(data + (uint64)index * stride);
+  }
+};
+
+// A strided view over `Vector4`s
+struct Vector4View {
+  uint8* data;
+  uint32 stride; 
+  uint32 count;
+
+  // Takes the address of the first vector, the stride in bytes, and the number of vectors
+  Vector4View(void* data, const uint32 stride, const uint32 count) 
+    :data((uint8*)data), stride(stride), count(count)
+  {}
+
+  // Returns the vector at `index` 
+  // NOTE: Does NOT check for out of bounds indices.
+  Vector4& operator[](const uint32 index) const {
+    return *(Vector4*)(data + (uint64)index * stride);
+  }
+};
+
+///////////////////////////////////////////////////////////////
+
+// Strided view functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: Every function here works four vectors at a time when SIMD is available, for ANY stride. Tightly packed 
+// views (`sizeof` the vector as the stride) get loaded with whole-register loads, and every other stride gets gathered 
+// with one load per vector (two for `Vector3`, so nothing outside of the vector gets touched). Only the last `count % 4` 
+// vectors go through the scalar path. The functions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), 
+// so the results are the same in every build, and exactly the same as calling the matching scalar function on every vector 
+// (as long as that call does not get fused either). The `out` view can be the same as one of the inputs, and it should 
+// have at least as many vectors as the inputs.
+
+SOC_FP_STRICT_BEGIN
+
+#ifdef SOC_SIMD_SSE
+
+// Loads the 4 `Vector2`s starting at `index` of `view` into the `x` and `y` registers
+SOC_INLINE void simd_gather_vec2(const Vector2View& view, const uint32 index, __m128* x, __m128* y) {
+  const uint8* ptr = view.data + (uint64)index * view.stride;
+  __m128 a, b;
+
+  if(view.stride == sizeof(Vector2)) {
+    a = _mm_loadu_ps((const float32*)ptr);
+    b = _mm_loadu_ps((const float32*)ptr + 4);
+  }
+  else {
+    a = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)ptr), (const __m64*)(ptr + view.stride));
+    b = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(ptr + view.stride * 2)), (const __m64*)(ptr + view.stride * 3));
+  }
+
+  *x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  *y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Stores the `x` and `y` registers into the 4 `Vector2`s starting at `index` of `view` 
+SOC_INLINE void simd_scatter_vec2(const Vector2View& view, const uint32 index, const __m128 x, const __m128 y) {
+  uint8* ptr = view.data + (uint64)index * view.stride;
+  __m128 a   = _mm_unpacklo_ps(x, y);
+  __m128 b   = _mm_unpackhi_ps(x, y);
+
+  if(view.stride == sizeof(Vector2)) {
+    _mm_storeu_ps((float32*)ptr, a);
+    _mm_storeu_ps((float32*)ptr + 4, b);
+  }
+  else {
+    _mm_storel_pi((__m64*)ptr, a);
+    _mm_storeh_pi((__m64*)(ptr + view.stride), a);
+    _mm_storel_pi((__m64*)(ptr + view.stride * 2), b);
+    _mm_storeh_pi((__m64*)(ptr + view.stride * 3), b);
+  }
+}
+
+// Loads the 4 `Vector3`s starting at `index` of `view` into the `x`, `y`, and `z` registers
+SOC_INLINE void simd_gather_vec3(const Vector3View& view, const uint32 index, __m128* x, __m128* y, __m128* z) {
+  const uint8* ptr = view.data + (uint64)index * view.stride;
+
+  if(view.stride == sizeof(Vector3)) {
+    simd_load_vec3((const float32*)ptr, x, y, z);
+    return;
+  }
+
+  // Two exact loads per vector so nothing outside of the vector gets read
+  __m128 v[4];
+  for(uint32 i = 0; i < 4; i++) {
+    const float32* vec = (const float32*)(ptr + view.stride * i);
+    v[i] = _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)vec), _mm_load_ss(vec + 2));
+  }
+
+  _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+  *x = v[0];
+  *y = v[1];
+  *z = v[2];
+}
+
+// Stores the `x`, `y`, and `z` registers into the 4 `Vector3`s starting at `index` of `view` 
+SOC_INLINE void simd_scatter_vec3(const Vector3View& view, const uint32 index, const __m128 x, const __m128 y, const __m128 z) {
+  uint8* ptr = view.data + (uint64)index * view.stride;
+  
+  if(view.stride == sizeof(Vector3)) {
+    simd_store_vec3(x, y, z, (float32*)ptr);
+    return;
+  }
+
+  __m128 v[4] = {x, y, z, _mm_setzero_ps()};
+  _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+
+  // Two exact stores per vector so nothing outside of the vector gets written to
+  for(uint32 i = 0; i < 4; i++) {
+    float32* vec = (float32*)(ptr + view.stride * i);
+    _mm_storel_pi((__m64*)vec, v[i]);
+    _mm_store_ss(vec + 2, _mm_movehl_ps(v[i], v[i]));
+  }
+}
+
+// Loads the 4 `Vector4`s starting at `index` of `view` into the `x`, `y`, `z`, and `w` registers
+SOC_INLINE void simd_gather_vec4(const Vector4View& view, const uint32 index, __m128* x, __m128* y, __m128* z, __m128* w) {
+  const uint8* ptr = view.data + (uint64)index * view.stride;
+
+  __m128 v0 = _mm_loadu_ps((const float32*)(ptr));
+  __m128 v1 = _mm_loadu_ps((const float32*)(ptr + view.stride));
+  __m128 v2 = _mm_loadu_ps((const float32*)(ptr + view.stride * 2));
+  __m128 v3 = _mm_loadu_ps((const float32*)(ptr + view.stride * 3));
+  _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+  *x = v0;
+  *y = v1;
+  *z = v2;
+  *w = v3;
+}
+
+// Stores the `x`, `y`, `z`, and `w` registers into the 4 `Vector4`s starting at `index` of `view` 
+SOC_INLINE void simd_scatter_vec4(const Vector4View& view, const uint32 index, __m128 x, __m128 y, __m128 z, __m128 w) {
+  uint8* ptr = view.data + (uint64)index * view.stride;
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+
+  _mm_storeu_ps((float32*)(ptr), x);
+  _mm_storeu_ps((float32*)(ptr + view.stride), y);
+  _mm_storeu_ps((float32*)(ptr + view.stride * 2), z);
+  _mm_storeu_ps((float32*)(ptr + view.stride * 3), w);
+}
+
+#endif
+
+// Normalizes every vector of `view` in place
+SOC_API void vec2_view_normalize(const Vector2View& view);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_view_normalize(const Vector2View& view) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y;
+    simd_gather_vec2(view, i, &x, &y);
+
+    __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+    simd_scatter_vec2(view, i, _mm_div_ps(x, len), _mm_div_ps(y, len));
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    view[i] = vec2_normalize(view[i]);
+  }
+}
+#endif
+
+// Normalizes every vector of `view` in place
+SOC_API void vec3_view_normalize(const Vector3View& view);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_view_normalize(const Vector3View& view) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y, z;
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+    simd_scatter_vec3(view, i, _mm_div_ps(x, len), _mm_div_ps(y, len), _mm_div_ps(z, len));
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    view[i] = vec3_normalize(view[i]);
+  }
+}
+#endif
+
+// Normalizes every vector of `view` in place
+SOC_API void vec4_view_normalize(const Vector4View& view);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_view_normalize(const Vector4View& view) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y, z, w;
+    simd_gather_vec4(view, i, &x, &y, &z, &w);
+
+    __m128 len = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    len        = _mm_sqrt_ps(_mm_add_ps(len, _mm_mul_ps(w, w)));
+    simd_scatter_vec4(view, i, _mm_div_ps(x, len), _mm_div_ps(y, len), _mm_div_ps(z, len), _mm_div_ps(w, len));
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    view[i] = vec4_normalize(view[i]);
+  }
+}
+#endif
+
+// Transforms every point of `view` in place by `m` (see `mat2x3_transform_point`)
+SOC_API void vec2_view_transform(const Vector2View& view, const Matrix2x3& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_view_transform(const Vector2View& view, const Matrix2x3& m) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y;
+    simd_gather_vec2(view, i, &x, &y);
+
+    __m128 out_x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[0])), _mm_mul_ps(y, _mm_set1_ps(m[2]))), _mm_set1_ps(m[4]));
+    __m128 out_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[1])), _mm_mul_ps(y, _mm_set1_ps(m[3]))), _mm_set1_ps(m[5]));
+    simd_scatter_vec2(view, i, out_x, out_y);
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    view[i] = mat2x3_transform_point(m, view[i]);
+  }
+}
+#endif
+
+// Transforms every vector of `view` in place by `m` with the given `w` (see `mat4_transform_vec4`)
+// NOTE: Use a `w` of 1 for points (like positions) and a `w` of 0 for directions (like normals). 
+// The resulting `w` is dropped, so there is no perspective divide.
+SOC_API void vec3_view_transform(const Vector3View& view, const Matrix4& m, const float32 w);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_view_transform(const Vector3View& view, const Matrix4& m, const float32 w) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 tx = _mm_mul_ps(_mm_set1_ps(m[12]), _mm_set1_ps(w));
+  __m128 ty = _mm_mul_ps(_mm_set1_ps(m[13]), _mm_set1_ps(w));
+  __m128 tz = _mm_mul_ps(_mm_set1_ps(m[14]), _mm_set1_ps(w));
+
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y, z;
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    __m128 out_x = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[4]), y)), _mm_mul_ps(_mm_set1_ps(m[8]),  z)), tx);
+    __m128 out_y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[1]), x), _mm_mul_ps(_mm_set1_ps(m[5]), y)), _mm_mul_ps(_mm_set1_ps(m[9]),  z)), ty);
+    __m128 out_z = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[2]), x), _mm_mul_ps(_mm_set1_ps(m[6]), y)), _mm_mul_ps(_mm_set1_ps(m[10]), z)), tz);
+    simd_scatter_vec3(view, i, out_x, out_y, out_z);
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    Vector4 v = mat4_transform_vec4(m, Vector4(view[i], w));
+    view[i]   = Vector3(v.x, v.y, v.z);
+  }
+}
+#endif
+
+// Transforms every vector of `view` in place by `m` (see `mat4_transform_vec4`)
+SOC_API void vec4_view_transform(const Vector4View& view, const Matrix4& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_view_transform(const Vector4View& view, const Matrix4& m) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i + 4 <= view.count; i += 4) {
+    __m128 x, y, z, w;
+    simd_gather_vec4(view, i, &x, &y, &z, &w);
+
+    __m128 out[4];
+    for(uint32 row = 0; row < 4; row++) {
+      out[row] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[row + 0]), x), 
+                                                  _mm_mul_ps(_mm_set1_ps(m[row + 4]), y)), 
+                                                  _mm_mul_ps(_mm_set1_ps(m[row + 8]), z)), 
+                                                  _mm_mul_ps(_mm_set1_ps(m[row + 12]), w));
+    }
+
+    simd_scatter_vec4(view, i, out[0], out[1], out[2], out[3]);
+  }
+#endif
+
+  for(; i < view.count; i++) {
+    view[i] = mat4_transform_vec4(m, view[i]);
+  }
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec2_lerp`)
+SOC_API void vec2_view_lerp(const Vector2View& out, const Vector2View& start, const Vector2View& end, const float32 amount);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_view_lerp(const Vector2View& out, const Vector2View& start, const Vector2View& end, const float32 amount) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 amt = _mm_set1_ps(amount);
+
+  for(; i + 4 <= start.count; i += 4) {
+    __m128 x0, y0, x1, y1;
+    simd_gather_vec2(start, i, &x0, &y0);
+    simd_gather_vec2(end, i, &x1, &y1);
+
+    simd_scatter_vec2(out, i, 
+                      _mm_add_ps(x0, _mm_mul_ps(amt, _mm_sub_ps(x1, x0))), 
+                      _mm_add_ps(y0, _mm_mul_ps(amt, _mm_sub_ps(y1, y0))));
+  }
+#endif
+
+  for(; i < start.count; i++) {
+    out[i] = vec2_lerp(start[i], end[i], amount);
+  }
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec3_lerp`)
+SOC_API void vec3_view_lerp(const Vector3View& out, const Vector3View& start, const Vector3View& end, const float32 amount);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_view_lerp(const Vector3View& out, const Vector3View& start, const Vector3View& end, const float32 amount) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 amt = _mm_set1_ps(amount);
+
+  for(; i + 4 <= start.count; i += 4) {
+    __m128 x0, y0, z0, x1, y1, z1;
+    simd_gather_vec3(start, i, &x0, &y0, &z0);
+    simd_gather_vec3(end, i, &x1, &y1, &z1);
+
+    simd_scatter_vec3(out, i, 
+                      _mm_add_ps(x0, _mm_mul_ps(amt, _mm_sub_ps(x1, x0))), 
+                      _mm_add_ps(y0, _mm_mul_ps(amt, _mm_sub_ps(y1, y0))), 
+                      _mm_add_ps(z0, _mm_mul_ps(amt, _mm_sub_ps(z1, z0))));
+  }
+#endif
+
+  for(; i < start.count; i++) {
+    out[i] = vec3_lerp(start[i], end[i], amount);
+  }
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec4_lerp`)
+SOC_API void vec4_view_lerp(const Vector4View& out, const Vector4View& start, const Vector4View& end, const float32 amount);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_view_lerp(const Vector4View& out, const Vector4View& start, const Vector4View& end, const float32 amount) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 amt = _mm_set1_ps(amount);
+
+  for(; i + 4 <= start.count; i += 4) {
+    __m128 x0, y0, z0, w0, x1, y1, z1, w1;
+    simd_gather_vec4(start, i, &x0, &y0, &z0, &w0);
+    simd_gather_vec4(end, i, &x1, &y1, &z1, &w1);
+
+    simd_scatter_vec4(out, i, 
+                      _mm_add_ps(x0, _mm_mul_ps(amt, _mm_sub_ps(x1, x0))), 
+                      _mm_add_ps(y0, _mm_mul_ps(amt, _mm_sub_ps(y1, y0))), 
+                      _mm_add_ps(z0, _mm_mul_ps(amt, _mm_sub_ps(z1, z0))), 
+                      _mm_add_ps(w0, _mm_mul_ps(amt, _mm_sub_ps(w1, w0))));
+  }
+#endif
+
+  for(; i < start.count; i++) {
+    out[i] = vec4_lerp(start[i], end[i], amount);
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Mesh functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: The mesh functions take plain arrays of vertex attributes and a triangle list `indices` with `indices_count` 
+// entries (3 for each triangle). Every normal or tangent of a vertex is the sum of the triangles around it, weighted 
+// by the angle of the triangle at that vertex, which is the same weighting MikkTSpace uses. 
+//
+// The corners of the triangles get bucketed by vertex once (in triangle order) on the calling thread. Then the triangles 
+// are split into contiguous ranges, one for each of the `threads_count` threads, which compute the weighted normal (or tangent) 
+// of every corner. Last, the vertices are split the same way, and every vertex adds up the corners in its bucket. 
+// So every triangle gets computed once, no two threads ever write to the same memory, and there is no need for atomics 
+// or locks. The corners are always added in the same order, so the results are the same for any `threads_count`. 
+// The buckets and the corners come from an arena (see `mesh_memory_size`). The overloads without an arena add 
+// the corners straight into the output instead (on the calling thread, in the same order, so with the same results). 
+// Triangles with an index that is not below `vertices_count` are skipped.
+
+#ifndef SOC_DECLARE_ONLY
+
+// The shared state of the `mesh_compute_*` ranges
+struct MeshJob {
+  const Vector3* positions;
+  const Vector3* normals;
+  const Vector2* uvs;
+  const uint32* indices;
+  uint32 vertices_count;
+
+  // The corners (indices into `indices`) around vertex `i` are in `[corner_starts[i], corner_starts[i + 1])` of `corners`
+  const uint32* corner_starts;
+  const uint32* corners;
+
+  // The weighted normal or tangent of every corner
+  Vector3* corner_normals;
+  Vector4* corner_tangents;
+
+  Vector3* out_normals;
+  Vector4* out_tangents;
+};
+
+// Buckets the corners of the `indices_count / 3` triangles in `indices` by vertex, writing 
+// `vertices_count + 1` bucket starts into `out_starts` and the corners into `out_corners`
+// NOTE: The corners of every vertex are in triangle order. Indices that are not below `vertices_count` are left out.
+SOC_INLINE void mesh_bucket_corners(const uint32* indices, 
+                                    const uint32 indices_count, 
+                                    const uint32 vertices_count, 
+                                    uint32* out_starts, 
+                                    uint32* out_corners) {
+  uint32 corners_count = (indices_count / 3) * 3;
+  std::memset(out_starts, 0, sizeof(uint32) * (vertices_count + 1));
+
+  for(uint32 i = 0; i < corners_count; i++) {
+    if(indices[i] < vertices_count) {
+      out_starts[indices[i]]++;
+    }
+  }
+
+  uint32 sum = 0;
+  for(uint32 i = 0; i < vertices_count; i++) {
+    uint32 bucket_count = out_starts[i];
+    out_starts[i]       = sum;
+    sum                += bucket_count;
+  }
+
+  // Every start gets bumped to the end of its bucket (which is the start of the next one) and then shifted back
+  for(uint32 i = 0; i < corners_count; i++) {
+    if(indices[i] < vertices_count) {
+      out_corners[out_starts[indices[i]]++] = i;
+    }
+  }
+
+  for(uint32 i = vertices_count; i > 0; i--) {
+    out_starts[i] = out_starts[i - 1];
+  }
+  out_starts[0] = 0;
+}
+
+// Returns the angles (in radians) of the triangle `p0`, `p1`, and `p2` at each of its corners
+// NOTE: The triangle must not be degenerate.
+SOC_INLINE const Vector3 mesh_corner_angles(const Vector3& p0, const Vector3& p1, const Vector3& p2) {
+  Vector3 e01 = p1 - p0;
+  Vector3 e02 = p2 - p0;
+  Vector3 e12 = p2 - p1;
+
+  float32 l01 = vec3_length(e01);
+  float32 l02 = vec3_length(e02);
+  float32 l12 = vec3_length(e12);
+
+  float32 a0 = std::acos(std::fmin(std::fmax(vec3_dot(e01, e02) / (l01 * l02), -1.0f), 1.0f));
+  float32 a1 = std::acos(std::fmin(std::fmax(-vec3_dot(e01, e12) / (l01 * l12), -1.0f), 1.0f));
+
+  return Vector3(a0, a1, (float32)SOC_PI - a0 - a1);
+}
+
+// Normalizes the normals in `[begin, end)` of `normals`, leaving the zero normals as they are
+SOC_INLINE void mesh_normalize_normals(Vector3* normals, const uint32 begin, const uint32 end) {
+  uint32 i = begin;
+
+#ifdef SOC_SIMD_SSE
+  Vector3View view(normals, sizeof(Vector3), end);
+  __m128 zero = _mm_setzero_ps();
+
+  for(; i + 4 <= end; i += 4) {
+    __m128 x, y, z;
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    __m128 len  = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+    __m128 mask = _mm_cmpgt_ps(len, zero);
+
+    simd_scatter_vec3(view, i, 
+                      _mm_and_ps(mask, _mm_div_ps(x, len)), 
+                      _mm_and_ps(mask, _mm_div_ps(y, len)), 
+                      _mm_and_ps(mask, _mm_div_ps(z, len)));
+  }
+#endif
+
+  for(; i < end; i++) {
+    float32 len = vec3_length(normals[i]);
+    normals[i]  = len > 0.0f ? normals[i] / len : Vector3(0.0f);
+  }
+}
+
+// Normalizes the tangents in `[begin, end)` of `tangents` (leaving the zero tangents as they are) 
+// and turns their accumulated `w` into a `-1` or `1` sign
+SOC_INLINE void mesh_normalize_tangents(Vector4* tangents, const uint32 begin, const uint32 end) {
+  uint32 i = begin;
+
+#ifdef SOC_SIMD_SSE
+  Vector4View view(tangents, sizeof(Vector4), end);
+  __m128 zero = _mm_setzero_ps();
+  __m128 one  = _mm_set1_ps(1.0f);
+
+  for(; i + 4 <= end; i += 4) {
+    __m128 x, y, z, w;
+    simd_gather_vec4(view, i, &x, &y, &z, &w);
+
+    __m128 len  = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+    __m128 mask = _mm_cmpgt_ps(len, zero);
+    __m128 sign = _mm_or_ps(one, _mm_and_ps(_mm_cmplt_ps(w, zero), _mm_set1_ps(-0.0f)));
+
+    simd_scatter_vec4(view, i, 
+                      _mm_and_ps(mask, _mm_div_ps(x, len)), 
+                      _mm_and_ps(mask, _mm_div_ps(y, len)), 
+                      _mm_and_ps(mask, _mm_div_ps(z, len)), 
+                      sign);
+  }
+#endif
+
+  for(; i < end; i++) {
+    Vector3 tangent(tangents[i].x, tangents[i].y, tangents[i].z);
+    float32 len = vec3_length(tangent);
+
+    tangents[i] = Vector4(len > 0.0f ? tangent / len : Vector3(0.0f), tangents[i].w < 0.0f ? -1.0f : 1.0f);
+  }
+}
+
+// Returns true if all 3 indices of the `triangle` are below `vertices_count`
+SOC_INLINE const bool mesh_triangle_is_valid(const uint32* triangle, const uint32 vertices_count) {
+  return triangle[0] < vertices_count && triangle[1] < vertices_count && triangle[2] < vertices_count;
+}
+
+// Writes the weighted normals of the 3 corners of the `triangle` (3 indices) of `job` into `out_corners`
+// NOTE: The corners of degenerate and skipped triangles get a zero normal.
+SOC_INLINE void mesh_triangle_normals(const MeshJob& job, const uint32* triangle, Vector3* out_corners) {
+  out_corners[0] = Vector3(0.0f);
+  out_corners[1] = Vector3(0.0f);
+  out_corners[2] = Vector3(0.0f);
+
+  if(!mesh_triangle_is_valid(triangle, job.vertices_count)) {
+    return;
+  }
+
+  const Vector3& p0 = job.positions[triangle[0]];
+  const Vector3& p1 = job.positions[triangle[1]];
+  const Vector3& p2 = job.positions[triangle[2]];
+
+  Vector3 normal = vec3_cross(p1 - p0, p2 - p0);
+  float32 len    = vec3_length(normal);
+  if(len <= 0.0f) {
+    return;
+  }
+
+  normal         = normal / len;
+  Vector3 angles = mesh_corner_angles(p0, p1, p2);
+
+  out_corners[0] = normal * angles.x;
+  out_corners[1] = normal * angles.y;
+  out_corners[2] = normal * angles.z;
+}
+
+// Computes the weighted normals of the corners of the triangles in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_corner_normals_range(void* user_data, const uint32 begin, const uint32 end) {
+  MeshJob* job = (MeshJob*)user_data;
+
+  for(uint32 i = begin * 3; i < end * 3; i += 3) {
+    mesh_triangle_normals(*job, &job->indices[i], &job->corner_normals[i]);
+  }
+}
+
+// Computes the normals of the vertices in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_normals_range(void* user_data, const uint32 begin, const uint32 end) {
+  MeshJob* job = (MeshJob*)user_data;
+
+  for(uint32 i = begin; i < end; i++) {
+    Vector3 normal(0.0f);
+    for(uint32 j = job->corner_starts[i]; j < job->corner_starts[i + 1]; j++) {
+      normal += job->corner_normals[job->corners[j]];
+    }
+
+    job->out_normals[i] = normal;
+  }
+
+  mesh_normalize_normals(job->out_normals, begin, end);
+}
+
+// Writes the weighted tangents of the 3 corners of the `triangle` (3 indices) of `job` into `out_corners`
+// NOTE: The corners of skipped triangles and of triangles with no area (in either space) get a zero tangent, 
+// and so do the corners whose normal is parallel to the tangent.
+SOC_INLINE void mesh_triangle_tangents(const MeshJob& job, const uint32* triangle, Vector4* out_corners) {
+  out_corners[0] = Vector4(0.0f);
+  out_corners[1] = Vector4(0.0f);
+  out_corners[2] = Vector4(0.0f);
+
+  if(!mesh_triangle_is_valid(triangle, job.vertices_count)) {
+    return;
+  }
+
+  const Vector3& p0 = job.positions[triangle[0]];
+  const Vector3& p1 = job.positions[triangle[1]];
+  const Vector3& p2 = job.positions[triangle[2]];
+
+  Vector3 e1 = p1 - p0; 
+  Vector3 e2 = p2 - p0; 
+  Vector2 d1 = job.uvs[triangle[1]] - job.uvs[triangle[0]];
+  Vector2 d2 = job.uvs[triangle[2]] - job.uvs[triangle[0]];
+
+  // Skipping triangles with no area in either space
+  float32 uv_area = (d1.x * d2.y) - (d2.x * d1.y);
+  if(uv_area == 0.0f || vec3_length(vec3_cross(e1, e2)) <= 0.0f) {
+    return;
+  }
+
+  // The tangent follows the direction of `+U` and the sign tells if the UVs are mirrored
+  float32 sign    = uv_area < 0.0f ? -1.0f : 1.0f;
+  Vector3 tangent = ((e1 * d2.y) - (e2 * d1.y)) * sign;
+  Vector3 angles  = mesh_corner_angles(p0, p1, p2);
+
+  for(uint32 j = 0; j < 3; j++) {
+    // Projecting the tangent on the plane of the vertex normal
+    const Vector3& normal = job.normals[triangle[j]];
+    Vector3 projected     = tangent - (normal * vec3_dot(normal, tangent));
+    float32 len           = vec3_length(projected);
+    if(len <= 0.0f) {
+      continue;
+    }
+
+    out_corners[j] = Vector4(projected * (angles[j] / len), sign * angles[j]);
+  }
+}
+
+// Computes the weighted tangents of the corners of the triangles in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_corner_tangents_range(void* user_data, const uint32 begin, const uint32 end) {
+  MeshJob* job = (MeshJob*)user_data;
+
+  for(uint32 i = begin * 3; i < end * 3; i += 3) {
+    mesh_triangle_tangents(*job, &job->indices[i], &job->corner_tangents[i]);
+  }
+}
+
+// Computes the tangents of the vertices in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_tangents_range(void* user_data, const uint32 begin, const uint32 end) {
+  MeshJob* job = (MeshJob*)user_data;
+
+  for(uint32 i = begin; i < end; i++) {
+    Vector4 tangent(0.0f);
+    for(uint32 j = job->corner_starts[i]; j < job->corner_starts[i + 1]; j++) {
+      tangent += job->corner_tangents[job->corners[j]];
+    }
+
+    job->out_tangents[i] = tangent;
+  }
+
+  mesh_normalize_tangents(job->out_tangents, begin, end);
+}
+
+// Normalizes the already summed normals of the vertices in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_normalize_normals_range(void* user_data, const uint32 begin, const uint32 end) {
+  mesh_normalize_normals(((MeshJob*)user_data)->out_normals, begin, end);
+}
+
+// Normalizes the already summed tangents of the vertices in `[begin, end)` of the `MeshJob` in `user_data`
+SOC_INLINE void mesh_normalize_tangents_range(void* user_data, const uint32 begin, const uint32 end) {
+  mesh_normalize_tangents(((MeshJob*)user_data)->out_tangents, begin, end);
+}
+
+#endif
+
+// Returns the number of bytes of arena memory that `mesh_compute_normals` and `mesh_compute_tangents` need (at most) 
+// for `vertices_count` vertices and `indices_count` indices
+SOC_INLINE const uint64 mesh_memory_size(const uint32 vertices_count, const uint32 indices_count) {
+  // The bucket starts, the corners, and the weighted tangent of every corner (plus the padding of every allocation)
+  return (sizeof(uint32) * ((uint64)vertices_count + 1)) + 
+         (sizeof(uint32) * (uint64)indices_count) + 
+         (sizeof(Vector4) * (uint64)indices_count) + 
+         (64 * 3);
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Allocates the buckets and the corners of `job` out of `arena`, with `corner_size` bytes for every corner, 
+// and fills the buckets in. Returns false if `arena` does not have enough room.
+SOC_INLINE bool mesh_job_prepare(MeshJob& job, 
+                                 const uint32 vertices_count, 
+                                 const uint32 indices_count, 
+                                 const uint64 corner_size, 
+                                 FrameArena& arena) {
+  uint32* corner_starts = (uint32*)arena_alloc(arena, sizeof(uint32) * ((uint64)vertices_count + 1), 64);
+  uint32* corners       = (uint32*)arena_alloc(arena, sizeof(uint32) * (uint64)indices_count, 64);
+  void* corner_values   = arena_alloc(arena, corner_size * (uint64)indices_count, 64);
+  if(!corner_starts || !corners || !corner_values) {
+    return false;
+  }
+
+  mesh_bucket_corners(job.indices, indices_count, vertices_count, corner_starts, corners);
+
+  job.corner_starts   = corner_starts;
+  job.corners         = corners;
+  job.corner_normals  = (Vector3*)corner_values;
+  job.corner_tangents = (Vector4*)corner_values;
+  return true;
+}
+
+#endif
+
+// Computes the normal of each one of the `vertices_count` `positions` from the triangles in `indices` 
+// and writes them into `out_normals`, splitting the work across `threads_count` threads
+// NOTE: The normal of a triangle follows `cross(p1 - p0, p2 - p0)`. Vertices that are not used 
+// by any triangle (or only by degenerate ones) get a zero normal. The memory the function needs comes from `arena` 
+// (see `mesh_memory_size`) and is given back before returning. Returns false (and leaves `out_normals` as it was) 
+// if `arena` does not have enough room. The overload below needs no arena at all.
+SOC_API const bool mesh_compute_normals(const Vector3* positions, 
+                                        const uint32 vertices_count, 
+                                        const uint32* indices, 
+                                        const uint32 indices_count, 
+                                        const uint32 threads_count, 
+                                        FrameArena& arena, 
+                                        Vector3* out_normals);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool mesh_compute_normals(const Vector3* positions, 
+                                        const uint32 vertices_count, 
+                                        const uint32* indices, 
+                                        const uint32 indices_count, 
+                                        const uint32 threads_count, 
+                                        FrameArena& arena, 
+                                        Vector3* out_normals) {
+  uint64 marker = arena_marker(arena);
+
+  MeshJob job = {};
+  job.positions      = positions; 
+  job.indices        = indices; 
+  job.vertices_count = vertices_count; 
+  job.out_normals    = out_normals;
+
+  if(!mesh_job_prepare(job, vertices_count, indices_count, sizeof(Vector3), arena)) {
+    arena_rewind(arena, marker);
+    return false;
+  }
+
+  parallel_for(indices_count / 3, threads_count, mesh_corner_normals_range, &job);
+  parallel_for(vertices_count, threads_count, mesh_normals_range, &job);
+
+  arena_rewind(arena, marker);
+  return true;
+}
+#endif
+
+// The same as the `mesh_compute_normals` above, but without any scratch memory 
+// NOTE: The corners get added straight into `out_normals` on the calling thread, and only the normalization 
+// is split across the `threads_count` threads. The results are exactly the same as with an arena.
+SOC_API void mesh_compute_normals(const Vector3* positions, 
+                                  const uint32 vertices_count, 
+                                  const uint32* indices, 
+                                  const uint32 indices_count, 
+                                  const uint32 threads_count, 
+                                  Vector3* out_normals);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void mesh_compute_normals(const Vector3* positions, 
+                                  const uint32 vertices_count, 
+                                  const uint32* indices, 
+                                  const uint32 indices_count, 
+                                  const uint32 threads_count, 
+                                  Vector3* out_normals) {
+  MeshJob job = {};
+  job.positions      = positions; 
+  job.indices        = indices; 
+  job.vertices_count = vertices_count; 
+  job.out_normals    = out_normals;
+
+  for(uint32 i = 0; i < vertices_count; i++) {
+    out_normals[i] = Vector3(0.0f);
+  }
+
+  // Adding the corners in triangle order, just like the buckets do
+  uint32 corners_count = (indices_count / 3) * 3;
+  for(uint32 i = 0; i < corners_count; i += 3) {
+    Vector3 corners[3];
+    mesh_triangle_normals(job, &indices[i], corners);
+
+    for(uint32 j = 0; j < 3; j++) {
+      if(indices[i + j] < vertices_count) {
+        out_normals[indices[i + j]] += corners[j];
+      }
+    }
+  }
+
+  parallel_for(vertices_count, threads_count, mesh_normalize_normals_range, &job);
+}
+#endif
+
+// Computes the tangent of each one of the `vertices_count` vertices from the triangles in `indices` 
+// and writes them into `out_tangents`, splitting the work across `threads_count` threads
+// NOTE: Every tangent is orthogonal to the normal of its vertex and points towards `+U`. The `w` component 
+// is the sign of the bitangent, `cross(normal, tangent.xyz) * tangent.w` (which is what glTF and MikkTSpace expect). 
+// Unlike MikkTSpace, vertices are never split, so a vertex shared by mirrored and non-mirrored triangles 
+// takes the sign of the side with the biggest total angle. Triangles with no UV area are skipped, and 
+// vertices with no tangent get a zero tangent. `normals` should already be normalized. The memory the function needs 
+// comes from `arena` (see `mesh_memory_size`) and is given back before returning. Returns false (and leaves 
+// `out_tangents` as it was) if `arena` does not have enough room. The overload below needs no arena at all.
+SOC_API const bool mesh_compute_tangents(const Vector3* positions, 
+                                         const Vector3* normals, 
+                                         const Vector2* uvs, 
+                                         const uint32 vertices_count, 
+                                         const uint32* indices, 
+                                         const uint32 indices_count, 
+                                         const uint32 threads_count, 
+                                         FrameArena& arena, 
+                                         Vector4* out_tangents);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool mesh_compute_tangents(const Vector3* positions, 
+                                         const Vector3* normals, 
+                                         const Vector2* uvs, 
+                                         const uint32 vertices_count, 
+                                         const uint32* indices, 
+                                         const uint32 indices_count, 
+                                         const uint32 threads_count, 
+                                         FrameArena& arena, 
+                                         Vector4* out_tangents) {
+  uint64 marker = arena_marker(arena);
+
+  MeshJob job = {};
+  job.positions      = positions; 
+  job.normals        = normals; 
+  job.uvs            = uvs; 
+  job.indices        = indices; 
+  job.vertices_count = vertices_count; 
+  job.out_tangents   = out_tangents;
+
+  if(!mesh_job_prepare(job, vertices_count, indices_count, sizeof(Vector4), arena)) {
+    arena_rewind(arena, marker);
+    return false;
+  }
+
+  parallel_for(indices_count / 3, threads_count, mesh_corner_tangents_range, &job);
+  parallel_for(vertices_count, threads_count, mesh_tangents_range, &job);
+
+  arena_rewind(arena, marker);
+  return true;
+}
+#endif
+
+// The same as the `mesh_compute_tangents` above, but without any scratch memory 
+// NOTE: The corners get added straight into `out_tangents` on the calling thread, and only the normalization 
+// is split across the `threads_count` threads. The results are exactly the same as with an arena.
+SOC_API void mesh_compute_tangents(const Vector3* positions, 
+                                   const Vector3* normals, 
+                                   const Vector2* uvs, 
+                                   const uint32 vertices_count, 
+                                   const uint32* indices, 
+                                   const uint32 indices_count, 
+                                   const uint32 threads_count, 
+                                   Vector4* out_tangents);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void mesh_compute_tangents(const Vector3* positions, 
+                                   const Vector3* normals, 
+                                   const Vector2* uvs, 
+                                   const uint32 vertices_count, 
+                                   const uint32* indices, 
+                                   const uint32 indices_count, 
+                                   const uint32 threads_count, 
+                                   Vector4* out_tangents) {
+  MeshJob job = {};
+  job.positions      = positions; 
+  job.normals        = normals; 
+  job.uvs            = uvs; 
+  job.indices        = indices; 
+  job.vertices_count = vertices_count; 
+  job.out_tangents   = out_tangents;
+
+  for(uint32 i = 0; i < vertices_count; i++) {
+    out_tangents[i] = Vector4(0.0f);
+  }
+
+  // Adding the corners in triangle order, just like the buckets do
+  uint32 corners_count = (indices_count / 3) * 3;
+  for(uint32 i = 0; i < corners_count; i += 3) {
+    Vector4 corners[3];
+    mesh_triangle_tangents(job, &indices[i], corners);
+
+    for(uint32 j = 0; j < 3; j++) {
+      if(indices[i + j] < vertices_count) {
+        out_tangents[indices[i + j]] += corners[j];
+      }
+    }
+  }
+
+  parallel_for(vertices_count, threads_count, mesh_normalize_tangents_range, &job);
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Morton functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: The Morton (Z-order) functions quantize a point inside of an `AABB` into a fixed number of bits 
+// on each axis and interleave them as `...z1y1x1z0y0x0`. Points that are close in space end up close in the code, 
+// so sorting by the code (see `radix_sort32` and `radix_sort64`) gives a cache-friendly order. 
+// Points outside of the box get clamped to its surface. 
+// The 63 bits version uses the BMI2 `pdep` instruction when the compiler targets it (`-mbmi2` or `-march=native`). 
+// Keep in mind that `pdep` is very slow on AMD CPUs before Zen 3, so you might want to leave it off there.
+
+// Spreads the lower 10 bits of `x` so that there are 2 zero bits between each one of them
+SOC_INLINE uint32 morton_spread10(uint32 x) {
+  x &= 0x000003ff;
+  x  = (x | (x << 16)) & 0x030000ff;
+  x  = (x | (x << 8))  & 0x0300f00f;
+  x  = (x | (x << 4))  & 0x030c30c3;
+  x  = (x | (x << 2))  & 0x09249249;
+
+  return x;
+}
+
+// Spreads the lower 21 bits of `x` so that there are 2 zero bits between each one of them
+SOC_INLINE uint64 morton_spread21(uint64 x) {
+#if defined(SOC_SIMD_SSE) && defined(__BMI2__)
+  return _pdep_u64(x, 0x1249249249249249ull);
+#else
+  x &= 0x00000000001fffffull;
+  x  = (x | (x << 32)) & 0x001f00000000ffffull;
+  x  = (x | (x << 16)) & 0x001f0000ff0000ffull;
+  x  = (x | (x << 8))  & 0x100f00f00f00f00full;
+  x  = (x | (x << 4))  & 0x10c30c30c30c30c3ull;
+  x  = (x | (x << 2))  & 0x1249249249249249ull;
+
+  return x;
+#endif
+}
+
+// Returns the multiplier that takes a point of `bounds` (after subtracting `bounds.min`) to `[0, cells]` on each axis
+SOC_INLINE const Vector3 morton_scale(const AABB& bounds, const float32 cells) {
+  Vector3 size = bounds.max - bounds.min;
+
+  return Vector3(size.x > 0.0f ? cells / size.x : 0.0f, 
+                 size.y > 0.0f ? cells / size.y : 0.0f, 
+                 size.z > 0.0f ? cells / size.z : 0.0f);
+}
+
+// Returns the cell of `value` in `[0, max_cell]`
+SOC_INLINE uint32 morton_quantize(const float32 value, const float32 min, const float32 scale, const float32 max_cell) {
+  return (uint32)std::fmin(std::fmax((value - min) * scale, 0.0f), max_cell);
+}
+
+// Returns the 30 bits Morton code (10 bits per axis) of `point` inside of `bounds`
+SOC_INLINE uint32 morton_encode30(const Vector3& point, const AABB& bounds) {
+  Vector3 scale = morton_scale(bounds, 1024.0f);
+
+  return morton_spread10(morton_quantize(point.x, bounds.min.x, scale.x, 1023.0f)) | 
+        (morton_spread10(morton_quantize(point.y, bounds.min.y, scale.y, 1023.0f)) << 1) | 
+        (morton_spread10(morton_quantize(point.z, bounds.min.z, scale.z, 1023.0f)) << 2);
+}
+
+// Returns the 63 bits Morton code (21 bits per axis) of `point` inside of `bounds`
+SOC_INLINE uint64 morton_encode63(const Vector3& point, const AABB& bounds) {
+  Vector3 scale = morton_scale(bounds, 2097152.0f);
+
+  return morton_spread21(morton_quantize(point.x, bounds.min.x, scale.x, 2097151.0f)) | 
+        (morton_spread21(morton_quantize(point.y, bounds.min.y, scale.y, 2097151.0f)) << 1) | 
+        (morton_spread21(morton_quantize(point.z, bounds.min.z, scale.z, 2097151.0f)) << 2);
+}
+
+#ifdef SOC_SIMD_SSE
+
+// Returns the cells of every lane of `x` in `[0, max_cell]`, the same as `morton_quantize`
+SOC_INLINE __m128i simd_morton_quantize(const __m128 x, const __m128 min, const __m128 scale, const __m128 max_cell) {
+  return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(x, min), scale), _mm_setzero_ps()), max_cell));
+}
+
+// The same as `morton_spread10` but on every lane of `x`
+SOC_INLINE __m128i simd_morton_spread10(__m128i x) {
+  x = _mm_and_si128(x, _mm_set1_epi32(0x000003ff));
+  x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 16)), _mm_set1_epi32(0x030000ff));
+  x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 8)),  _mm_set1_epi32(0x0300f00f));
+  x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 4)),  _mm_set1_epi32(0x030c30c3));
+  x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 2)),  _mm_set1_epi32(0x09249249));
+
+  return x;
+}
+
+#endif
+
+// Encodes the 30 bits Morton codes of `count` `points` inside of `bounds` into `out_codes`
+SOC_API void morton_encode30_batch(const Vector3* points, const uint32 count, const AABB& bounds, uint32* out_codes);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void morton_encode30_batch(const Vector3* points, const uint32 count, const AABB& bounds, uint32* out_codes) {
+  Vector3 scale = morton_scale(bounds, 1024.0f);
+  uint32 i      = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector3View view((void*)points, sizeof(Vector3), count);
+
+  __m128 min_x    = _mm_set1_ps(bounds.min.x);
+  __m128 min_y    = _mm_set1_ps(bounds.min.y);
+  __m128 min_z    = _mm_set1_ps(bounds.min.z);
+  __m128 scale_x  = _mm_set1_ps(scale.x);
+  __m128 scale_y  = _mm_set1_ps(scale.y);
+  __m128 scale_z  = _mm_set1_ps(scale.z);
+  __m128 max_cell = _mm_set1_ps(1023.0f);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128 x, y, z; 
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    __m128i code_x = simd_morton_spread10(simd_morton_quantize(x, min_x, scale_x, max_cell));
+    __m128i code_y = simd_morton_spread10(simd_morton_quantize(y, min_y, scale_y, max_cell));
+    __m128i code_z = simd_morton_spread10(simd_morton_quantize(z, min_z, scale_z, max_cell));
+
+    __m128i code = _mm_or_si128(_mm_or_si128(code_x, _mm_slli_epi32(code_y, 1)), _mm_slli_epi32(code_z, 2));
+    _mm_storeu_si128((__m128i*)(out_codes + i), code);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out_codes[i] = morton_spread10(morton_quantize(points[i].x, bounds.min.x, scale.x, 1023.0f)) | 
+                  (morton_spread10(morton_quantize(points[i].y, bounds.min.y, scale.y, 1023.0f)) << 1) | 
+                  (morton_spread10(morton_quantize(points[i].z, bounds.min.z, scale.z, 1023.0f)) << 2);
+  }
+}
+#endif
+
+// Encodes the 63 bits Morton codes of `count` `points` inside of `bounds` into `out_codes`
+SOC_API void morton_encode63_batch(const Vector3* points, const uint32 count, const AABB& bounds, uint64* out_codes);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void morton_encode63_batch(const Vector3* points, const uint32 count, const AABB& bounds, uint64* out_codes) {
+  Vector3 scale = morton_scale(bounds, 2097152.0f);
+  uint32 i      = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector3View view((void*)points, sizeof(Vector3), count);
+
+  __m128 min_x    = _mm_set1_ps(bounds.min.x);
+  __m128 min_y    = _mm_set1_ps(bounds.min.y);
+  __m128 min_z    = _mm_set1_ps(bounds.min.z);
+  __m128 scale_x  = _mm_set1_ps(scale.x);
+  __m128 scale_y  = _mm_set1_ps(scale.y);
+  __m128 scale_z  = _mm_set1_ps(scale.z);
+  __m128 max_cell = _mm_set1_ps(2097151.0f);
+
+  // Only the quantization is done 4 points at a time, since SSE has no 64 bits lanes to spread 4 codes at once
+  for(; i + 4 <= count; i += 4) {
+    __m128 x, y, z; 
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    uint32 cells[3][4];
+    _mm_storeu_si128((__m128i*)cells[0], simd_morton_quantize(x, min_x, scale_x, max_cell));
+    _mm_storeu_si128((__m128i*)cells[1], simd_morton_quantize(y, min_y, scale_y, max_cell));
+    _mm_storeu_si128((__m128i*)cells[2], simd_morton_quantize(z, min_z, scale_z, max_cell));
+
+    for(uint32 j = 0; j < 4; j++) {
+      out_codes[i + j] = morton_spread21(cells[0][j]) | (morton_spread21(cells[1][j]) << 1) | (morton_spread21(cells[2][j]) << 2);
+    }
+  }
+#endif
+
+  for(; i < count; i++) {
+    out_codes[i] = morton_spread21(morton_quantize(points[i].x, bounds.min.x, scale.x, 2097151.0f)) | 
+                  (morton_spread21(morton_quantize(points[i].y, bounds.min.y, scale.y, 2097151.0f)) << 1) | 
+                  (morton_spread21(morton_quantize(points[i].z, bounds.min.z, scale.z, 2097151.0f)) << 2);
+  }
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Sort functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: The radix sorts are stable LSD sorts with 11 bits per pass. They sort `keys` in ascending order and 
+// move the matching `values` along with them. Filling `values` with `0, 1, 2, ...` before sorting gives back 
+// the permutation of the sort, which can then be used to reorder any other arrays. 
+// `scratch_keys` and `scratch_values` need room for `count` entries each, and their contents are undefined afterwards. 
+// Passes where every key has the same digit are skipped, so keys that only use the lower bits (like 30 bits 
+// Morton codes) are sorted in fewer passes.
+
+// Sorts `count` `keys` and `values` by the 32 bits `keys`
+SOC_API void radix_sort32(uint32* keys, uint32* values, const uint32 count, uint32* scratch_keys, uint32* scratch_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void radix_sort32(uint32* keys, uint32* values, const uint32 count, uint32* scratch_keys, uint32* scratch_values) {
+  if(count < 2) {
+    return;
+  }
+
+  // All of the histograms are gathered in one go
+  uint32 histograms[3][2048] = {};
+  for(uint32 i = 0; i < count; i++) {
+    uint32 key = keys[i];
+
+    histograms[0][key & 0x7ff]++;
+    histograms[1][(key >> 11) & 0x7ff]++;
+    histograms[2][key >> 22]++;
+  }
+
+  uint32* src_keys   = keys; 
+  uint32* src_values = values; 
+  uint32* dst_keys   = scratch_keys; 
+  uint32* dst_values = scratch_values;
+
+  for(uint32 pass = 0; pass < 3; pass++) {
+    uint32 shift      = pass * 11;
+    uint32* histogram = histograms[pass];
+
+    if(histogram[(src_keys[0] >> shift) & 0x7ff] == count) {
+      continue;
+    }
+
+    // Turning the counts into offsets
+    uint32 offset = 0;
+    for(uint32 i = 0; i < 2048; i++) {
+      uint32 digit_count = histogram[i];
+      histogram[i]       = offset; 
+      offset            += digit_count;
+    }
+
+    for(uint32 i = 0; i < count; i++) {
+      uint32 dst = histogram[(src_keys[i] >> shift) & 0x7ff]++;
+
+      dst_keys[dst]   = src_keys[i];
+      dst_values[dst] = src_values[i];
+    }
+
+    uint32* temp_keys   = src_keys; 
+    uint32* temp_values = src_values; 
+
+    src_keys   = dst_keys; 
+    src_values = dst_values; 
+    dst_keys   = temp_keys; 
+    dst_values = temp_values;
+  }
+
+  if(src_keys != keys) {
+    std::memcpy(keys, src_keys, sizeof(uint32) * count);
+    std::memcpy(values, src_values, sizeof(uint32) * count);
+  }
+}
+#endif
+
+// Sorts `count` `keys` and `values` by the 64 bits `keys`
+SOC_API void radix_sort64(uint64* keys, uint32* values, const uint32 count, uint64* scratch_keys, uint32* scratch_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void radix_sort64(uint64* keys, uint32* values, const uint32 count, uint64* scratch_keys, uint32* scratch_values) {
+  if(count < 2) {
+    return;
+  }
+
+  // All of the histograms are gathered in one go
+  uint32 histograms[6][2048] = {};
+  for(uint32 i = 0; i < count; i++) {
+    uint64 key = keys[i];
+
+    histograms[0][key & 0x7ff]++;
+    histograms[1][(key >> 11) & 0x7ff]++;
+    histograms[2][(key >> 22) & 0x7ff]++;
+    histograms[3][(key >> 33) & 0x7ff]++;
+    histograms[4][(key >> 44) & 0x7ff]++;
+    histograms[5][key >> 55]++;
+  }
+
+  uint64* src_keys   = keys; 
+  uint32* src_values = values; 
+  uint64* dst_keys   = scratch_keys; 
+  uint32* dst_values = scratch_values;
+
+  for(uint32 pass = 0; pass < 6; pass++) {
+    uint32 shift      = pass * 11;
+    uint32* histogram = histograms[pass];
+
+    if(histogram[(src_keys[0] >> shift) & 0x7ff] == count) {
+      continue;
+    }
+
+    // Turning the counts into offsets
+    uint32 offset = 0;
+    for(uint32 i = 0; i < 2048; i++) {
+      uint32 digit_count = histogram[i];
+      histogram[i]       = offset; 
+      offset            += digit_count;
+    }
+
+    for(uint32 i = 0; i < count; i++) {
+      uint32 dst = histogram[(src_keys[i] >> shift) & 0x7ff]++;
+
+      dst_keys[dst]   = src_keys[i];
+      dst_values[dst] = src_values[i];
+    }
+
+    uint64* temp_keys   = src_keys; 
+    uint32* temp_values = src_values; 
+
+    src_keys   = dst_keys; 
+    src_values = dst_values; 
+    dst_keys   = temp_keys; 
+    dst_values = temp_values;
+  }
+
+  if(src_keys != keys) {
+    std::memcpy(keys, src_keys, sizeof(uint64) * count);
+    std::memcpy(values, src_values, sizeof(uint32) * count);
+  }
+}
+#endif
+
+// The same as `radix_sort32` but takes the scratch memory from `arena` and gives it back once it is done
+// NOTE: Returns false (without sorting anything) if `arena` does not have enough room for the scratch memory.
+SOC_INLINE const bool radix_sort32_arena(uint32* keys, uint32* values, const uint32 count, FrameArena& arena) {
+  uint64 marker          = arena_marker(arena);
+  uint32* scratch_keys   = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+  uint32* scratch_values = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+
+  if(scratch_keys && scratch_values) {
+    radix_sort32(keys, values, count, scratch_keys, scratch_values);
+  }
+
+  arena_rewind(arena, marker);
+  return scratch_keys && scratch_values;
+}
+
+// The same as `radix_sort64` but takes the scratch memory from `arena` and gives it back once it is done
+// NOTE: Returns false (without sorting anything) if `arena` does not have enough room for the scratch memory.
+SOC_INLINE const bool radix_sort64_arena(uint64* keys, uint32* values, const uint32 count, FrameArena& arena) {
+  uint64 marker          = arena_marker(arena);
+  uint64* scratch_keys   = (uint64*)arena_alloc(arena, sizeof(uint64) * count, 64);
+  uint32* scratch_values = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+
+  if(scratch_keys && scratch_values) {
+    radix_sort64(keys, values, count, scratch_keys, scratch_values);
+  }
+
+  arena_rewind(arena, marker);
+  return scratch_keys && scratch_values;
+}
+
+///////////////////////////////////////////////////////////////
+
+// SoA types
+///////////////////////////////////////////////////////////////
+
+// NOTE: The SoA (structure of arrays) types keep each component in its own array (`xxxx...`, `yyyy...`, and so on), 
+// which is the layout that SIMD kernels want. Every array is aligned to `SOC_SOA_ALIGNMENT` bytes and padded 
+// with zeros up to a multiple of `SOC_SOA_BLOCK` entries, so the block-wise functions never need a scalar remainder loop. 
+// The SoA types do NOT own their memory. Get the number of bytes needed with the `*_soa_memory_size` functions 
+// and give that memory to the `*_soa_create` functions.
+
+// The alignment (in bytes) of every SoA array
+#define SOC_SOA_ALIGNMENT 32
+
+// The number of entries every SoA array is padded to a multiple of
+#define SOC_SOA_BLOCK 8
+
+// An array of `Vector2`s stored as SoA
+struct Vector2SoA {
+  float32* x; 
+  float32* y;
+
+  uint32 count;
+};
+
+// An array of `Vector3`s stored as SoA
+struct Vector3SoA {
+  float32* x; 
+  float32* y;
+  float32* z;
+
+  uint32 count;
+};
+
+// An array of `Vector4`s stored as SoA
+struct Vector4SoA {
+  float32* x; 
+  float32* y;
+  float32* z;
+  float32* w;
+
+  uint32 count;
+};
+
+// An array of `Quaternion`s stored as SoA
+struct QuaternionSoA {
+  float32* x; 
+  float32* y;
+  float32* z;
+  float32* w;
+
+  uint32 count;
+};
+
+///////////////////////////////////////////////////////////////
+
+// SoA functions
+///////////////////////////////////////////////////////////////
+
+// NOTE: The SoA functions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so they give 
+// the exact same results in every build.
+SOC_FP_STRICT_BEGIN
+
+// Returns `count` rounded up to the next multiple of `SOC_SOA_BLOCK`
+SOC_INLINE const uint32 soa_padded_count(const uint32 count) {
+  return (count + (SOC_SOA_BLOCK - 1)) & ~(uint32)(SOC_SOA_BLOCK - 1);
+}
+
+// Returns the number of bytes needed for `components_count` SoA arrays of `count` entries each (including the alignment)
+SOC_INLINE const uint64 soa_memory_size(const uint32 components_count, const uint32 count) {
+  return ((uint64)components_count * soa_padded_count(count) * sizeof(float32)) + SOC_SOA_ALIGNMENT;
+}
+
+// Splits `memory` into `components_count` aligned and zeroed SoA arrays of `count` entries each and writes them into `out_arrays`
+SOC_INLINE void soa_split_memory(void* memory, const uint32 components_count, const uint32 count, float32** out_arrays) {
+  uintptr_t address = ((uintptr_t)memory + (SOC_SOA_ALIGNMENT - 1)) & ~(uintptr_t)(SOC_SOA_ALIGNMENT - 1);
+  uint32 padded     = soa_padded_count(count);
+
+  std::memset((void*)address, 0, (uint64)components_count * padded * sizeof(float32));
+
+  for(uint32 i = 0; i < components_count; i++) {
+    out_arrays[i] = (float32*)address + ((uint64)i * padded);
+  }
+}
+
+// Returns the number of bytes a `Vector2SoA` of `count` vectors needs
+SOC_INLINE const uint64 vec2_soa_memory_size(const uint32 count) {
+  return soa_memory_size(2, count);
+}
+
+// Returns the number of bytes a `Vector3SoA` of `count` vectors needs
+SOC_INLINE const uint64 vec3_soa_memory_size(const uint32 count) {
+  return soa_memory_size(3, count);
+}
+
+// Returns the number of bytes a `Vector4SoA` of `count` vectors needs
+SOC_INLINE const uint64 vec4_soa_memory_size(const uint32 count) {
+  return soa_memory_size(4, count);
+}
+
+// Returns the number of bytes a `QuaternionSoA` of `count` quaternions needs
+SOC_INLINE const uint64 quat_soa_memory_size(const uint32 count) {
+  return soa_memory_size(4, count);
+}
+
+// Creates and returns a zeroed `Vector2SoA` of `count` vectors inside of `memory` 
+// NOTE: `memory` must be at least `vec2_soa_memory_size(count)` bytes.
+SOC_INLINE const Vector2SoA vec2_soa_create(void* memory, const uint32 count) {
+  float32* arrays[2];
+  soa_split_memory(memory, 2, count, arrays);
+
+  return Vector2SoA{arrays[0], arrays[1], count};
+}
+
+// Creates and returns a zeroed `Vector3SoA` of `count` vectors inside of `memory` 
+// NOTE: `memory` must be at least `vec3_soa_memory_size(count)` bytes.
+SOC_INLINE const Vector3SoA vec3_soa_create(void* memory, const uint32 count) {
+  float32* arrays[3];
+  soa_split_memory(memory, 3, count, arrays);
+
+  return Vector3SoA{arrays[0], arrays[1], arrays[2], count};
+}
+
+// Creates and returns a zeroed `Vector4SoA` of `count` vectors inside of `memory` 
+// NOTE: `memory` must be at least `vec4_soa_memory_size(count)` bytes.
+SOC_INLINE const Vector4SoA vec4_soa_create(void* memory, const uint32 count) {
+  float32* arrays[4];
+  soa_split_memory(memory, 4, count, arrays);
+
+  return Vector4SoA{arrays[0], arrays[1], arrays[2], arrays[3], count};
+}
+
+// Creates and returns a zeroed `QuaternionSoA` of `count` quaternions inside of `memory` 
+// NOTE: `memory` must be at least `quat_soa_memory_size(count)` bytes.
+SOC_INLINE const QuaternionSoA quat_soa_create(void* memory, const uint32 count) {
+  float32* arrays[4];
+  soa_split_memory(memory, 4, count, arrays);
+
+  return QuaternionSoA{arrays[0], arrays[1], arrays[2], arrays[3], count};
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Writes the dot products of the SoA arrays `a` and `b` (of `components_count` components and `padded` entries) into `out`
+SOC_INLINE void soa_dot(const float32* const* a, const float32* const* b, const uint32 components_count, const uint32 padded, float32* out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i < padded; i += 4) {
+    __m128 sum = _mm_mul_ps(_mm_load_ps(a[0] + i), _mm_load_ps(b[0] + i));
+    for(uint32 c = 1; c < components_count; c++) {
+      sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(a[c] + i), _mm_load_ps(b[c] + i)));
+    }
+
+    _mm_storeu_ps(out + i, sum);
+  }
+#endif
+
+  for(; i < padded; i++) {
+    float32 sum = a[0][i] * b[0][i];
+    for(uint32 c = 1; c < components_count; c++) {
+      sum += a[c][i] * b[c][i];
+    }
+
+    out[i] = sum;
+  }
+}
+
+// Replaces every one of the `padded` entries of `values` with its square root
+SOC_INLINE void soa_sqrt(float32* values, const uint32 padded) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i < padded; i += 4) {
+    _mm_storeu_ps(values + i, _mm_sqrt_ps(_mm_loadu_ps(values + i)));
+  }
+#endif
+
+  for(; i < padded; i++) {
+    values[i] = (float32)sqrt(values[i]);
+  }
+}
+
+// Writes `in` divided by its length into `out` for SoA arrays of `components_count` components and `padded` entries 
+// NOTE: If `use_reciprocal` is true, the components get multiplied by `1 / length` instead (like `quat_normalize`).
+// Zero-length entries (like the zeroed padding) are written as zero instead of NaN.
+SOC_INLINE void soa_normalize(const float32* const* in, float32* const* out, const uint32 components_count, const uint32 padded, const bool use_reciprocal) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 one  = _mm_set1_ps(1.0f);
+  __m128 zero = _mm_setzero_ps();
+
+  for(; i < padded; i += 4) {
+    __m128 sum = _mm_mul_ps(_mm_load_ps(in[0] + i), _mm_load_ps(in[0] + i));
+    for(uint32 c = 1; c < components_count; c++) {
+      sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(in[c] + i), _mm_load_ps(in[c] + i)));
+    }
+
+    __m128 len  = _mm_sqrt_ps(sum);
+    __m128 mask = _mm_cmpgt_ps(len, zero);
+    if(use_reciprocal) {
+      __m128 inv_len = _mm_and_ps(mask, _mm_div_ps(one, len));
+      for(uint32 c = 0; c < components_count; c++) {
+        _mm_store_ps(out[c] + i, _mm_mul_ps(_mm_load_ps(in[c] + i), inv_len));
+      }
+    }
+    else {
+      for(uint32 c = 0; c < components_count; c++) {
+        _mm_store_ps(out[c] + i, _mm_and_ps(mask, _mm_div_ps(_mm_load_ps(in[c] + i), len)));
+      }
+    }
+  }
+#endif
+
+  for(; i < padded; i++) {
+    float32 sum = in[0][i] * in[0][i];
+    for(uint32 c = 1; c < components_count; c++) {
+      sum += in[c][i] * in[c][i];
+    }
+
+    float32 len = (float32)sqrt(sum);
+    if(len <= 0.0f) {
+      for(uint32 c = 0; c < components_count; c++) {
+        out[c][i] = 0.0f;
+      }
+    }
+    else if(use_reciprocal) {
+      float32 inv_len = 1.0f / len;
+      for(uint32 c = 0; c < components_count; c++) {
+        out[c][i] = in[c][i] * inv_len;
+      }
+    }
+    else {
+      for(uint32 c = 0; c < components_count; c++) {
+        out[c][i] = in[c][i] / len;
+      }
+    }
+  }
+}
+
+// Writes the linear interpolation between the SoA arrays `start` and `end` by `amount` into `out` 
+// (of `components_count` components and `padded` entries)
+SOC_INLINE void soa_lerp(const float32* const* start, const float32* const* end, const float32 amount, float32* const* out, const uint32 components_count, const uint32 padded) {
+  for(uint32 c = 0; c < components_count; c++) {
+    uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+    __m128 t = _mm_set1_ps(amount);
+
+    for(; i < padded; i += 4) {
+      __m128 s = _mm_load_ps(start[c] + i);
+      _mm_store_ps(out[c] + i, _mm_add_ps(s, _mm_mul_ps(t, _mm_sub_ps(_mm_load_ps(end[c] + i), s))));
+    }
+#endif
+
+    for(; i < padded; i++) {
+      out[c][i] = lerp(start[c][i], end[c][i], amount);
+    }
+  }
+}
+
+#endif
+
+// Creates and returns a zeroed `Vector2SoA` of `count` vectors with its memory taken from `arena`
+// NOTE: Returns an empty SoA (with no arrays and a `count` of 0) if `arena` does not have enough room. 
+// The same goes for all the other `*_soa_create_arena` functions.
+SOC_INLINE const Vector2SoA vec2_soa_create_arena(FrameArena& arena, const uint32 count) {
+  void* memory = arena_alloc(arena, vec2_soa_memory_size(count), SOC_SOA_ALIGNMENT);
+  return memory ? vec2_soa_create(memory, count) : Vector2SoA{nullptr, nullptr, 0};
+}
+
+// Creates and returns a zeroed `Vector3SoA` of `count` vectors with its memory taken from `arena`
+SOC_INLINE const Vector3SoA vec3_soa_create_arena(FrameArena& arena, const uint32 count) {
+  void* memory = arena_alloc(arena, vec3_soa_memory_size(count), SOC_SOA_ALIGNMENT);
+  return memory ? vec3_soa_create(memory, count) : Vector3SoA{nullptr, nullptr, nullptr, 0};
+}
+
+// Creates and returns a zeroed `Vector4SoA` of `count` vectors with its memory taken from `arena`
+SOC_INLINE const Vector4SoA vec4_soa_create_arena(FrameArena& arena, const uint32 count) {
+  void* memory = arena_alloc(arena, vec4_soa_memory_size(count), SOC_SOA_ALIGNMENT);
+  return memory ? vec4_soa_create(memory, count) : Vector4SoA{nullptr, nullptr, nullptr, nullptr, 0};
+}
+
+// Creates and returns a zeroed `QuaternionSoA` of `count` quaternions with its memory taken from `arena`
+SOC_INLINE const QuaternionSoA quat_soa_create_arena(FrameArena& arena, const uint32 count) {
+  void* memory = arena_alloc(arena, quat_soa_memory_size(count), SOC_SOA_ALIGNMENT);
+  return memory ? quat_soa_create(memory, count) : QuaternionSoA{nullptr, nullptr, nullptr, nullptr, 0};
+}
+
+// Transposes `count` `Vector2`s from `aos` into `out` 
+// NOTE: `count` must not be bigger than `out.count`. The same goes for all the other `*_soa_from_aos` functions.
+SOC_API void vec2_soa_from_aos(const Vector2* aos, const uint32 count, const Vector2SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_from_aos(const Vector2* aos, const uint32 count, const Vector2SoA& out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector2View view((void*)aos, sizeof(Vector2), count);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128 x, y;
+    simd_gather_vec2(view, i, &x, &y);
+
+    _mm_store_ps(out.x + i, x);
+    _mm_store_ps(out.y + i, y);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out.x[i] = aos[i].x;
+    out.y[i] = aos[i].y;
+  }
+}
+#endif
+
+// Transposes `count` `Vector3`s from `aos` into `out`
+SOC_API void vec3_soa_from_aos(const Vector3* aos, const uint32 count, const Vector3SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_from_aos(const Vector3* aos, const uint32 count, const Vector3SoA& out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector3View view((void*)aos, sizeof(Vector3), count);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128 x, y, z;
+    simd_gather_vec3(view, i, &x, &y, &z);
+
+    _mm_store_ps(out.x + i, x);
+    _mm_store_ps(out.y + i, y);
+    _mm_store_ps(out.z + i, z);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out.x[i] = aos[i].x;
+    out.y[i] = aos[i].y;
+    out.z[i] = aos[i].z;
+  }
+}
+#endif
+
+// Transposes `count` `Vector4`s from `aos` into `out`
+SOC_API void vec4_soa_from_aos(const Vector4* aos, const uint32 count, const Vector4SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_from_aos(const Vector4* aos, const uint32 count, const Vector4SoA& out) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector4View view((void*)aos, sizeof(Vector4), count);
+
+  for(; i + 4 <= count; i += 4) {
+    __m128 x, y, z, w;
+    simd_gather_vec4(view, i, &x, &y, &z, &w);
+
+    _mm_store_ps(out.x + i, x);
+    _mm_store_ps(out.y + i, y);
+    _mm_store_ps(out.z + i, z);
+    _mm_store_ps(out.w + i, w);
+  }
+#endif
+
+  for(; i < count; i++) {
+    out.x[i] = aos[i].x;
+    out.y[i] = aos[i].y;
+    out.z[i] = aos[i].z;
+    out.w[i] = aos[i].w;
+  }
+}
+#endif
+
+// Transposes `count` `Quaternion`s from `aos` into `out`
+SOC_INLINE void quat_soa_from_aos(const Quaternion* aos, const uint32 count, const QuaternionSoA& out) {
+  vec4_soa_from_aos((const Vector4*)aos, count, Vector4SoA{out.x, out.y, out.z, out.w, out.count});
+}
+
+// Transposes every vector of `soa` back into `out_aos`
+SOC_API void vec2_soa_to_aos(const Vector2SoA& soa, Vector2* out_aos);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_to_aos(const Vector2SoA& soa, Vector2* out_aos) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector2View view(out_aos, sizeof(Vector2), soa.count);
+
+  for(; i + 4 <= soa.count; i += 4) {
+    simd_scatter_vec2(view, i, _mm_load_ps(soa.x + i), _mm_load_ps(soa.y + i));
+  }
+#endif
+
+  for(; i < soa.count; i++) {
+    out_aos[i] = Vector2(soa.x[i], soa.y[i]);
+  }
+}
+#endif
+
+// Transposes every vector of `soa` back into `out_aos`
+SOC_API void vec3_soa_to_aos(const Vector3SoA& soa, Vector3* out_aos);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_to_aos(const Vector3SoA& soa, Vector3* out_aos) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector3View view(out_aos, sizeof(Vector3), soa.count);
+
+  for(; i + 4 <= soa.count; i += 4) {
+    simd_scatter_vec3(view, i, _mm_load_ps(soa.x + i), _mm_load_ps(soa.y + i), _mm_load_ps(soa.z + i));
+  }
+#endif
+
+  for(; i < soa.count; i++) {
+    out_aos[i] = Vector3(soa.x[i], soa.y[i], soa.z[i]);
+  }
+}
+#endif
+
+// Transposes every vector of `soa` back into `out_aos`
+SOC_API void vec4_soa_to_aos(const Vector4SoA& soa, Vector4* out_aos);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_to_aos(const Vector4SoA& soa, Vector4* out_aos) {
+  uint32 i = 0;
+
+#ifdef SOC_SIMD_SSE
+  Vector4View view(out_aos, sizeof(Vector4), soa.count);
+
+  for(; i + 4 <= soa.count; i += 4) {
+    simd_scatter_vec4(view, i, _mm_load_ps(soa.x + i), _mm_load_ps(soa.y + i), _mm_load_ps(soa.z + i), _mm_load_ps(soa.w + i));
+  }
+#endif
+
+  for(; i < soa.count; i++) {
+    out_aos[i] = Vector4(soa.x[i], soa.y[i], soa.z[i], soa.w[i]);
+  }
+}
+#endif
+
+// Transposes every quaternion of `soa` back into `out_aos`
+SOC_INLINE void quat_soa_to_aos(const QuaternionSoA& soa, Quaternion* out_aos) {
+  vec4_soa_to_aos(Vector4SoA{soa.x, soa.y, soa.z, soa.w, soa.count}, (Vector4*)out_aos);
+}
+
+// NOTE: The block-wise functions below work on whole blocks, including the padding. So any `float32` output array 
+// needs room for `soa_padded_count(count)` entries, and SoA outputs need at least the same `count` as the inputs. 
+// SoA outputs can be the same as the inputs. Every function gives the exact same results as its per-element counterpart 
+// (except for the normalize functions, which write zero for zero-length entries instead of NaN) when that counterpart 
+// is not fused either. Code built with FMA can get the per-element functions fused wherever they get inlined.
+
+// Writes the dot products of `a` and `b` into `out` (see `vec2_dot`)
+SOC_API void vec2_soa_dot(const Vector2SoA& a, const Vector2SoA& b, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_dot(const Vector2SoA& a, const Vector2SoA& b, float32* out) {
+  const float32* a_arrays[2] = {a.x, a.y};
+  const float32* b_arrays[2] = {b.x, b.y};
+
+  soa_dot(a_arrays, b_arrays, 2, soa_padded_count(a.count), out);
+}
+#endif
+
+// Writes the dot products of `a` and `b` into `out` (see `vec3_dot`)
+SOC_API void vec3_soa_dot(const Vector3SoA& a, const Vector3SoA& b, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_dot(const Vector3SoA& a, const Vector3SoA& b, float32* out) {
+  const float32* a_arrays[3] = {a.x, a.y, a.z};
+  const float32* b_arrays[3] = {b.x, b.y, b.z};
+
+  soa_dot(a_arrays, b_arrays, 3, soa_padded_count(a.count), out);
+}
+#endif
+
+// Writes the dot products of `a` and `b` into `out` (see `vec4_dot`)
+SOC_API void vec4_soa_dot(const Vector4SoA& a, const Vector4SoA& b, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_dot(const Vector4SoA& a, const Vector4SoA& b, float32* out) {
+  const float32* a_arrays[4] = {a.x, a.y, a.z, a.w};
+  const float32* b_arrays[4] = {b.x, b.y, b.z, b.w};
+
+  soa_dot(a_arrays, b_arrays, 4, soa_padded_count(a.count), out);
+}
+#endif
+
+// Writes the dot products of `a` and `b` into `out` (see `quat_dot`)
+SOC_API void quat_soa_dot(const QuaternionSoA& a, const QuaternionSoA& b, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_soa_dot(const QuaternionSoA& a, const QuaternionSoA& b, float32* out) {
+  const float32* a_arrays[4] = {a.x, a.y, a.z, a.w};
+  const float32* b_arrays[4] = {b.x, b.y, b.z, b.w};
+
+  soa_dot(a_arrays, b_arrays, 4, soa_padded_count(a.count), out);
+}
+#endif
+
+// Writes the lengths of every vector of `v` into `out` (see `vec2_length`)
+SOC_API void vec2_soa_length(const Vector2SoA& v, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_length(const Vector2SoA& v, float32* out) {
+  vec2_soa_dot(v, v, out);
+  soa_sqrt(out, soa_padded_count(v.count));
+}
+#endif
+
+// Writes the lengths of every vector of `v` into `out` (see `vec3_length`)
+SOC_API void vec3_soa_length(const Vector3SoA& v, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_length(const Vector3SoA& v, float32* out) {
+  vec3_soa_dot(v, v, out);
+  soa_sqrt(out, soa_padded_count(v.count));
+}
+#endif
+
+// Writes the lengths of every vector of `v` into `out` (see `vec4_length`)
+SOC_API void vec4_soa_length(const Vector4SoA& v, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_length(const Vector4SoA& v, float32* out) {
+  vec4_soa_dot(v, v, out);
+  soa_sqrt(out, soa_padded_count(v.count));
+}
+#endif
+
+// Writes the lengths of every quaternion of `q` into `out` (see `quat_length`)
+SOC_API void quat_soa_length(const QuaternionSoA& q, float32* out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_soa_length(const QuaternionSoA& q, float32* out) {
+  quat_soa_dot(q, q, out);
+  soa_sqrt(out, soa_padded_count(q.count));
+}
+#endif
+
+// Writes the normalized version of every vector of `v` into `out` (see `vec2_normalize`)
+SOC_API void vec2_soa_normalize(const Vector2SoA& v, const Vector2SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_normalize(const Vector2SoA& v, const Vector2SoA& out) {
+  const float32* in_arrays[2] = {v.x, v.y};
+  float32* out_arrays[2]      = {out.x, out.y};
+
+  soa_normalize(in_arrays, out_arrays, 2, soa_padded_count(v.count), false);
+}
+#endif
+
+// Writes the normalized version of every vector of `v` into `out` (see `vec3_normalize`)
+SOC_API void vec3_soa_normalize(const Vector3SoA& v, const Vector3SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_normalize(const Vector3SoA& v, const Vector3SoA& out) {
+  const float32* in_arrays[3] = {v.x, v.y, v.z};
+  float32* out_arrays[3]      = {out.x, out.y, out.z};
+
+  soa_normalize(in_arrays, out_arrays, 3, soa_padded_count(v.count), false);
+}
+#endif
+
+// Writes the normalized version of every vector of `v` into `out` (see `vec4_normalize`)
+SOC_API void vec4_soa_normalize(const Vector4SoA& v, const Vector4SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_normalize(const Vector4SoA& v, const Vector4SoA& out) {
+  const float32* in_arrays[4] = {v.x, v.y, v.z, v.w};
+  float32* out_arrays[4]      = {out.x, out.y, out.z, out.w};
+
+  soa_normalize(in_arrays, out_arrays, 4, soa_padded_count(v.count), false);
+}
+#endif
+
+// Writes the normalized version of every quaternion of `q` into `out` (see `quat_normalize`)
+SOC_API void quat_soa_normalize(const QuaternionSoA& q, const QuaternionSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_soa_normalize(const QuaternionSoA& q, const QuaternionSoA& out) {
+  const float32* in_arrays[4] = {q.x, q.y, q.z, q.w};
+  float32* out_arrays[4]      = {out.x, out.y, out.z, out.w};
+
+  soa_normalize(in_arrays, out_arrays, 4, soa_padded_count(q.count), true);
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec2_lerp`)
+SOC_API void vec2_soa_lerp(const Vector2SoA& start, const Vector2SoA& end, const float32 amount, const Vector2SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec2_soa_lerp(const Vector2SoA& start, const Vector2SoA& end, const float32 amount, const Vector2SoA& out) {
+  const float32* start_arrays[2] = {start.x, start.y};
+  const float32* end_arrays[2]   = {end.x, end.y};
+  float32* out_arrays[2]         = {out.x, out.y};
+
+  soa_lerp(start_arrays, end_arrays, amount, out_arrays, 2, soa_padded_count(start.count));
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec3_lerp`)
+SOC_API void vec3_soa_lerp(const Vector3SoA& start, const Vector3SoA& end, const float32 amount, const Vector3SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_lerp(const Vector3SoA& start, const Vector3SoA& end, const float32 amount, const Vector3SoA& out) {
+  const float32* start_arrays[3] = {start.x, start.y, start.z};
+  const float32* end_arrays[3]   = {end.x, end.y, end.z};
+  float32* out_arrays[3]         = {out.x, out.y, out.z};
+
+  soa_lerp(start_arrays, end_arrays, amount, out_arrays, 3, soa_padded_count(start.count));
+}
+#endif
+
+// Writes the linear interpolation between every vector of `start` and `end` by `amount` into `out` (see `vec4_lerp`)
+SOC_API void vec4_soa_lerp(const Vector4SoA& start, const Vector4SoA& end, const float32 amount, const Vector4SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec4_soa_lerp(const Vector4SoA& start, const Vector4SoA& end, const float32 amount, const Vector4SoA& out) {
+  const float32* start_arrays[4] = {start.x, start.y, start.z, start.w};
+  const float32* end_arrays[4]   = {end.x, end.y, end.z, end.w};
+  float32* out_arrays[4]         = {out.x, out.y, out.z, out.w};
+
+  soa_lerp(start_arrays, end_arrays, amount, out_arrays, 4, soa_padded_count(start.count));
+}
+#endif
+
+// Writes the normalized linear interpolation between every quaternion of `start` and `end` by `amount` into `out` 
+// (see `quat_nlerp`)
+SOC_API void quat_soa_nlerp(const QuaternionSoA& start, const QuaternionSoA& end, const float32 amount, const QuaternionSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_soa_nlerp(const QuaternionSoA& start, const QuaternionSoA& end, const float32 amount, const QuaternionSoA& out) {
+  uint32 padded = soa_padded_count(start.count);
+  uint32 i      = 0;
+
+#ifdef SOC_SIMD_SSE
+  __m128 t    = _mm_set1_ps(amount);
+  __m128 one  = _mm_set1_ps(1.0f);
+  __m128 zero = _mm_setzero_ps();
+
+  for(; i < padded; i += 4) {
+    __m128 s[4] = {_mm_load_ps(start.x + i), _mm_load_ps(start.y + i), _mm_load_ps(start.z + i), _mm_load_ps(start.w + i)};
+    __m128 e[4] = {_mm_load_ps(end.x + i), _mm_load_ps(end.y + i), _mm_load_ps(end.z + i), _mm_load_ps(end.w + i)};
+
+    __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(s[0], e[0]), _mm_mul_ps(s[1], e[1])), _mm_mul_ps(s[2], e[2])), _mm_mul_ps(s[3], e[3]));
+    __m128 neg = _mm_and_ps(_mm_cmplt_ps(dot, zero), _mm_set1_ps(-0.0f));
+
+    __m128 q[4];
+    for(uint32 c = 0; c < 4; c++) {
+      q[c] = _mm_add_ps(s[c], _mm_mul_ps(t, _mm_sub_ps(_mm_xor_ps(e[c], neg), s[c])));
+    }
+
+    __m128 len     = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(q[0], q[0]), _mm_mul_ps(q[1], q[1])), _mm_mul_ps(q[2], q[2])), _mm_mul_ps(q[3], q[3]));
+    __m128 inv_len = _mm_div_ps(one, _mm_sqrt_ps(len));
+
+    _mm_store_ps(out.x + i, _mm_mul_ps(q[0], inv_len));
+    _mm_store_ps(out.y + i, _mm_mul_ps(q[1], inv_len));
+    _mm_store_ps(out.z + i, _mm_mul_ps(q[2], inv_len));
+    _mm_store_ps(out.w + i, _mm_mul_ps(q[3], inv_len));
+  }
+#endif
+
+  for(; i < padded; i++) {
+    Quaternion q = quat_nlerp(Quaternion(start.x[i], start.y[i], start.z[i], start.w[i]), 
+                              Quaternion(end.x[i], end.y[i], end.z[i], end.w[i]), 
+                              amount);
+
+    out.x[i] = q.x; 
+    out.y[i] = q.y; 
+    out.z[i] = q.z; 
+    out.w[i] = q.w; 
+  }
+}
+#endif
+
+// Writes the cross products of `a` and `b` into `out` (see `vec3_cross`)
+SOC_API void vec3_soa_cross(const Vector3SoA& a, const Vector3SoA& b, const Vector3SoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void vec3_soa_cross(const Vector3SoA& a, const Vector3SoA& b, const Vector3SoA& out) {
+  uint32 padded = soa_padded_count(a.count);
+  uint32 i      = 0;
+
+#ifdef SOC_SIMD_SSE
+  for(; i < padded; i += 4) {
+    __m128 ax = _mm_load_ps(a.x + i), ay = _mm_load_ps(a.y + i), az = _mm_load_ps(a.z + i);
+    __m128 bx = _mm_load_ps(b.x + i), by = _mm_load_ps(b.y + i), bz = _mm_load_ps(b.z + i);
+
+    _mm_store_ps(out.x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+    _mm_store_ps(out.y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+    _mm_store_ps(out.z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+  }
+#endif
+
+  for(; i < padded; i++) {
+    Vector3 cross = vec3_cross(Vector3(a.x[i], a.y[i], a.z[i]), Vector3(b.x[i], b.y[i], b.z[i]));
+
+    out.x[i] = cross.x; 
+    out.y[i] = cross.y; 
+    out.z[i] = cross.z; 
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Wide types
+///////////////////////////////////////////////////////////////
+
+// NOTE: The wide types hold 4 or 8 values at once (one per lane) and are meant for writing your own SIMD loops. 
+// Every wide function has the same name as its scalar counterpart with the lane count added (`vec3_dot` -> `vec3x4_dot`) 
+// and works on every lane at once. `floatx4` (and everything built on top of it) uses SSE, and `floatx8` uses AVX 
+// when the compiler targets it (`-mavx` or `-march=native`). Otherwise, `floatx8` is made of two `floatx4`s. 
+// Without any SIMD, all of the wide types fall back to plain loops over their lanes. 
+// Comparisons return lane masks (`maskx4` and `maskx8`) with every bit of a lane set if the comparison is true, 
+// which can then be used with the `*_select` functions to write branchless code.
+
+// 4 `float32` lanes
+union floatx4 {
+  float32 lanes[4];
+
+#ifdef SOC_SIMD_SSE
+  __m128 simd;
+
+  // Takes the SIMD register of the lanes
+  floatx4(const __m128 simd) 
+    :simd(simd)
+  {}
+#endif
+
+  // Default CTOR where every lane is 0
+  floatx4() 
+    :lanes{0.0f, 0.0f, 0.0f, 0.0f}
+  {}
+
+  // Fills every lane with the given value
+  floatx4(const float32 s) 
+    :lanes{s, s, s, s}
+  {}
+
+  // Takes the value of each lane
+  floatx4(const float32 l0, const float32 l1, const float32 l2, const float32 l3) 
+    :lanes{l0, l1, l2, l3}
+  {}
+};
+
+// A mask of 4 lanes
+union maskx4 {
+  uint32 lanes[4];
+
+#ifdef SOC_SIMD_SSE
+  __m128 simd;
+
+  // Takes the SIMD register of the mask
+  maskx4(const __m128 simd) 
+    :simd(simd)
+  {}
+#endif
+
+  // Default CTOR where every lane is off
+  maskx4() 
+    :lanes{0, 0, 0, 0}
+  {}
+};
+
+// 8 `float32` lanes
+union floatx8 {
+  float32 lanes[8];
+
+#ifdef SOC_SIMD_AVX
+  __m256 simd;
+
+  // Takes the SIMD register of the lanes
+  floatx8(const __m256 simd) 
+    :simd(simd)
+  {}
+
+  // Default CTOR where every lane is 0
+  floatx8() 
+    :simd(_mm256_setzero_ps())
+  {}
+
+  // Fills every lane with the given value
+  floatx8(const float32 s) 
+    :simd(_mm256_set1_ps(s))
+  {}
+#else
+  floatx4 halves[2];
+
+  // Takes the lower 4 lanes and the upper 4 lanes
+  floatx8(const floatx4& low, const floatx4& high) 
+    :halves{low, high}
+  {}
+
+  // Default CTOR where every lane is 0
+  floatx8() 
+    :halves{floatx4(), floatx4()}
+  {}
+
+  // Fills every lane with the given value
+  floatx8(const float32 s) 
+    :halves{floatx4(s), floatx4(s)}
+  {}
+#endif
+};
+
+// A mask of 8 lanes
+union maskx8 {
+  uint32 lanes[8];
+
+#ifdef SOC_SIMD_AVX
+  __m256 simd;
+
+  // Takes the SIMD register of the mask
+  maskx8(const __m256 simd) 
+    :simd(simd)
+  {}
+#else
+  maskx4 halves[2];
+
+  // Takes the lower 4 lanes and the upper 4 lanes
+  maskx8(const maskx4& low, const maskx4& high) 
+    :halves{low, high}
+  {}
+#endif
+
+  // Default CTOR where every lane is off
+  maskx8() 
+    :lanes{0, 0, 0, 0, 0, 0, 0, 0}
+  {}
+};
+
+// 4 `Vector3`s, one in each lane
+struct Vector3x4 {
+  floatx4 x, y, z;
+
+  // Default CTOR where every vector is 0
+  Vector3x4() 
+    :x(0.0f), y(0.0f), z(0.0f)
+  {}
+
+  // Takes the `x`, `y`, and `z` components of all the lanes
+  Vector3x4(const floatx4& x, const floatx4& y, const floatx4& z) 
+    :x(x), y(y), z(z)
+  {}
+
+  // Fills every lane with the given vector
+  Vector3x4(const Vector3& v) 
+    :x(v.x), y(v.y), z(v.z)
+  {}
+};
+
+// 8 `Vector3`s, one in each lane
+struct Vector3x8 {
+  floatx8 x, y, z;
+
+  // Default CTOR where every vector is 0
+  Vector3x8() 
+    :x(0.0f), y(0.0f), z(0.0f)
+  {}
+
+  // Takes the `x`, `y`, and `z` components of all the lanes
+  Vector3x8(const floatx8& x, const floatx8& y, const floatx8& z) 
+    :x(x), y(y), z(z)
+  {}
+
+  // Fills every lane with the given vector
+  Vector3x8(const Vector3& v) 
+    :x(v.x), y(v.y), z(v.z)
+  {}
+};
+
+// 4 `Quaternion`s, one in each lane
+struct Quaternionx4 {
+  floatx4 x, y, z, w;
+
+  // Default CTOR where every quaternion is `(0.0f, 0.0f, 0.0f, 1.0f)`
+  Quaternionx4() 
+    :x(0.0f), y(0.0f), z(0.0f), w(1.0f)
+  {}
+
+  // Takes the `x`, `y`, `z`, and `w` components of all the lanes
+  Quaternionx4(const floatx4& x, const floatx4& y, const floatx4& z, const floatx4& w) 
+    :x(x), y(y), z(z), w(w)
+  {}
+
+  // Fills every lane with the given quaternion
+  Quaternionx4(const Quaternion& q) 
+    :x(q.x), y(q.y), z(q.z), w(q.w)
+  {}
+};
+
+///////////////////////////////////////////////////////////////
+
+// floatx4 functions
+///////////////////////////////////////////////////////////////
+
+#ifdef SOC_SIMD_SSE
+
+SOC_INLINE const floatx4 operator+(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_add_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx4 operator-(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_sub_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx4 operator*(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_mul_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx4 operator/(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_div_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx4 operator-(const floatx4& a) {
+  return floatx4(_mm_xor_ps(a.simd, _mm_set1_ps(-0.0f)));
+}
+
+SOC_INLINE const maskx4 operator<(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmplt_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator<=(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmple_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator>(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmpgt_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator>=(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmpge_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator==(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmpeq_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator!=(const floatx4& a, const floatx4& b) {
+  return maskx4(_mm_cmpneq_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator&(const maskx4& a, const maskx4& b) {
+  return maskx4(_mm_and_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator|(const maskx4& a, const maskx4& b) {
+  return maskx4(_mm_or_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx4 operator~(const maskx4& a) {
+  return maskx4(_mm_xor_ps(a.simd, _mm_castsi128_ps(_mm_set1_epi32(-1))));
+}
+
+// Returns a bit mask with bit `i` set if lane `i` of `mask` is on
+SOC_INLINE const uint32 maskx4_bits(const maskx4& mask) {
+  return (uint32)_mm_movemask_ps(mask.simd);
+}
+
+// Returns the lanes of `a` where `mask` is on and the lanes of `b` everywhere else
+SOC_INLINE const floatx4 floatx4_select(const maskx4& mask, const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_or_ps(_mm_and_ps(mask.simd, a.simd), _mm_andnot_ps(mask.simd, b.simd)));
+}
+
+// Loads and returns 4 lanes from `values` (which does not have to be aligned)
+SOC_INLINE const floatx4 floatx4_load(const float32* values) {
+  return floatx4(_mm_loadu_ps(values));
+}
+
+// Stores the 4 lanes of `a` into `out_values` (which does not have to be aligned)
+SOC_INLINE void floatx4_store(const floatx4& a, float32* out_values) {
+  _mm_storeu_ps(out_values, a.simd);
+}
+
+// Square root of every lane of `a`
+SOC_INLINE const floatx4 floatx4_sqrt(const floatx4& a) {
+  return floatx4(_mm_sqrt_ps(a.simd));
+}
+
+// The same as `rsqrt_fast` but on every lane of `a`
+SOC_INLINE const floatx4 floatx4_rsqrt_fast(const floatx4& a) {
+  __m128 est    = _mm_rsqrt_ps(a.simd);
+  __m128 half_a = _mm_mul_ps(a.simd, _mm_set1_ps(0.5f));
+  __m128 muls   = _mm_mul_ps(_mm_mul_ps(half_a, est), est);
+
+  return floatx4(_mm_mul_ps(est, _mm_sub_ps(_mm_set1_ps(1.5f), muls)));
+}
+
+// Returns the smallest lanes between `a` and `b`
+SOC_INLINE const floatx4 floatx4_min(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_min_ps(a.simd, b.simd));
+}
+
+// Returns the biggest lanes between `a` and `b`
+SOC_INLINE const floatx4 floatx4_max(const floatx4& a, const floatx4& b) {
+  return floatx4(_mm_max_ps(a.simd, b.simd));
+}
+
+// Returns the absolute value of every lane of `a`
+SOC_INLINE const floatx4 floatx4_abs(const floatx4& a) {
+  return floatx4(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.simd));
+}
+
+// Returns the biggest whole number that is not bigger than every lane of `a`
+// NOTE: Unlike `std::floor`, this returns `+0` for `-0`, which keeps every code path exactly the same.
+SOC_INLINE const floatx4 floatx4_floor(const floatx4& a) {
+  __m128 whole = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.simd));
+  whole        = _mm_sub_ps(whole, _mm_and_ps(_mm_cmpgt_ps(whole, a.simd), _mm_set1_ps(1.0f)));
+
+  // Anything bigger than 2^23 is already whole (and might not fit in an `int32`)
+  __m128 is_small = _mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.simd), _mm_set1_ps(8388608.0f));
+  return floatx4(_mm_or_ps(_mm_and_ps(is_small, whole), _mm_andnot_ps(is_small, a.simd)));
+}
+
+// Returns every lane of `a` rounded towards zero
+// NOTE: Only works for `|a| < 2^31`, but it is a lot cheaper than `floor` when the lanes are known to be positive.
+SOC_INLINE const floatx4 floatx4_trunc(const floatx4& a) {
+  return floatx4(_mm_cvtepi32_ps(_mm_cvttps_epi32(a.simd)));
+}
+
+// The same as `sincos_fast` but on every lane of `x`
+SOC_INLINE void floatx4_sincos_fast(const floatx4& x, floatx4* out_sin, floatx4* out_cos) {
+  simd_sincos(x.simd, &out_sin->simd, &out_cos->simd);
+}
+
+#else
+
+SOC_INLINE const floatx4 operator+(const floatx4& a, const floatx4& b) {
+  return floatx4(a.lanes[0] + b.lanes[0], a.lanes[1] + b.lanes[1], a.lanes[2] + b.lanes[2], a.lanes[3] + b.lanes[3]);
+}
+
+SOC_INLINE const floatx4 operator-(const floatx4& a, const floatx4& b) {
+  return floatx4(a.lanes[0] - b.lanes[0], a.lanes[1] - b.lanes[1], a.lanes[2] - b.lanes[2], a.lanes[3] - b.lanes[3]);
+}
+
+SOC_INLINE const floatx4 operator*(const floatx4& a, const floatx4& b) {
+  return floatx4(a.lanes[0] * b.lanes[0], a.lanes[1] * b.lanes[1], a.lanes[2] * b.lanes[2], a.lanes[3] * b.lanes[3]);
+}
+
+SOC_INLINE const floatx4 operator/(const floatx4& a, const floatx4& b) {
+  return floatx4(a.lanes[0] / b.lanes[0], a.lanes[1] / b.lanes[1], a.lanes[2] / b.lanes[2], a.lanes[3] / b.lanes[3]);
+}
+
+SOC_INLINE const floatx4 operator-(const floatx4& a) {
+  return floatx4(-a.lanes[0], -a.lanes[1], -a.lanes[2], -a.lanes[3]);
+}
+
+// Returns a mask out of the 4 given comparison results
+SOC_INLINE const maskx4 maskx4_from_bools(const bool l0, const bool l1, const bool l2, const bool l3) {
+  maskx4 mask; 
+  mask.lanes[0] = l0 ? 0xffffffff : 0;
+  mask.lanes[1] = l1 ? 0xffffffff : 0;
+  mask.lanes[2] = l2 ? 0xffffffff : 0;
+  mask.lanes[3] = l3 ? 0xffffffff : 0;
+
+  return mask;
+}
+
+SOC_INLINE const maskx4 operator<(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] < b.lanes[0], a.lanes[1] < b.lanes[1], a.lanes[2] < b.lanes[2], a.lanes[3] < b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator<=(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] <= b.lanes[0], a.lanes[1] <= b.lanes[1], a.lanes[2] <= b.lanes[2], a.lanes[3] <= b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator>(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] > b.lanes[0], a.lanes[1] > b.lanes[1], a.lanes[2] > b.lanes[2], a.lanes[3] > b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator>=(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] >= b.lanes[0], a.lanes[1] >= b.lanes[1], a.lanes[2] >= b.lanes[2], a.lanes[3] >= b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator==(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] == b.lanes[0], a.lanes[1] == b.lanes[1], a.lanes[2] == b.lanes[2], a.lanes[3] == b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator!=(const floatx4& a, const floatx4& b) {
+  return maskx4_from_bools(a.lanes[0] != b.lanes[0], a.lanes[1] != b.lanes[1], a.lanes[2] != b.lanes[2], a.lanes[3] != b.lanes[3]);
+}
+
+SOC_INLINE const maskx4 operator&(const maskx4& a, const maskx4& b) {
+  maskx4 mask; 
+  for(uint32 i = 0; i < 4; i++) {
+    mask.lanes[i] = a.lanes[i] & b.lanes[i];
+  }
+
+  return mask;
+}
+
+SOC_INLINE const maskx4 operator|(const maskx4& a, const maskx4& b) {
+  maskx4 mask; 
+  for(uint32 i = 0; i < 4; i++) {
+    mask.lanes[i] = a.lanes[i] | b.lanes[i];
+  }
+
+  return mask;
+}
+
+SOC_INLINE const maskx4 operator~(const maskx4& a) {
+  maskx4 mask; 
+  for(uint32 i = 0; i < 4; i++) {
+    mask.lanes[i] = ~a.lanes[i];
+  }
+
+  return mask;
+}
+
+// Returns a bit mask with bit `i` set if lane `i` of `mask` is on
+SOC_INLINE const uint32 maskx4_bits(const maskx4& mask) {
+  return (mask.lanes[0] >> 31) | ((mask.lanes[1] >> 31) << 1) | ((mask.lanes[2] >> 31) << 2) | ((mask.lanes[3] >> 31) << 3);
+}
+
+// Returns the lanes of `a` where `mask` is on and the lanes of `b` everywhere else
+SOC_INLINE const floatx4 floatx4_select(const maskx4& mask, const floatx4& a, const floatx4& b) {
+  return floatx4(mask.lanes[0] ? a.lanes[0] : b.lanes[0], 
+                 mask.lanes[1] ? a.lanes[1] : b.lanes[1], 
+                 mask.lanes[2] ? a.lanes[2] : b.lanes[2], 
+                 mask.lanes[3] ? a.lanes[3] : b.lanes[3]);
+}
+
+// Loads and returns 4 lanes from `values` (which does not have to be aligned)
+SOC_INLINE const floatx4 floatx4_load(const float32* values) {
+  return floatx4(values[0], values[1], values[2], values[3]);
+}
+
+// Stores the 4 lanes of `a` into `out_values` (which does not have to be aligned)
+SOC_INLINE void floatx4_store(const floatx4& a, float32* out_values) {
+  std::memcpy(out_values, a.lanes, sizeof(a.lanes));
+}
+
+// Square root of every lane of `a`
+SOC_INLINE const floatx4 floatx4_sqrt(const floatx4& a) {
+  return floatx4(std::sqrt(a.lanes[0]), std::sqrt(a.lanes[1]), std::sqrt(a.lanes[2]), std::sqrt(a.lanes[3]));
+}
+
+// The same as `rsqrt_fast` but on every lane of `a`
+SOC_INLINE const floatx4 floatx4_rsqrt_fast(const floatx4& a) {
+  return floatx4(rsqrt_fast(a.lanes[0]), rsqrt_fast(a.lanes[1]), rsqrt_fast(a.lanes[2]), rsqrt_fast(a.lanes[3]));
+}
+
+// Returns the smallest lanes between `a` and `b`
+SOC_INLINE const floatx4 floatx4_min(const floatx4& a, const floatx4& b) {
+  return floatx4_select(a < b, a, b);
+}
+
+// Returns the biggest lanes between `a` and `b`
+SOC_INLINE const floatx4 floatx4_max(const floatx4& a, const floatx4& b) {
+  return floatx4_select(a > b, a, b);
+}
+
+// Returns the absolute value of every lane of `a`
+SOC_INLINE const floatx4 floatx4_abs(const floatx4& a) {
+  return floatx4(std::fabs(a.lanes[0]), std::fabs(a.lanes[1]), std::fabs(a.lanes[2]), std::fabs(a.lanes[3]));
+}
+
+// Returns the biggest whole number that is not bigger than every lane of `a`
+// NOTE: Unlike `std::floor`, this returns `+0` for `-0`, which keeps every code path exactly the same.
+SOC_INLINE const floatx4 floatx4_floor(const floatx4& a) {
+  floatx4 result; 
+
+  for(uint32 i = 0; i < 4; i++) {
+    // Anything bigger than 2^23 is already whole (and might not fit in an `int32`)
+    if(!(std::fabs(a.lanes[i]) < 8388608.0f)) {
+      result.lanes[i] = a.lanes[i];
+      continue;
+    }
+
+    float32 whole   = (float32)(int32)a.lanes[i];
+    result.lanes[i] = whole > a.lanes[i] ? whole - 1.0f : whole;
+  }
+
+  return result;
+}
+
+// Returns every lane of `a` rounded towards zero
+// NOTE: Only works for `|a| < 2^31`, but it is a lot cheaper than `floor` when the lanes are known to be positive.
+SOC_INLINE const floatx4 floatx4_trunc(const floatx4& a) {
+  return floatx4((float32)(int32)a.lanes[0], (float32)(int32)a.lanes[1], (float32)(int32)a.lanes[2], (float32)(int32)a.lanes[3]);
+}
+
+// The same as `sincos_fast` but on every lane of `x`
+SOC_INLINE void floatx4_sincos_fast(const floatx4& x, floatx4* out_sin, floatx4* out_cos) {
+  for(uint32 i = 0; i < 4; i++) {
+    Vector2 sin_cos     = sincos_fast(x.lanes[i]);
+    out_sin->lanes[i]   = sin_cos.x;
+    out_cos->lanes[i]   = sin_cos.y;
+  }
+}
+
+#endif
+
+// Returns true if any lane of `mask` is on
+SOC_INLINE const bool maskx4_any(const maskx4& mask) {
+  return maskx4_bits(mask) != 0;
+}
+
+// Returns true if every lane of `mask` is on
+SOC_INLINE const bool maskx4_all(const maskx4& mask) {
+  return maskx4_bits(mask) == 0xf;
+}
+
+// Returns every lane of `value` between `min` and `max`
+SOC_INLINE const floatx4 floatx4_clamp(const floatx4& value, const floatx4& min, const floatx4& max) {
+  return floatx4_min(floatx4_max(value, min), max);
+}
+
+// Returns the linear interpolation of every lane with the given `start`, `end`, and `amount` 
+SOC_INLINE const floatx4 floatx4_lerp(const floatx4& start, const floatx4& end, const floatx4& amount) {
+  return start + amount * (end - start);
+}
+
+///////////////////////////////////////////////////////////////
+
+// floatx8 functions
+///////////////////////////////////////////////////////////////
+
+#ifdef SOC_SIMD_AVX
+
+SOC_INLINE const floatx8 operator+(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_add_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx8 operator-(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_sub_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx8 operator*(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_mul_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx8 operator/(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_div_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const floatx8 operator-(const floatx8& a) {
+  return floatx8(_mm256_xor_ps(a.simd, _mm256_set1_ps(-0.0f)));
+}
+
+SOC_INLINE const maskx8 operator<(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_LT_OQ));
+}
+
+SOC_INLINE const maskx8 operator<=(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_LE_OQ));
+}
+
+SOC_INLINE const maskx8 operator>(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_GT_OQ));
+}
+
+SOC_INLINE const maskx8 operator>=(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_GE_OQ));
+}
+
+SOC_INLINE const maskx8 operator==(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_EQ_OQ));
+}
+
+SOC_INLINE const maskx8 operator!=(const floatx8& a, const floatx8& b) {
+  return maskx8(_mm256_cmp_ps(a.simd, b.simd, _CMP_NEQ_UQ));
+}
+
+SOC_INLINE const maskx8 operator&(const maskx8& a, const maskx8& b) {
+  return maskx8(_mm256_and_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx8 operator|(const maskx8& a, const maskx8& b) {
+  return maskx8(_mm256_or_ps(a.simd, b.simd));
+}
+
+SOC_INLINE const maskx8 operator~(const maskx8& a) {
+  return maskx8(_mm256_xor_ps(a.simd, _mm256_castsi256_ps(_mm256_set1_epi32(-1))));
+}
+
+// Returns a bit mask with bit `i` set if lane `i` of `mask` is on
+SOC_INLINE const uint32 maskx8_bits(const maskx8& mask) {
+  return (uint32)_mm256_movemask_ps(mask.simd);
+}
+
+// Returns the lanes of `a` where `mask` is on and the lanes of `b` everywhere else
+// NOTE: This does not use `_mm256_blendv_ps`, since GCC turns it into a branch for every lane when it only targets AVX.
+SOC_INLINE const floatx8 floatx8_select(const maskx8& mask, const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_or_ps(_mm256_and_ps(mask.simd, a.simd), _mm256_andnot_ps(mask.simd, b.simd)));
+}
+
+// Loads and returns 8 lanes from `values` (which does not have to be aligned)
+SOC_INLINE const floatx8 floatx8_load(const float32* values) {
+  return floatx8(_mm256_loadu_ps(values));
+}
+
+// Stores the 8 lanes of `a` into `out_values` (which does not have to be aligned)
+SOC_INLINE void floatx8_store(const floatx8& a, float32* out_values) {
+  _mm256_storeu_ps(out_values, a.simd);
+}
+
+// Square root of every lane of `a`
+SOC_INLINE const floatx8 floatx8_sqrt(const floatx8& a) {
+  return floatx8(_mm256_sqrt_ps(a.simd));
+}
+
+// The same as `rsqrt_fast` but on every lane of `a`
+SOC_INLINE const floatx8 floatx8_rsqrt_fast(const floatx8& a) {
+  __m256 est    = _mm256_rsqrt_ps(a.simd);
+  __m256 half_a = _mm256_mul_ps(a.simd, _mm256_set1_ps(0.5f));
+  __m256 muls   = _mm256_mul_ps(_mm256_mul_ps(half_a, est), est);
+
+  return floatx8(_mm256_mul_ps(est, _mm256_sub_ps(_mm256_set1_ps(1.5f), muls)));
+}
+
+// Returns the smallest lanes between `a` and `b`
+SOC_INLINE const floatx8 floatx8_min(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_min_ps(a.simd, b.simd));
+}
+
+// Returns the biggest lanes between `a` and `b`
+SOC_INLINE const floatx8 floatx8_max(const floatx8& a, const floatx8& b) {
+  return floatx8(_mm256_max_ps(a.simd, b.simd));
+}
+
+// Returns the absolute value of every lane of `a`
+SOC_INLINE const floatx8 floatx8_abs(const floatx8& a) {
+  return floatx8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.simd));
+}
+
+// Returns the biggest whole number that is not bigger than every lane of `a`
+// NOTE: Unlike `std::floor`, this returns `+0` for `-0`, which keeps every code path exactly the same.
+SOC_INLINE const floatx8 floatx8_floor(const floatx8& a) {
+  __m256 whole = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(a.simd));
+  whole        = _mm256_sub_ps(whole, _mm256_and_ps(_mm256_cmp_ps(whole, a.simd, _CMP_GT_OQ), _mm256_set1_ps(1.0f)));
+
+  // Anything bigger than 2^23 is already whole (and might not fit in an `int32`)
+  __m256 is_small = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.simd), _mm256_set1_ps(8388608.0f), _CMP_LT_OQ);
+  return floatx8(_mm256_or_ps(_mm256_and_ps(is_small, whole), _mm256_andnot_ps(is_small, a.simd)));
+}
+
+// Returns every lane of `a` rounded towards zero
+// NOTE: Only works for `|a| < 2^31`, but it is a lot cheaper than `floor` when the lanes are known to be positive.
+SOC_INLINE const floatx8 floatx8_trunc(const floatx8& a) {
+  return floatx8(_mm256_cvtepi32_ps(_mm256_cvttps_epi32(a.simd)));
+}
+
+// The same as `sincos_fast` but on every lane of `x`
+SOC_INLINE void floatx8_sincos_fast(const floatx8& x, floatx8* out_sin, floatx8* out_cos) {
+  __m128 sin_low, cos_low, sin_high, cos_high; 
+  simd_sincos(_mm256_castps256_ps128(x.simd), &sin_low, &cos_low);
+  simd_sincos(_mm256_extractf128_ps(x.simd, 1), &sin_high, &cos_high);
+
+  out_sin->simd = _mm256_insertf128_ps(_mm256_castps128_ps256(sin_low), sin_high, 1);
+  out_cos->simd = _mm256_insertf128_ps(_mm256_castps128_ps256(cos_low), cos_high, 1);
+}
+
+#else
+
+SOC_INLINE const floatx8 operator+(const floatx8& a, const floatx8& b) {
+  return floatx8(a.halves[0] + b.halves[0], a.halves[1] + b.halves[1]);
+}
+
+SOC_INLINE const floatx8 operator-(const floatx8& a, const floatx8& b) {
+  return floatx8(a.halves[0] - b.halves[0], a.halves[1] - b.halves[1]);
+}
+
+SOC_INLINE const floatx8 operator*(const floatx8& a, const floatx8& b) {
+  return floatx8(a.halves[0] * b.halves[0], a.halves[1] * b.halves[1]);
+}
+
+SOC_INLINE const floatx8 operator/(const floatx8& a, const floatx8& b) {
+  return floatx8(a.halves[0] / b.halves[0], a.halves[1] / b.halves[1]);
+}
+
+SOC_INLINE const floatx8 operator-(const floatx8& a) {
+  return floatx8(-a.halves[0], -a.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator<(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] < b.halves[0], a.halves[1] < b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator<=(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] <= b.halves[0], a.halves[1] <= b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator>(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] > b.halves[0], a.halves[1] > b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator>=(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] >= b.halves[0], a.halves[1] >= b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator==(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] == b.halves[0], a.halves[1] == b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator!=(const floatx8& a, const floatx8& b) {
+  return maskx8(a.halves[0] != b.halves[0], a.halves[1] != b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator&(const maskx8& a, const maskx8& b) {
+  return maskx8(a.halves[0] & b.halves[0], a.halves[1] & b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator|(const maskx8& a, const maskx8& b) {
+  return maskx8(a.halves[0] | b.halves[0], a.halves[1] | b.halves[1]);
+}
+
+SOC_INLINE const maskx8 operator~(const maskx8& a) {
+  return maskx8(~a.halves[0], ~a.halves[1]);
+}
+
+// Returns a bit mask with bit `i` set if lane `i` of `mask` is on
+SOC_INLINE const uint32 maskx8_bits(const maskx8& mask) {
+  return maskx4_bits(mask.halves[0]) | (maskx4_bits(mask.halves[1]) << 4);
+}
+
+// Returns the lanes of `a` where `mask` is on and the lanes of `b` everywhere else
+SOC_INLINE const floatx8 floatx8_select(const maskx8& mask, const floatx8& a, const floatx8& b) {
+  return floatx8(floatx4_select(mask.halves[0], a.halves[0], b.halves[0]), floatx4_select(mask.halves[1], a.halves[1], b.halves[1]));
+}
+
+// Loads and returns 8 lanes from `values` (which does not have to be aligned)
+SOC_INLINE const floatx8 floatx8_load(const float32* values) {
+  return floatx8(floatx4_load(values), floatx4_load(values + 4));
+}
+
+// Stores the 8 lanes of `a` into `out_values` (which does not have to be aligned)
+SOC_INLINE void floatx8_store(const floatx8& a, float32* out_values) {
+  floatx4_store(a.halves[0], out_values);
+  floatx4_store(a.halves[1], out_values + 4);
+}
+
+// Square root of every lane of `a`
+SOC_INLINE const floatx8 floatx8_sqrt(const floatx8& a) {
+  return floatx8(floatx4_sqrt(a.halves[0]), floatx4_sqrt(a.halves[1]));
+}
+
+// The same as `rsqrt_fast` but on every lane of `a`
+SOC_INLINE const floatx8 floatx8_rsqrt_fast(const floatx8& a) {
+  return floatx8(floatx4_rsqrt_fast(a.halves[0]), floatx4_rsqrt_fast(a.halves[1]));
+}
+
+// Returns the smallest lanes between `a` and `b`
+SOC_INLINE const floatx8 floatx8_min(const floatx8& a, const floatx8& b) {
+  return floatx8(floatx4_min(a.halves[0], b.halves[0]), floatx4_min(a.halves[1], b.halves[1]));
+}
+
+// Returns the biggest lanes between `a` and `b`
+SOC_INLINE const floatx8 floatx8_max(const floatx8& a, const floatx8& b) {
+  return floatx8(floatx4_max(a.halves[0], b.halves[0]), floatx4_max(a.halves[1], b.halves[1]));
+}
+
+// Returns the absolute value of every lane of `a`
+SOC_INLINE const floatx8 floatx8_abs(const floatx8& a) {
+  return floatx8(floatx4_abs(a.halves[0]), floatx4_abs(a.halves[1]));
+}
+
+// Returns the biggest whole number that is not bigger than every lane of `a`
+// NOTE: Unlike `std::floor`, this returns `+0` for `-0`, which keeps every code path exactly the same.
+SOC_INLINE const floatx8 floatx8_floor(const floatx8& a) {
+  return floatx8(floatx4_floor(a.halves[0]), floatx4_floor(a.halves[1]));
+}
+
+// Returns every lane of `a` rounded towards zero
+// NOTE: Only works for `|a| < 2^31`, but it is a lot cheaper than `floor` when the lanes are known to be positive.
+SOC_INLINE const floatx8 floatx8_trunc(const floatx8& a) {
+  return floatx8(floatx4_trunc(a.halves[0]), floatx4_trunc(a.halves[1]));
+}
+
+// The same as `sincos_fast` but on every lane of `x`
+SOC_INLINE void floatx8_sincos_fast(const floatx8& x, floatx8* out_sin, floatx8* out_cos) {
+  floatx4_sincos_fast(x.halves[0], &out_sin->halves[0], &out_cos->halves[0]);
+  floatx4_sincos_fast(x.halves[1], &out_sin->halves[1], &out_cos->halves[1]);
+}
+
+#endif
+
+// Returns true if any lane of `mask` is on
+SOC_INLINE const bool maskx8_any(const maskx8& mask) {
+  return maskx8_bits(mask) != 0;
+}
+
+// Returns true if every lane of `mask` is on
+SOC_INLINE const bool maskx8_all(const maskx8& mask) {
+  return maskx8_bits(mask) == 0xff;
+}
+
+// Returns every lane of `value` between `min` and `max`
+SOC_INLINE const floatx8 floatx8_clamp(const floatx8& value, const floatx8& min, const floatx8& max) {
+  return floatx8_min(floatx8_max(value, min), max);
+}
+
+// Returns the linear interpolation of every lane with the given `start`, `end`, and `amount` 
+SOC_INLINE const floatx8 floatx8_lerp(const floatx8& start, const floatx8& end, const floatx8& amount) {
+  return start + amount * (end - start);
+}
+
+///////////////////////////////////////////////////////////////
+
+// Vector3x4 functions
+///////////////////////////////////////////////////////////////
+
+SOC_INLINE const Vector3x4 operator+(const Vector3x4& v1, const Vector3x4& v2) {
+  return Vector3x4(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+}
+
+SOC_INLINE const Vector3x4 operator-(const Vector3x4& v1, const Vector3x4& v2) {
+  return Vector3x4(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+}
+
+SOC_INLINE const Vector3x4 operator*(const Vector3x4& v1, const Vector3x4& v2) {
+  return Vector3x4(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+SOC_INLINE const Vector3x4 operator*(const Vector3x4& v, const floatx4& s) {
+  return Vector3x4(v.x * s, v.y * s, v.z * s);
+}
+
+SOC_INLINE const Vector3x4 operator/(const Vector3x4& v1, const Vector3x4& v2) {
+  return Vector3x4(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
+}
+
+SOC_INLINE const Vector3x4 operator/(const Vector3x4& v, const floatx4& s) {
+  return Vector3x4(v.x / s, v.y / s, v.z / s);
+}
+
+SOC_INLINE const Vector3x4 operator-(const Vector3x4& v) {
+  return Vector3x4(-v.x, -v.y, -v.z);
+}
+
+// Loads and returns 4 `vectors` (from AoS to SoA)
+SOC_INLINE const Vector3x4 vec3x4_load(const Vector3* vectors) {
+#ifdef SOC_SIMD_SSE
+  Vector3x4 v; 
+  simd_gather_vec3(Vector3View((void*)vectors, sizeof(Vector3), 4), 0, &v.x.simd, &v.y.simd, &v.z.simd);
+
+  return v;
+#else
+  return Vector3x4(floatx4(vectors[0].x, vectors[1].x, vectors[2].x, vectors[3].x), 
+                   floatx4(vectors[0].y, vectors[1].y, vectors[2].y, vectors[3].y), 
+                   floatx4(vectors[0].z, vectors[1].z, vectors[2].z, vectors[3].z));
+#endif
+}
+
+// Stores the 4 vectors of `v` into `out_vectors` (from SoA to AoS)
+SOC_INLINE void vec3x4_store(const Vector3x4& v, Vector3* out_vectors) {
+#ifdef SOC_SIMD_SSE
+  simd_scatter_vec3(Vector3View(out_vectors, sizeof(Vector3), 4), 0, v.x.simd, v.y.simd, v.z.simd);
+#else
+  for(uint32 i = 0; i < 4; i++) {
+    out_vectors[i] = Vector3(v.x.lanes[i], v.y.lanes[i], v.z.lanes[i]);
+  }
+#endif
+}
+
+// Returns the vector in the given `lane` of `v`
+SOC_INLINE const Vector3 vec3x4_get(const Vector3x4& v, const uint32 lane) {
+  return Vector3(v.x.lanes[lane], v.y.lanes[lane], v.z.lanes[lane]);
+}
+
+// Returns the vectors of `a` where `mask` is on and the vectors of `b` everywhere else
+SOC_INLINE const Vector3x4 vec3x4_select(const maskx4& mask, const Vector3x4& a, const Vector3x4& b) {
+  return Vector3x4(floatx4_select(mask, a.x, b.x), floatx4_select(mask, a.y, b.y), floatx4_select(mask, a.z, b.z));
+}
+
+// Returns the dot products of `v1` and `v2` 
+SOC_INLINE const floatx4 vec3x4_dot(const Vector3x4& v1, const Vector3x4& v2) {
+  return (v1.x * v2.x) + (v1.y * v2.y) + (v1.z * v2.z);
+}
+
+// Returns the lengths/magnitudes of `v`
+SOC_INLINE const floatx4 vec3x4_length(const Vector3x4& v) {
+  return floatx4_sqrt(vec3x4_dot(v, v));
+}
+
+// Returns the normalized versions of the vectors `v`
+SOC_INLINE const Vector3x4 vec3x4_normalize(const Vector3x4& v) {
+  return v / vec3x4_length(v);
+}
+
+// The same as `vec3x4_normalize` but uses `floatx4_rsqrt_fast` instead of a square root and a division
+SOC_INLINE const Vector3x4 vec3x4_normalize_fast(const Vector3x4& v) {
+  return v * floatx4_rsqrt_fast(vec3x4_dot(v, v));
+}
+
+// Returns the cross products of `v1` and `v2`
+SOC_INLINE const Vector3x4 vec3x4_cross(const Vector3x4& v1, const Vector3x4& v2) {
+  return Vector3x4((v1.y * v2.z) - (v1.z * v2.y), 
+                   (v1.z * v2.x) - (v1.x * v2.z), 
+                   (v1.x * v2.y) - (v1.y * v2.x));
+}
+
+// Returns the distances between `v1` and `v2` 
+SOC_INLINE const floatx4 vec3x4_distance(const Vector3x4& v1, const Vector3x4& v2) {
+  return vec3x4_length(v2 - v1);
+}
+
+// Returns the linear interpolations between `start` and `end` by `amount` 
+SOC_INLINE const Vector3x4 vec3x4_lerp(const Vector3x4& start, const Vector3x4& end, const floatx4& amount) {
+  return Vector3x4(floatx4_lerp(start.x, end.x, amount), floatx4_lerp(start.y, end.y, amount), floatx4_lerp(start.z, end.z, amount));
+}
+
+///////////////////////////////////////////////////////////////
+
+// Vector3x8 functions
+///////////////////////////////////////////////////////////////
+
+SOC_INLINE const Vector3x8 operator+(const Vector3x8& v1, const Vector3x8& v2) {
+  return Vector3x8(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+}
+
+SOC_INLINE const Vector3x8 operator-(const Vector3x8& v1, const Vector3x8& v2) {
+  return Vector3x8(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+}
+
+SOC_INLINE const Vector3x8 operator*(const Vector3x8& v1, const Vector3x8& v2) {
+  return Vector3x8(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+SOC_INLINE const Vector3x8 operator*(const Vector3x8& v, const floatx8& s) {
+  return Vector3x8(v.x * s, v.y * s, v.z * s);
+}
+
+SOC_INLINE const Vector3x8 operator/(const Vector3x8& v1, const Vector3x8& v2) {
+  return Vector3x8(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
+}
+
+SOC_INLINE const Vector3x8 operator/(const Vector3x8& v, const floatx8& s) {
+  return Vector3x8(v.x / s, v.y / s, v.z / s);
+}
+
+SOC_INLINE const Vector3x8 operator-(const Vector3x8& v) {
+  return Vector3x8(-v.x, -v.y, -v.z);
+}
+
+// Loads and returns 8 `vectors` (from AoS to SoA)
+SOC_INLINE const Vector3x8 vec3x8_load(const Vector3* vectors) {
+  Vector3x4 low  = vec3x4_load(vectors);
+  Vector3x4 high = vec3x4_load(vectors + 4);
+
+#ifdef SOC_SIMD_AVX
+  return Vector3x8(floatx8(_mm256_insertf128_ps(_mm256_castps128_ps256(low.x.simd), high.x.simd, 1)), 
+                   floatx8(_mm256_insertf128_ps(_mm256_castps128_ps256(low.y.simd), high.y.simd, 1)), 
+                   floatx8(_mm256_insertf128_ps(_mm256_castps128_ps256(low.z.simd), high.z.simd, 1)));
+#else
+  return Vector3x8(floatx8(low.x, high.x), floatx8(low.y, high.y), floatx8(low.z, high.z));
+#endif
+}
+
+// Stores the 8 vectors of `v` into `out_vectors` (from SoA to AoS)
+SOC_INLINE void vec3x8_store(const Vector3x8& v, Vector3* out_vectors) {
+#ifdef SOC_SIMD_AVX
+  vec3x4_store(Vector3x4(floatx4(_mm256_castps256_ps128(v.x.simd)), floatx4(_mm256_castps256_ps128(v.y.simd)), floatx4(_mm256_castps256_ps128(v.z.simd))), out_vectors);
+  vec3x4_store(Vector3x4(floatx4(_mm256_extractf128_ps(v.x.simd, 1)), floatx4(_mm256_extractf128_ps(v.y.simd, 1)), floatx4(_mm256_extractf128_ps(v.z.simd, 1))), out_vectors + 4);
+#else
+  vec3x4_store(Vector3x4(v.x.halves[0], v.y.halves[0], v.z.halves[0]), out_vectors);
+  vec3x4_store(Vector3x4(v.x.halves[1], v.y.halves[1], v.z.halves[1]), out_vectors + 4);
+#endif
+}
+
+// Returns the vector in the given `lane` of `v`
+SOC_INLINE const Vector3 vec3x8_get(const Vector3x8& v, const uint32 lane) {
+  return Vector3(v.x.lanes[lane], v.y.lanes[lane], v.z.lanes[lane]);
+}
+
+// Returns the vectors of `a` where `mask` is on and the vectors of `b` everywhere else
+SOC_INLINE const Vector3x8 vec3x8_select(const maskx8& mask, const Vector3x8& a, const Vector3x8& b) {
+  return Vector3x8(floatx8_select(mask, a.x, b.x), floatx8_select(mask, a.y, b.y), floatx8_select(mask, a.z, b.z));
+}
+
+// Returns the dot products of `v1` and `v2` 
+SOC_INLINE const floatx8 vec3x8_dot(const Vector3x8& v1, const Vector3x8& v2) {
+  return (v1.x * v2.x) + (v1.y * v2.y) + (v1.z * v2.z);
+}
+
+// Returns the lengths/magnitudes of `v`
+SOC_INLINE const floatx8 vec3x8_length(const Vector3x8& v) {
+  return floatx8_sqrt(vec3x8_dot(v, v));
+}
+
+// Returns the normalized versions of the vectors `v`
+SOC_INLINE const Vector3x8 vec3x8_normalize(const Vector3x8& v) {
+  return v / vec3x8_length(v);
+}
+
+// The same as `vec3x8_normalize` but uses `floatx8_rsqrt_fast` instead of a square root and a division
+SOC_INLINE const Vector3x8 vec3x8_normalize_fast(const Vector3x8& v) {
+  return v * floatx8_rsqrt_fast(vec3x8_dot(v, v));
+}
+
+// Returns the cross products of `v1` and `v2`
+SOC_INLINE const Vector3x8 vec3x8_cross(const Vector3x8& v1, const Vector3x8& v2) {
+  return Vector3x8((v1.y * v2.z) - (v1.z * v2.y), 
+                   (v1.z * v2.x) - (v1.x * v2.z), 
+                   (v1.x * v2.y) - (v1.y * v2.x));
+}
+
+// Returns the distances between `v1` and `v2` 
+SOC_INLINE const floatx8 vec3x8_distance(const Vector3x8& v1, const Vector3x8& v2) {
+  return vec3x8_length(v2 - v1);
+}
+
+// Returns the linear interpolations between `start` and `end` by `amount` 
+SOC_INLINE const Vector3x8 vec3x8_lerp(const Vector3x8& start, const Vector3x8& end, const floatx8& amount) {
+  return Vector3x8(floatx8_lerp(start.x, end.x, amount), floatx8_lerp(start.y, end.y, amount), floatx8_lerp(start.z, end.z, amount));
+}
+
+///////////////////////////////////////////////////////////////
+
+// Quaternionx4 functions
+///////////////////////////////////////////////////////////////
+
+SOC_INLINE const Quaternionx4 operator*(const Quaternionx4& q1, const Quaternionx4& q2) {
+  return Quaternionx4(q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y, 
+                      q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x, 
+                      q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w, 
+                      q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z);
+}
+
+SOC_INLINE const Quaternionx4 operator*(const Quaternionx4& q, const floatx4& s) {
+  return Quaternionx4(q.x * s, q.y * s, q.z * s, q.w * s);
+}
+
+// Loads and returns 4 `quaternions` (from AoS to SoA)
+SOC_INLINE const Quaternionx4 quatx4_load(const Quaternion* quaternions) {
+#ifdef SOC_SIMD_SSE
+  Quaternionx4 q; 
+  simd_gather_vec4(Vector4View((void*)quaternions, sizeof(Quaternion), 4), 0, &q.x.simd, &q.y.simd, &q.z.simd, &q.w.simd);
+
+  return q;
+#else
+  return Quaternionx4(floatx4(quaternions[0].x, quaternions[1].x, quaternions[2].x, quaternions[3].x), 
+                      floatx4(quaternions[0].y, quaternions[1].y, quaternions[2].y, quaternions[3].y), 
+                      floatx4(quaternions[0].z, quaternions[1].z, quaternions[2].z, quaternions[3].z), 
+                      floatx4(quaternions[0].w, quaternions[1].w, quaternions[2].w, quaternions[3].w));
+#endif
+}
+
+// Stores the 4 quaternions of `q` into `out_quaternions` (from SoA to AoS)
+SOC_INLINE void quatx4_store(const Quaternionx4& q, Quaternion* out_quaternions) {
+#ifdef SOC_SIMD_SSE
+  simd_scatter_vec4(Vector4View(out_quaternions, sizeof(Quaternion), 4), 0, q.x.simd, q.y.simd, q.z.simd, q.w.simd);
+#else
+  for(uint32 i = 0; i < 4; i++) {
+    out_quaternions[i] = Quaternion(q.x.lanes[i], q.y.lanes[i], q.z.lanes[i], q.w.lanes[i]);
+  }
+#endif
+}
+
+// Returns the quaternion in the given `lane` of `q`
+SOC_INLINE const Quaternion quatx4_get(const Quaternionx4& q, const uint32 lane) {
+  return Quaternion(q.x.lanes[lane], q.y.lanes[lane], q.z.lanes[lane], q.w.lanes[lane]);
+}
+
+// Returns the quaternions of `a` where `mask` is on and the quaternions of `b` everywhere else
+SOC_INLINE const Quaternionx4 quatx4_select(const maskx4& mask, const Quaternionx4& a, const Quaternionx4& b) {
+  return Quaternionx4(floatx4_select(mask, a.x, b.x), 
+                      floatx4_select(mask, a.y, b.y), 
+                      floatx4_select(mask, a.z, b.z), 
+                      floatx4_select(mask, a.w, b.w));
+}
+
+// Returns the dot products of `q1` and `q2` 
+SOC_INLINE const floatx4 quatx4_dot(const Quaternionx4& q1, const Quaternionx4& q2) {
+  return (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z) + (q1.w * q2.w);
+}
+
+// Returns the lengths/magnitudes of `q`
+SOC_INLINE const floatx4 quatx4_length(const Quaternionx4& q) {
+  return floatx4_sqrt(quatx4_dot(q, q));
+}
+
+// Returns the normalized versions of the quaternions `q`
+SOC_INLINE const Quaternionx4 quatx4_normalize(const Quaternionx4& q) {
+  return q * (floatx4(1.0f) / quatx4_length(q));
+}
+
+// Returns the normalized linear interpolations between `start` and `end` by `amount` (see `quat_nlerp`)
+SOC_INLINE const Quaternionx4 quatx4_nlerp(const Quaternionx4& start, const Quaternionx4& end, const floatx4& amount) {
+  floatx4 sign = floatx4_select(quatx4_dot(start, end) < floatx4(0.0f), floatx4(-1.0f), floatx4(1.0f));
+
+  Quaternionx4 q(floatx4_lerp(start.x, end.x * sign, amount), 
+                 floatx4_lerp(start.y, end.y * sign, amount), 
+                 floatx4_lerp(start.z, end.z * sign, amount), 
+                 floatx4_lerp(start.w, end.w * sign, amount));
+
+  return quatx4_normalize(q);
+}
+
+// Returns the vectors `v` rotated by the quaternions `q` (the same as `quat_rotate_vec3` on every lane)
+SOC_FP_STRICT_BEGIN
+SOC_INLINE const Vector3x4 quatx4_rotate_vec3x4(const Quaternionx4& q, const Vector3x4& v) {
+  // Written out for the same reason as `quat_rotate_vec3`
+  floatx4 two(2.0f);
+  floatx4 tx = ((q.y * v.z) - (q.z * v.y)) * two;
+  floatx4 ty = ((q.z * v.x) - (q.x * v.z)) * two;
+  floatx4 tz = ((q.x * v.y) - (q.y * v.x)) * two;
+
+  return Vector3x4(v.x + (tx * q.w) + ((q.y * tz) - (q.z * ty)), 
+                   v.y + (ty * q.w) + ((q.z * tx) - (q.x * tz)), 
+                   v.z + (tz * q.w) + ((q.x * ty) - (q.y * tx)));
+}
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Transform types
+///////////////////////////////////////////////////////////////
+
+// A transformation split into its translation, rotation, and scale (applied as scale, then rotation, then translation)
+struct Transform {
+  Vector3 translation; 
+  Quaternion rotation;
+  Vector3 scale;
+
+  // Default CTOR where the transform does nothing
+  Transform() 
+    :translation(0.0f), rotation(), scale(1.0f)
+  {}
+
+  // Takes the `translation`, `rotation`, and `scale` of the transform
+  Transform(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) 
+    :translation(translation), rotation(rotation), scale(scale)
+  {}
+};
+
+///////////////////////////////////////////////////////////////
+
+// Transform functions
+///////////////////////////////////////////////////////////////
+
+// Returns the matrix of the given `transform` (the same as `translate * rotate * scale`)
+SOC_INLINE const Matrix4 mat4_compose(const Transform& transform) {
+  Matrix3 rot = quat_get_mat3(transform.rotation);
+
+  return Matrix4(Vector4(Vector3(rot[0], rot[1], rot[2]) * transform.scale.x, 0.0f), 
+                 Vector4(Vector3(rot[3], rot[4], rot[5]) * transform.scale.y, 0.0f), 
+                 Vector4(Vector3(rot[6], rot[7], rot[8]) * transform.scale.z, 0.0f), 
+                 Vector4(transform.translation, 1.0f));
+}
+
+// NOTE: The decompositions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so that 
+// `mat4_decompose_batch` gives the exact same results as `mat4_decompose` in every build.
+SOC_FP_STRICT_BEGIN
+
+// Splits the affine matrix `m` into its translation, rotation, and scale
+// NOTE: The scale is the length of each column of `m`, with the `x` scale negated if `m` mirrors. 
+// The rotation comes from the columns divided by the scale (using `quat_set_mat3_fast`), so it is only a proper 
+// rotation if `m` has no shear. Use `mat4_decompose_polar` instead for matrices that might be sheared.
+SOC_INLINE const Transform mat4_decompose(const Matrix4& m) {
+  Vector3 c0(m[0], m[1], m[2]);
+  Vector3 c1(m[4], m[5], m[6]);
+  Vector3 c2(m[8], m[9], m[10]);
+
+  Vector3 scale(vec3_length(c0), vec3_length(c1), vec3_length(c2));
+  scale.x = vec3_dot(c0, vec3_cross(c1, c2)) < 0.0f ? -scale.x : scale.x;
+
+  // A zero scale leaves its column as it is to not divide by zero
+  Matrix3 rot(c0 / (scale.x != 0.0f ? scale.x : 1.0f), 
+              c1 / (scale.y != 0.0f ? scale.y : 1.0f), 
+              c2 / (scale.z != 0.0f ? scale.z : 1.0f));
+
+  return Transform(Vector3(m[12], m[13], m[14]), quat_set_mat3_fast(rot), scale);
+}
+
+// The same as `mat4_decompose` but finds the rotation with a polar decomposition, which makes it 
+// tolerant of shear (like the kind non-uniform scales on parents leave behind)
+// NOTE: The rotation is the closest proper rotation to the upper 3x3 of `m`, found with Higham's scaled Newton iteration 
+// (usually 5 to 8 iterations), and the scale is the diagonal of the stretch left after taking that rotation out. 
+// Any shear in `m` is dropped. Singular matrices fall back to `mat4_decompose`.
+SOC_API const Transform mat4_decompose_polar(const Matrix4& m);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Transform mat4_decompose_polar(const Matrix4& m) {
+  Vector3 c0(m[0], m[1], m[2]);
+  Vector3 c1(m[4], m[5], m[6]);
+  Vector3 c2(m[8], m[9], m[10]);
+
+  float32 det = vec3_dot(c0, vec3_cross(c1, c2));
+  if(det == 0.0f) {
+    return mat4_decompose(m);
+  }
+
+  // Taking out the reflection first so the iteration converges to a proper rotation
+  float32 flip = det < 0.0f ? -1.0f : 1.0f;
+  c0           = c0 * flip;
+
+  Vector3 r0 = c0; 
+  Vector3 r1 = c1; 
+  Vector3 r2 = c2;
+
+  for(uint32 i = 0; i < 20; i++) {
+    // The inverse transpose of `r` is its cofactor matrix divided by its determinant 
+    Vector3 i0 = vec3_cross(r1, r2);
+    Vector3 i1 = vec3_cross(r2, r0);
+    Vector3 i2 = vec3_cross(r0, r1);
+
+    float32 inv_det = 1.0f / vec3_dot(r0, i0);
+    i0 = i0 * inv_det; 
+    i1 = i1 * inv_det; 
+    i2 = i2 * inv_det; 
+
+    // Scaling by the ratio of the Frobenius norms speeds up the first iterations by a lot
+    float32 norm_r = vec3_dot(r0, r0) + vec3_dot(r1, r1) + vec3_dot(r2, r2);
+    float32 norm_i = vec3_dot(i0, i0) + vec3_dot(i1, i1) + vec3_dot(i2, i2);
+    float32 gamma  = std::sqrt(std::sqrt(norm_i / norm_r));
+
+    Vector3 n0 = ((r0 * gamma) + (i0 / gamma)) * 0.5f;
+    Vector3 n1 = ((r1 * gamma) + (i1 / gamma)) * 0.5f;
+    Vector3 n2 = ((r2 * gamma) + (i2 / gamma)) * 0.5f;
+
+    float32 change = vec3_dot(n0 - r0, n0 - r0) + vec3_dot(n1 - r1, n1 - r1) + vec3_dot(n2 - r2, n2 - r2);
+
+    r0 = n0; 
+    r1 = n1; 
+    r2 = n2;
+
+    if(change < 1e-12f) {
+      break;
+    }
+  }
+
+  // The stretch is `transpose(r) * c`, and its diagonal is the scale
+  Vector3 scale(vec3_dot(r0, c0) * flip, vec3_dot(r1, c1), vec3_dot(r2, c2));
+
+  return Transform(Vector3(m[12], m[13], m[14]), quat_set_mat3(Matrix3(r0, r1, r2)), scale);
+}
+#endif
+
+// Splits `count` affine `matrices` into their translations, rotations, and scales and writes them into the 
+// given SoA arrays (which need at least `count` entries each), the same way `mat4_decompose` does
+// NOTE: 4 matrices are decomposed at a time with no branches at all, and the results are exactly the same as `mat4_decompose`.
+SOC_API void mat4_decompose_batch(const Matrix4* matrices, 
+                                  const uint32 count, 
+                                  const Vector3SoA& out_translations, 
+                                  const QuaternionSoA& out_rotations, 
+                                  const Vector3SoA& out_scales);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void mat4_decompose_batch(const Matrix4* matrices, 
+                                  const uint32 count, 
+                                  const Vector3SoA& out_translations, 
+                                  const QuaternionSoA& out_rotations, 
+                                  const Vector3SoA& out_scales) {
+  uint32 i = 0;
+
+  for(; i + 4 <= count; i += 4) {
+    // `lanes[j]` has entry `j` of all 4 matrices
+    floatx4 lanes[16];
+
+#ifdef SOC_SIMD_SSE
+    for(uint32 col = 0; col < 4; col++) {
+      __m128 r0 = _mm_loadu_ps(&matrices[i + 0].data[col * 4]);
+      __m128 r1 = _mm_loadu_ps(&matrices[i + 1].data[col * 4]);
+      __m128 r2 = _mm_loadu_ps(&matrices[i + 2].data[col * 4]);
+      __m128 r3 = _mm_loadu_ps(&matrices[i + 3].data[col * 4]);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+      lanes[col * 4 + 0] = floatx4(r0);
+      lanes[col * 4 + 1] = floatx4(r1);
+      lanes[col * 4 + 2] = floatx4(r2);
+      lanes[col * 4 + 3] = floatx4(r3);
+    }
+#else
+    for(uint32 j = 0; j < 16; j++) {
+      lanes[j] = floatx4(matrices[i + 0].data[j], matrices[i + 1].data[j], matrices[i + 2].data[j], matrices[i + 3].data[j]);
+    }
+#endif
+
+    Vector3x4 c0(lanes[0], lanes[1], lanes[2]);
+    Vector3x4 c1(lanes[4], lanes[5], lanes[6]);
+    Vector3x4 c2(lanes[8], lanes[9], lanes[10]);
+
+    floatx4 zero(0.0f);
+    floatx4 one(1.0f);
+
+    floatx4 sx = vec3x4_length(c0);
+    floatx4 sy = vec3x4_length(c1);
+    floatx4 sz = vec3x4_length(c2);
+    sx         = floatx4_select(vec3x4_dot(c0, vec3x4_cross(c1, c2)) < zero, -sx, sx);
+
+    c0 = c0 / floatx4_select(sx != zero, sx, one);
+    c1 = c1 / floatx4_select(sy != zero, sy, one);
+    c2 = c2 / floatx4_select(sz != zero, sz, one);
+
+    // The same as `quat_set_mat3_fast`
+    floatx4 tw = one + c0.x + c1.y + c2.z;
+    floatx4 tx = one + c0.x - c1.y - c2.z;
+    floatx4 ty = one - c0.x + c1.y - c2.z;
+    floatx4 tz = one - c0.x - c1.y + c2.z;
+
+    floatx4 yz_diff = c1.z - c2.y;
+    floatx4 zx_diff = c2.x - c0.z;
+    floatx4 xy_diff = c0.y - c1.x;
+    floatx4 yz_sum  = c1.z + c2.y;
+    floatx4 zx_sum  = c2.x + c0.z;
+    floatx4 xy_sum  = c0.y + c1.x;
+
+    maskx4 is_w = (tw >= tx) & (tw >= ty) & (tw >= tz);
+    maskx4 is_x = ~is_w & (tx >= ty) & (tx >= tz);
+    maskx4 is_y = ~is_w & ~is_x & (ty >= tz);
+
+    floatx4 t = floatx4_select(is_w, tw, floatx4_select(is_x, tx, floatx4_select(is_y, ty, tz)));
+    Quaternionx4 q = quatx4_select(is_w, Quaternionx4(yz_diff, zx_diff, xy_diff, tw), 
+                     quatx4_select(is_x, Quaternionx4(tx, xy_sum, zx_sum, yz_diff), 
+                     quatx4_select(is_y, Quaternionx4(xy_sum, ty, yz_sum, zx_diff), 
+                                         Quaternionx4(zx_sum, yz_sum, tz, xy_diff))));
+    q = q * (floatx4(0.5f) / floatx4_sqrt(t));
+
+    floatx4_store(lanes[12], out_translations.x + i);
+    floatx4_store(lanes[13], out_translations.y + i);
+    floatx4_store(lanes[14], out_translations.z + i);
+
+    floatx4_store(q.x, out_rotations.x + i);
+    floatx4_store(q.y, out_rotations.y + i);
+    floatx4_store(q.z, out_rotations.z + i);
+    floatx4_store(q.w, out_rotations.w + i);
+
+    floatx4_store(sx, out_scales.x + i);
+    floatx4_store(sy, out_scales.y + i);
+    floatx4_store(sz, out_scales.z + i);
+  }
+
+  for(; i < count; i++) {
+    Transform transform = mat4_decompose(matrices[i]);
+
+    out_translations.x[i] = transform.translation.x;
+    out_translations.y[i] = transform.translation.y;
+    out_translations.z[i] = transform.translation.z;
+
+    out_rotations.x[i] = transform.rotation.x;
+    out_rotations.y[i] = transform.rotation.y;
+    out_rotations.z[i] = transform.rotation.z;
+    out_rotations.w[i] = transform.rotation.w;
+
+    out_scales.x[i] = transform.scale.x;
+    out_scales.y[i] = transform.scale.y;
+    out_scales.z[i] = transform.scale.z;
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Rotation functions
+///////////////////////////////////////////////////////////////
+
+SOC_FP_STRICT_BEGIN
+
+// Rotates each of the `count` `vectors` by the quaternion in `rotations` at the same index and writes the results 
+// into `out_vectors` (which can be the same array as `vectors`)
+// NOTE: This gives the exact same results as calling `quat_rotate_vec3` on each vector, 4 vectors at a time.
+SOC_API void quat_rotate_vec3_batch(const Quaternion* rotations, const Vector3* vectors, const uint32 count, Vector3* out_vectors);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_rotate_vec3_batch(const Quaternion* rotations, const Vector3* vectors, const uint32 count, Vector3* out_vectors) {
+  uint32 i = 0;
+
+  for(; i + 4 <= count; i += 4) {
+    Vector3x4 v = quatx4_rotate_vec3x4(quatx4_load(rotations + i), vec3x4_load(vectors + i));
+    vec3x4_store(v, out_vectors + i);
+  }
+
+  for(; i < count; i++) {
+    out_vectors[i] = quat_rotate_vec3(rotations[i], vectors[i]);
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+// Rotates each of the `count` `vectors` by the one `rotation` and writes the results into `out_vectors` 
+// (which can be the same array as `vectors`)
+// NOTE: Since the rotation is shared, it gets turned into a matrix only once, which makes each vector cost 
+// 9 multiplications instead of the 18 of `quat_rotate_vec3`. The results can differ from `quat_rotate_vec3` in the last bit.
+SOC_API void quat_rotate_vec3_batch_single(const Quaternion& rotation, const Vector3* vectors, const uint32 count, Vector3* out_vectors);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_rotate_vec3_batch_single(const Quaternion& rotation, const Vector3* vectors, const uint32 count, Vector3* out_vectors) {
+  Matrix3 m = quat_get_mat3(rotation);
+  uint32 i  = 0;
+
+  Vector3 col0(m[0], m[1], m[2]);
+  Vector3 col1(m[3], m[4], m[5]);
+  Vector3 col2(m[6], m[7], m[8]);
+
+  Vector3x4 c0(col0);
+  Vector3x4 c1(col1);
+  Vector3x4 c2(col2);
+
+  for(; i + 4 <= count; i += 4) {
+    Vector3x4 v = vec3x4_load(vectors + i);
+    vec3x4_store((c0 * v.x) + (c1 * v.y) + (c2 * v.z), out_vectors + i);
+  }
+
+  for(; i < count; i++) {
+    Vector3 v      = vectors[i];
+    out_vectors[i] = (col0 * v.x) + (col1 * v.y) + (col2 * v.z);
+  }
+}
+#endif
+
+SOC_FP_STRICT_BEGIN
+
+// Converts each of the `count` Euler `angles` into a rotation applied in the given `order` 
+// and writes them into `out_rotations`
+// NOTE: This gives the exact same results as calling `quat_from_euler` on each of the angles, 8 angles at a time 
+// (in every build, since neither of them fuses any multiply-adds).
+SOC_API void quat_from_euler_batch(const Vector3* angles, const uint32 count, const EulerOrder order, Quaternion* out_rotations);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void quat_from_euler_batch(const Vector3* angles, const uint32 count, const EulerOrder order, Quaternion* out_rotations) {
+  uint32 axes[3];
+  floatx8 sign(euler_order_axes(order, axes));
+  floatx8 half(0.5f);
+
+  uint32 i = 0;
+
+  for(; i + 8 <= count; i += 8) {
+    Vector3x8 v = vec3x8_load(angles + i);
+    floatx8 sines[3], cosines[3];
+
+    floatx8_sincos_fast(v.x * half, &sines[0], &cosines[0]);
+    floatx8_sincos_fast(v.y * half, &sines[1], &cosines[1]);
+    floatx8_sincos_fast(v.z * half, &sines[2], &cosines[2]);
+
+    // The same as `quat_from_euler`
+    floatx8 first_sin  = sines[axes[0]], first_cos  = cosines[axes[0]];
+    floatx8 second_sin = sines[axes[1]], second_cos = cosines[axes[1]];
+    floatx8 third_sin  = sines[axes[2]], third_cos  = cosines[axes[2]];
+
+    floatx8 q[4];
+    q[axes[2]] = (third_sin * second_cos * first_cos) - sign * (third_cos * second_sin * first_sin);
+    q[axes[1]] = (third_cos * second_sin * first_cos) + sign * (third_sin * second_cos * first_sin);
+    q[axes[0]] = (third_cos * second_cos * first_sin) - sign * (third_sin * second_sin * first_cos);
+    q[3]       = (third_cos * second_cos * first_cos) + sign * (third_sin * second_sin * first_sin);
+
+#ifdef SOC_SIMD_AVX
+    quatx4_store(Quaternionx4(floatx4(_mm256_castps256_ps128(q[0].simd)), floatx4(_mm256_castps256_ps128(q[1].simd)), 
+                              floatx4(_mm256_castps256_ps128(q[2].simd)), floatx4(_mm256_castps256_ps128(q[3].simd))), out_rotations + i);
+    quatx4_store(Quaternionx4(floatx4(_mm256_extractf128_ps(q[0].simd, 1)), floatx4(_mm256_extractf128_ps(q[1].simd, 1)), 
+                              floatx4(_mm256_extractf128_ps(q[2].simd, 1)), floatx4(_mm256_extractf128_ps(q[3].simd, 1))), out_rotations + i + 4);
+#else
+    quatx4_store(Quaternionx4(q[0].halves[0], q[1].halves[0], q[2].halves[0], q[3].halves[0]), out_rotations + i);
+    quatx4_store(Quaternionx4(q[0].halves[1], q[1].halves[1], q[2].halves[1], q[3].halves[1]), out_rotations + i + 4);
+#endif
+  }
+
+  for(; i < count; i++) {
+    out_rotations[i] = quat_from_euler(angles[i], order);
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Particle types
+///////////////////////////////////////////////////////////////
+
+// The ways `particle_integrate` can move the particles forward in time
+//
+// `PARTICLE_INTEGRATOR_EULER` moves the positions with the old velocities (cheapest, but gains energy). 
+// `PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER` moves the positions with the new velocities (just as cheap and a lot more stable). 
+// `PARTICLE_INTEGRATOR_VERLET` is velocity Verlet, which is second-order accurate and costs about twice as much.
+enum ParticleIntegrator {
+  PARTICLE_INTEGRATOR_EULER = 0, 
+  PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER, 
+  PARTICLE_INTEGRATOR_VERLET,
+};
+
+// A pool of particles stored as SoA streams
+//
+// The alive particles are always packed at the start of each stream in `[0, count)`, and `lifetimes` holds 
+// the seconds each particle has left to live. Use `particle_system_memory_size` and `particle_system_create` 
+// to set one up.
+// NOTE: The system does NOT own its memory, and the streams have `capacity` entries (padded like the other SoA types).
+struct ParticleSystem {
+  Vector3SoA positions;
+  Vector3SoA velocities;
+  float32* lifetimes;
+
+  uint32 count;
+  uint32 capacity;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Particle functions
+///////////////////////////////////////////////////////////////
+
+// Returns the number of bytes a `ParticleSystem` of `capacity` particles needs
+SOC_INLINE const uint64 particle_system_memory_size(const uint32 capacity) {
+  return soa_memory_size(7, capacity);
+}
+
+// Creates and returns an empty `ParticleSystem` that can hold up to `capacity` particles inside of `memory`
+// NOTE: `memory` must be at least `particle_system_memory_size(capacity)` bytes.
+SOC_INLINE const ParticleSystem particle_system_create(void* memory, const uint32 capacity) {
+  float32* arrays[7];
+  soa_split_memory(memory, 7, capacity, arrays);
+
+  ParticleSystem system;
+  system.positions  = Vector3SoA{arrays[0], arrays[1], arrays[2], capacity};
+  system.velocities = Vector3SoA{arrays[3], arrays[4], arrays[5], capacity};
+  system.lifetimes  = arrays[6];
+  system.count      = 0;
+  system.capacity   = capacity;
+
+  return system;
+}
+
+// Adds a particle at `position` moving at `velocity` that lives for `lifetime` seconds to the `system`
+// NOTE: Returns false (and adds nothing) if the `system` is full.
+SOC_INLINE const bool particle_emit(ParticleSystem& system, const Vector3& position, const Vector3& velocity, const float32 lifetime) {
+  if(system.count >= system.capacity) {
+    return false;
+  }
+
+  uint32 i = system.count++;
+
+  system.positions.x[i]  = position.x;
+  system.positions.y[i]  = position.y;
+  system.positions.z[i]  = position.z;
+  system.velocities.x[i] = velocity.x;
+  system.velocities.y[i] = velocity.y;
+  system.velocities.z[i] = velocity.z;
+  system.lifetimes[i]    = lifetime;
+
+  return true;
+}
+
+SOC_FP_STRICT_BEGIN
+
+#ifndef SOC_DECLARE_ONLY
+
+// The shared state of the `particle_integrate` ranges
+struct ParticleJob {
+  ParticleSystem* system;
+
+  Vector3 gravity;
+  float32 drag;
+  float32 delta_time;
+};
+
+// Loads the 4 particles starting at `i` of the `system` into `out_pos` and `out_vel`
+SOC_INLINE void particle_load(const ParticleSystem* system, const uint32 i, Vector3x4& out_pos, Vector3x4& out_vel) {
+  out_pos = Vector3x4(floatx4_load(system->positions.x + i), floatx4_load(system->positions.y + i), floatx4_load(system->positions.z + i));
+  out_vel = Vector3x4(floatx4_load(system->velocities.x + i), floatx4_load(system->velocities.y + i), floatx4_load(system->velocities.z + i));
+}
+
+// Stores `pos` and `vel` into the 4 particles starting at `i` of the `system` and takes `dt` off of their lifetimes
+SOC_INLINE void particle_store(ParticleSystem* system, const uint32 i, const Vector3x4& pos, const Vector3x4& vel, const floatx4& dt) {
+  floatx4_store(pos.x, system->positions.x + i);
+  floatx4_store(pos.y, system->positions.y + i);
+  floatx4_store(pos.z, system->positions.z + i);
+  floatx4_store(vel.x, system->velocities.x + i);
+  floatx4_store(vel.y, system->velocities.y + i);
+  floatx4_store(vel.z, system->velocities.z + i);
+  floatx4_store(floatx4_load(system->lifetimes + i) - dt, system->lifetimes + i);
+}
+
+// Integrates the particles of the blocks in `[begin, end)` (each block is `SOC_SOA_BLOCK` particles) 
+// with `PARTICLE_INTEGRATOR_EULER`
+SOC_INLINE void particle_integrate_euler_range(void* user_data, const uint32 begin, const uint32 end) {
+  ParticleJob* job       = (ParticleJob*)user_data;
+  ParticleSystem* system = job->system;
+
+  Vector3x4 gravity(job->gravity);
+  floatx4 drag(job->drag);
+  floatx4 dt(job->delta_time);
+
+  for(uint32 i = begin * SOC_SOA_BLOCK; i < end * SOC_SOA_BLOCK; i += 4) {
+    Vector3x4 pos, vel;
+    particle_load(system, i, pos, vel);
+
+    Vector3x4 accel = gravity - (vel * drag);
+    pos             = pos + (vel * dt);
+    vel             = vel + (accel * dt);
+
+    particle_store(system, i, pos, vel, dt);
+  }
+}
+
+// Integrates the particles of the blocks in `[begin, end)` (each block is `SOC_SOA_BLOCK` particles) 
+// with `PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER`
+SOC_INLINE void particle_integrate_semi_implicit_euler_range(void* user_data, const uint32 begin, const uint32 end) {
+  ParticleJob* job       = (ParticleJob*)user_data;
+  ParticleSystem* system = job->system;
+
+  Vector3x4 gravity(job->gravity);
+  floatx4 drag(job->drag);
+  floatx4 dt(job->delta_time);
+
+  for(uint32 i = begin * SOC_SOA_BLOCK; i < end * SOC_SOA_BLOCK; i += 4) {
+    Vector3x4 pos, vel;
+    particle_load(system, i, pos, vel);
+
+    Vector3x4 accel = gravity - (vel * drag);
+    vel             = vel + (accel * dt);
+    pos             = pos + (vel * dt);
+
+    particle_store(system, i, pos, vel, dt);
+  }
+}
+
+// Integrates the particles of the blocks in `[begin, end)` (each block is `SOC_SOA_BLOCK` particles) 
+// with `PARTICLE_INTEGRATOR_VERLET`
+SOC_INLINE void particle_integrate_verlet_range(void* user_data, const uint32 begin, const uint32 end) {
+  ParticleJob* job       = (ParticleJob*)user_data;
+  ParticleSystem* system = job->system;
+
+  Vector3x4 gravity(job->gravity);
+  floatx4 drag(job->drag);
+  floatx4 dt(job->delta_time);
+  floatx4 half_dt(job->delta_time * 0.5f);
+
+  for(uint32 i = begin * SOC_SOA_BLOCK; i < end * SOC_SOA_BLOCK; i += 4) {
+    Vector3x4 pos, vel;
+    particle_load(system, i, pos, vel);
+
+    Vector3x4 accel = gravity - (vel * drag);
+    pos             = pos + ((vel + (accel * half_dt)) * dt);
+
+    // The drag depends on the velocity, so the new acceleration is taken at the predicted velocity
+    Vector3x4 next_accel = gravity - ((vel + (accel * dt)) * drag);
+    vel                  = vel + ((accel + next_accel) * half_dt);
+
+    particle_store(system, i, pos, vel, dt);
+  }
+}
+
+#endif
+
+// Moves every alive particle of the `system` forward by `delta_time` seconds using the given `integrator` and 
+// takes `delta_time` off of their lifetimes, splitting the work across `threads_count` threads
+// NOTE: The acceleration of each particle is `gravity - velocity * drag`. The particles are updated 4 at a time 
+// with the same results on every thread count and on both the SIMD and scalar paths, since the integrators are 
+// compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`). Particles that run out of 
+// lifetime keep on moving until `particle_compact` removes them.
+SOC_API void particle_integrate(ParticleSystem& system, 
+                                const ParticleIntegrator integrator, 
+                                const Vector3& gravity, 
+                                const float32 drag, 
+                                const float32 delta_time, 
+                                const uint32 threads_count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void particle_integrate(ParticleSystem& system, 
+                                const ParticleIntegrator integrator, 
+                                const Vector3& gravity, 
+                                const float32 drag, 
+                                const float32 delta_time, 
+                                const uint32 threads_count) {
+  ParticleJob job;
+  job.system     = &system;
+  job.gravity    = gravity;
+  job.drag       = drag;
+  job.delta_time = delta_time;
+
+  // Each integrator has its own loop, so the choice is made once here rather than once per 4 particles
+  void (*range_func)(void*, const uint32, const uint32) = particle_integrate_euler_range;
+  switch(integrator) {
+    case PARTICLE_INTEGRATOR_EULER:
+      range_func = particle_integrate_euler_range;
+      break;
+    case PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER:
+      range_func = particle_integrate_semi_implicit_euler_range;
+      break;
+    case PARTICLE_INTEGRATOR_VERLET:
+      range_func = particle_integrate_verlet_range;
+      break;
+  }
+
+  // Splitting by whole blocks keeps each thread on its own cache lines
+  parallel_for(soa_padded_count(system.count) / SOC_SOA_BLOCK, threads_count, range_func, &job);
+}
+#endif
+
+SOC_FP_STRICT_END
+
+// Removes every particle of the `system` with no lifetime left (`lifetime <= 0`) and returns how many got removed
+// NOTE: The alive particles keep their order. The lifetimes are compared 4 at a time, and the alive particles of 
+// each 4 get left-packed into place through a lookup table with no branches per particle. Runs of alive particles 
+// at the start get skipped without moving anything.
+SOC_API const uint32 particle_compact(ParticleSystem& system);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const uint32 particle_compact(ParticleSystem& system) {
+  // The alive lanes of each 4-bit mask packed to the front (the unused slots repeat lane 0), and how many there are
+  static const uint8 PACK_LANES[16][4] = {
+    {0, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, 
+    {2, 0, 0, 0}, {0, 2, 0, 0}, {1, 2, 0, 0}, {0, 1, 2, 0}, 
+    {3, 0, 0, 0}, {0, 3, 0, 0}, {1, 3, 0, 0}, {0, 1, 3, 0}, 
+    {2, 3, 0, 0}, {0, 2, 3, 0}, {1, 2, 3, 0}, {0, 1, 2, 3},
+  };
+  static const uint8 PACK_COUNTS[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+  float32* streams[7] = {
+    system.positions.x, system.positions.y, system.positions.z, 
+    system.velocities.x, system.velocities.y, system.velocities.z, 
+    system.lifetimes,
+  };
+
+  // Nothing needs to move until the first dead particle
+  uint32 read = 0;
+  floatx4 zero(0.0f);
+  while(read + 4 <= system.count && maskx4_all(floatx4_load(system.lifetimes + read) > zero)) {
+    read += 4;
+  }
+
+  // All 4 slots get written every time and `write` only moves past the alive ones. That stays inside of the 
+  // current 4 (since `write <= read`) and inside of the padding, and each 4 gets read before any of it is written.
+  uint32 write = read;
+  for(; read < system.count; read += 4) {
+    uint32 alive = maskx4_bits(floatx4_load(system.lifetimes + read) > zero);
+    if(system.count - read < 4) {
+      alive &= (1u << (system.count - read)) - 1; // The lanes past the end are not particles
+    }
+
+    const uint8* lanes = PACK_LANES[alive];
+    for(uint32 s = 0; s < 7; s++) {
+      float32* stream = streams[s];
+
+      float32 l0 = stream[read + lanes[0]];
+      float32 l1 = stream[read + lanes[1]];
+      float32 l2 = stream[read + lanes[2]];
+      float32 l3 = stream[read + lanes[3]];
+
+      stream[write + 0] = l0;
+      stream[write + 1] = l1;
+      stream[write + 2] = l2;
+      stream[write + 3] = l3;
+    }
+
+    write += PACK_COUNTS[alive];
+  }
+
+  uint32 removed = system.count - write;
+  system.count   = write;
+
+  return removed;
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Noise types
+///////////////////////////////////////////////////////////////
+
+// NOTE: All of the noise functions are built on the 8-wide `*x8` versions, including the single point ones, so a point 
+// gives the exact same value no matter which function (or code path) computed it. That also means a single point costs 
+// about as much as 8 of them, so use the `*_batch` and `*_grid` functions whenever there are many points. The lattice gets hashed with a permutation 
+// polynomial modulo 289 that only needs float math (the same idea as the "webgl-noise" shaders), so the lattice repeats 
+// every 289 cells. For the Perlin noise that means it repeats every 289 units on each axis. The noise functions are also 
+// compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`), so a point gives the exact same value in every build.
+
+// The kinds of noise the fBm functions can sum up
+enum NoiseType {
+  NOISE_SIMPLEX = 0, 
+  NOISE_PERLIN,
+};
+
+///////////////////////////////////////////////////////////////
+
+// Noise functions
+///////////////////////////////////////////////////////////////
+
+SOC_FP_STRICT_BEGIN
+
+// The scales that bring each noise to roughly `[-1, 1]` (measured over millions of random points)
+#define SOC_NOISE_SIMPLEX2_SCALE 44.0f
+#define SOC_NOISE_SIMPLEX3_SCALE 75.0f
+#define SOC_NOISE_SIMPLEX4_SCALE 61.0f
+#define SOC_NOISE_PERLIN2_SCALE  0.65f
+#define SOC_NOISE_PERLIN3_SCALE  1.0f
+#define SOC_NOISE_PERLIN4_SCALE  0.88f
+
+// Returns every lane of `x` modulo 289 (`x` needs to hold whole numbers, and the results are in `[0, 289]`)
+SOC_INLINE const floatx8 noise_mod289(const floatx8& x) {
+  return x - floatx8_floor(x * floatx8(1.0f / 289.0f)) * floatx8(289.0f);
+}
+
+// Returns the hash of every lane of `x` (whole numbers in `[0, 578]`) as a whole number in `[0, 289]`
+// NOTE: `(34x^2 + 10x) mod 289` is a permutation of the numbers modulo 289, and every step stays exact in float32. 
+// The product is never negative, so the modulo can truncate instead of using the full `floor`.
+SOC_INLINE const floatx8 noise_permute(const floatx8& x) {
+  floatx8 p = ((x * floatx8(34.0f)) + floatx8(10.0f)) * x;
+  return p - floatx8_trunc(p * floatx8(1.0f / 289.0f)) * floatx8(289.0f);
+}
+
+// Returns `hash` modulo `n`, where `n` has to be a power of 2
+SOC_INLINE const floatx8 noise_hash_bits(const floatx8& hash, const float32 n) {
+  return hash - floatx8_trunc(hash * floatx8(1.0f / n)) * floatx8(n);
+}
+
+// Returns the dot product of the 2D gradient picked by `hash` and `(x, y)`, where the gradients are `(±1, ±2)` and `(±2, ±1)`
+SOC_INLINE const floatx8 noise_grad2(const floatx8& hash, const floatx8& x, const floatx8& y) {
+  floatx8 h = noise_hash_bits(hash, 8.0f);
+
+  maskx8 is_low = h < floatx8(4.0f);
+  floatx8 u     = floatx8_select(is_low, x, y);
+  floatx8 v     = floatx8_select(is_low, y, x) * floatx8(2.0f);
+
+  // The lower 2 bits of `h` pick the signs
+  floatx8 bits  = noise_hash_bits(h, 4.0f);
+  maskx8 bit1   = bits >= floatx8(2.0f);
+  maskx8 bit0   = (bits - floatx8_select(bit1, floatx8(2.0f), floatx8(0.0f))) >= floatx8(1.0f);
+
+  return floatx8_select(bit0, -u, u) + floatx8_select(bit1, -v, v);
+}
+
+// Returns the dot product of the 3D gradient picked by `hash` and `(x, y, z)`, where the gradients are the 12 
+// edge midpoints of a cube (padded to 16 the same way as Perlin's improved noise)
+SOC_INLINE const floatx8 noise_grad3(const floatx8& hash, const floatx8& x, const floatx8& y, const floatx8& z) {
+  floatx8 h = noise_hash_bits(hash, 16.0f);
+
+  maskx8 is_xz = (h == floatx8(12.0f)) | (h == floatx8(14.0f));
+  floatx8 u    = floatx8_select(h < floatx8(8.0f), x, y);
+  floatx8 v    = floatx8_select(h < floatx8(4.0f), y, floatx8_select(is_xz, x, z));
+
+  floatx8 bits = noise_hash_bits(h, 4.0f);
+  maskx8 bit1  = bits >= floatx8(2.0f);
+  maskx8 bit0  = (bits - floatx8_select(bit1, floatx8(2.0f), floatx8(0.0f))) >= floatx8(1.0f);
+
+  return floatx8_select(bit0, -u, u) + floatx8_select(bit1, -v, v);
+}
+
+// Returns the dot product of the 4D gradient picked by `hash` and `(x, y, z, w)`, where the gradients are the 32 
+// edge midpoints of a tesseract
+SOC_INLINE const floatx8 noise_grad4(const floatx8& hash, const floatx8& x, const floatx8& y, const floatx8& z, const floatx8& w) {
+  floatx8 h = noise_hash_bits(hash, 32.0f);
+
+  floatx8 u = floatx8_select(h < floatx8(24.0f), x, y);
+  floatx8 v = floatx8_select(h < floatx8(16.0f), y, z);
+  floatx8 t = floatx8_select(h < floatx8(8.0f), z, w);
+
+  floatx8 bits = noise_hash_bits(h, 8.0f);
+  maskx8 bit2  = bits >= floatx8(4.0f);
+  bits         = bits - floatx8_select(bit2, floatx8(4.0f), floatx8(0.0f));
+  maskx8 bit1  = bits >= floatx8(2.0f);
+  maskx8 bit0  = (bits - floatx8_select(bit1, floatx8(2.0f), floatx8(0.0f))) >= floatx8(1.0f);
+
+  return floatx8_select(bit0, -u, u) + floatx8_select(bit1, -v, v) + floatx8_select(bit2, -t, t);
+}
+
+// Returns the contribution of a simplex corner with the given `gradient` and squared distance `dist2`
+SOC_INLINE const floatx8 noise_simplex_falloff(const floatx8& dist2, const floatx8& gradient) {
+  floatx8 t = floatx8_max(floatx8(0.5f) - dist2, floatx8(0.0f));
+  t         = t * t;
+
+  return t * t * gradient;
+}
+
+// Returns 1 in the lanes where `mask` is on and 0 everywhere else
+SOC_INLINE const floatx8 noise_mask_to_float(const maskx8& mask) {
+  return floatx8_select(mask, floatx8(1.0f), floatx8(0.0f));
+}
+
+// Returns the 2D simplex noise at every point `(x, y)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_simplex2x8(const floatx8& x, const floatx8& y) {
+  const float32 F2 = 0.366025403784f; // (sqrt(3) - 1) / 2
+  const float32 G2 = 0.211324865405f; // (3 - sqrt(3)) / 6
+
+  // Skewing into the simplex grid to find the cell, and then back to find the first corner
+  floatx8 skew = (x + y) * floatx8(F2);
+  floatx8 i    = floatx8_floor(x + skew);
+  floatx8 j    = floatx8_floor(y + skew);
+
+  floatx8 unskew = (i + j) * floatx8(G2);
+  floatx8 x0     = x - (i - unskew);
+  floatx8 y0     = y - (j - unskew);
+
+  // The middle corner is either `(1, 0)` or `(0, 1)` depending on which triangle the point is in
+  floatx8 i1 = noise_mask_to_float(x0 > y0);
+  floatx8 j1 = floatx8(1.0f) - i1;
+
+  floatx8 x1 = x0 - i1 + floatx8(G2);
+  floatx8 y1 = y0 - j1 + floatx8(G2);
+  floatx8 x2 = x0 - floatx8(1.0f - 2.0f * G2);
+  floatx8 y2 = y0 - floatx8(1.0f - 2.0f * G2);
+
+  floatx8 ii = noise_mod289(i);
+  floatx8 jj = noise_mod289(j);
+
+  floatx8 h0 = noise_permute(noise_permute(jj) + ii);
+  floatx8 h1 = noise_permute(noise_permute(jj + j1) + ii + i1);
+  floatx8 h2 = noise_permute(noise_permute(jj + floatx8(1.0f)) + ii + floatx8(1.0f));
+
+  floatx8 n = noise_simplex_falloff(x0 * x0 + y0 * y0, noise_grad2(h0, x0, y0)) + 
+              noise_simplex_falloff(x1 * x1 + y1 * y1, noise_grad2(h1, x1, y1)) + 
+              noise_simplex_falloff(x2 * x2 + y2 * y2, noise_grad2(h2, x2, y2));
+
+  return n * floatx8(SOC_NOISE_SIMPLEX2_SCALE);
+}
+
+// Returns the 3D simplex noise at every point `(x, y, z)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_simplex3x8(const floatx8& x, const floatx8& y, const floatx8& z) {
+  const float32 F3 = 1.0f / 3.0f;
+  const float32 G3 = 1.0f / 6.0f;
+
+  floatx8 skew = (x + y + z) * floatx8(F3);
+  floatx8 i    = floatx8_floor(x + skew);
+  floatx8 j    = floatx8_floor(y + skew);
+  floatx8 k    = floatx8_floor(z + skew);
+
+  floatx8 unskew = (i + j + k) * floatx8(G3);
+  floatx8 x0     = x - (i - unskew);
+  floatx8 y0     = y - (j - unskew);
+  floatx8 z0     = z - (k - unskew);
+
+  // The second corner steps along the biggest axis and the third corner along every axis but the smallest one
+  maskx8 x_ge_y = x0 >= y0;
+  maskx8 y_ge_z = y0 >= z0;
+  maskx8 x_ge_z = x0 >= z0;
+
+  floatx8 i1 = noise_mask_to_float(x_ge_y & x_ge_z);
+  floatx8 j1 = noise_mask_to_float(~x_ge_y & y_ge_z);
+  floatx8 k1 = noise_mask_to_float(~x_ge_z & ~y_ge_z);
+  floatx8 i2 = noise_mask_to_float(x_ge_y | x_ge_z);
+  floatx8 j2 = noise_mask_to_float(~x_ge_y | y_ge_z);
+  floatx8 k2 = noise_mask_to_float(~(x_ge_z & y_ge_z));
+
+  floatx8 x1 = x0 - i1 + floatx8(G3);
+  floatx8 y1 = y0 - j1 + floatx8(G3);
+  floatx8 z1 = z0 - k1 + floatx8(G3);
+  floatx8 x2 = x0 - i2 + floatx8(2.0f * G3);
+  floatx8 y2 = y0 - j2 + floatx8(2.0f * G3);
+  floatx8 z2 = z0 - k2 + floatx8(2.0f * G3);
+  floatx8 x3 = x0 - floatx8(1.0f - 3.0f * G3);
+  floatx8 y3 = y0 - floatx8(1.0f - 3.0f * G3);
+  floatx8 z3 = z0 - floatx8(1.0f - 3.0f * G3);
+
+  floatx8 ii  = noise_mod289(i);
+  floatx8 jj  = noise_mod289(j);
+  floatx8 kk  = noise_mod289(k);
+  floatx8 one = floatx8(1.0f);
+
+  floatx8 h0 = noise_permute(noise_permute(noise_permute(kk) + jj) + ii);
+  floatx8 h1 = noise_permute(noise_permute(noise_permute(kk + k1) + jj + j1) + ii + i1);
+  floatx8 h2 = noise_permute(noise_permute(noise_permute(kk + k2) + jj + j2) + ii + i2);
+  floatx8 h3 = noise_permute(noise_permute(noise_permute(kk + one) + jj + one) + ii + one);
+
+  floatx8 n = noise_simplex_falloff(x0 * x0 + y0 * y0 + z0 * z0, noise_grad3(h0, x0, y0, z0)) + 
+              noise_simplex_falloff(x1 * x1 + y1 * y1 + z1 * z1, noise_grad3(h1, x1, y1, z1)) + 
+              noise_simplex_falloff(x2 * x2 + y2 * y2 + z2 * z2, noise_grad3(h2, x2, y2, z2)) + 
+              noise_simplex_falloff(x3 * x3 + y3 * y3 + z3 * z3, noise_grad3(h3, x3, y3, z3));
+
+  return n * floatx8(SOC_NOISE_SIMPLEX3_SCALE);
+}
+
+// Returns the 4D simplex noise at every point `(x, y, z, w)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_simplex4x8(const floatx8& x, const floatx8& y, const floatx8& z, const floatx8& w) {
+  const float32 F4 = 0.309016994375f; // (sqrt(5) - 1) / 4
+  const float32 G4 = 0.138196601125f; // (5 - sqrt(5)) / 20
+
+  floatx8 skew = (x + y + z + w) * floatx8(F4);
+  floatx8 cell[4] = {
+    floatx8_floor(x + skew), 
+    floatx8_floor(y + skew), 
+    floatx8_floor(z + skew), 
+    floatx8_floor(w + skew),
+  };
+
+  floatx8 unskew = (cell[0] + cell[1] + cell[2] + cell[3]) * floatx8(G4);
+  floatx8 d0[4]  = {
+    x - (cell[0] - unskew), 
+    y - (cell[1] - unskew), 
+    z - (cell[2] - unskew), 
+    w - (cell[3] - unskew),
+  };
+
+  // The rank of each axis is how many of the other axes it is bigger than. The corner `c` (from 1 to 3) 
+  // steps along every axis with a rank of at least `4 - c`.
+  floatx8 rank[4];
+  for(uint32 a = 0; a < 4; a++) {
+    for(uint32 b = a + 1; b < 4; b++) {
+      floatx8 is_bigger = noise_mask_to_float(d0[a] > d0[b]);
+      rank[a]           = rank[a] + is_bigger;
+      rank[b]           = rank[b] + (floatx8(1.0f) - is_bigger);
+    }
+  }
+
+  floatx8 hash_cell[4];
+  for(uint32 a = 0; a < 4; a++) {
+    hash_cell[a] = noise_mod289(cell[a]);
+  }
+
+  floatx8 n(0.0f);
+  for(uint32 c = 0; c < 5; c++) {
+    floatx8 offsets[4];
+    floatx8 d[4];
+    floatx8 dist2(0.0f);
+
+    for(uint32 a = 0; a < 4; a++) {
+      offsets[a] = c == 0 ? floatx8(0.0f) : (c == 4 ? floatx8(1.0f) : noise_mask_to_float(rank[a] >= floatx8((float32)(4 - c))));
+      d[a]       = d0[a] - offsets[a] + floatx8(c * G4);
+      dist2      = dist2 + d[a] * d[a];
+    }
+
+    floatx8 h = noise_permute(noise_permute(noise_permute(noise_permute(hash_cell[3] + offsets[3]) + hash_cell[2] + offsets[2]) + 
+                                                          hash_cell[1] + offsets[1]) + hash_cell[0] + offsets[0]);
+    n         = n + noise_simplex_falloff(dist2, noise_grad4(h, d[0], d[1], d[2], d[3]));
+  }
+
+  return n * floatx8(SOC_NOISE_SIMPLEX4_SCALE);
+}
+
+// Returns the quintic fade curve `6t^5 - 15t^4 + 10t^3` of every lane of `t` 
+SOC_INLINE const floatx8 noise_fade(const floatx8& t) {
+  return t * t * t * (t * (t * floatx8(6.0f) - floatx8(15.0f)) + floatx8(10.0f));
+}
+
+// Returns the 2D gradient (Perlin) noise at every point `(x, y)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_perlin2x8(const floatx8& x, const floatx8& y) {
+  floatx8 i  = floatx8_floor(x);
+  floatx8 j  = floatx8_floor(y);
+  floatx8 fx = x - i;
+  floatx8 fy = y - j;
+
+  floatx8 ii  = noise_mod289(i);
+  floatx8 jj  = noise_mod289(j);
+  floatx8 one = floatx8(1.0f);
+
+  floatx8 row0 = noise_permute(jj);
+  floatx8 row1 = noise_permute(jj + one);
+
+  floatx8 n00 = noise_grad2(noise_permute(row0 + ii), fx, fy);
+  floatx8 n10 = noise_grad2(noise_permute(row0 + ii + one), fx - one, fy);
+  floatx8 n01 = noise_grad2(noise_permute(row1 + ii), fx, fy - one);
+  floatx8 n11 = noise_grad2(noise_permute(row1 + ii + one), fx - one, fy - one);
+
+  floatx8 u = noise_fade(fx);
+  floatx8 n = floatx8_lerp(floatx8_lerp(n00, n10, u), floatx8_lerp(n01, n11, u), noise_fade(fy));
+
+  return n * floatx8(SOC_NOISE_PERLIN2_SCALE);
+}
+
+// Returns the 3D gradient (Perlin) noise at every point `(x, y, z)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_perlin3x8(const floatx8& x, const floatx8& y, const floatx8& z) {
+  floatx8 i  = floatx8_floor(x);
+  floatx8 j  = floatx8_floor(y);
+  floatx8 k  = floatx8_floor(z);
+  floatx8 fx = x - i;
+  floatx8 fy = y - j;
+  floatx8 fz = z - k;
+
+  floatx8 ii  = noise_mod289(i);
+  floatx8 jj  = noise_mod289(j);
+  floatx8 kk  = noise_mod289(k);
+  
+  // The corner `c` is at `(c & 1, (c >> 1) & 1, c >> 2)`
+  floatx8 n[8];
+  for(uint32 c = 0; c < 8; c++) {
+    floatx8 ox((float32)(c & 1));
+    floatx8 oy((float32)((c >> 1) & 1));
+    floatx8 oz((float32)(c >> 2));
+
+    floatx8 h = noise_permute(noise_permute(noise_permute(kk + oz) + jj + oy) + ii + ox);
+    n[c]      = noise_grad3(h, fx - ox, fy - oy, fz - oz);
+  }
+
+  floatx8 u = noise_fade(fx);
+  floatx8 v = noise_fade(fy);
+
+  floatx8 n0 = floatx8_lerp(floatx8_lerp(n[0], n[1], u), floatx8_lerp(n[2], n[3], u), v);
+  floatx8 n1 = floatx8_lerp(floatx8_lerp(n[4], n[5], u), floatx8_lerp(n[6], n[7], u), v);
+
+  return floatx8_lerp(n0, n1, noise_fade(fz)) * floatx8(SOC_NOISE_PERLIN3_SCALE);
+}
+
+// Returns the 4D gradient (Perlin) noise at every point `(x, y, z, w)` (roughly in `[-1, 1]`)
+SOC_INLINE const floatx8 noise_perlin4x8(const floatx8& x, const floatx8& y, const floatx8& z, const floatx8& w) {
+  floatx8 p[4] = {x, y, z, w};
+  floatx8 f[4];
+  floatx8 cell[4];
+
+  for(uint32 a = 0; a < 4; a++) {
+    floatx8 whole = floatx8_floor(p[a]);
+
+    f[a]    = p[a] - whole;
+    cell[a] = noise_mod289(whole);
+  }
+
+  // The corner `c` is at `(c & 1, (c >> 1) & 1, (c >> 2) & 1, c >> 3)`
+  floatx8 n[16];
+  for(uint32 c = 0; c < 16; c++) {
+    floatx8 o[4];
+    for(uint32 a = 0; a < 4; a++) {
+      o[a] = floatx8((float32)((c >> a) & 1));
+    }
+
+    floatx8 h = noise_permute(noise_permute(noise_permute(noise_permute(cell[3] + o[3]) + cell[2] + o[2]) + cell[1] + o[1]) + cell[0] + o[0]);
+    n[c]      = noise_grad4(h, f[0] - o[0], f[1] - o[1], f[2] - o[2], f[3] - o[3]);
+  }
+
+  // Interpolating away one axis at a time
+  for(uint32 a = 0, corners = 16; a < 4; a++, corners /= 2) {
+    floatx8 t = noise_fade(f[a]);
+
+    for(uint32 c = 0; c < corners / 2; c++) {
+      n[c] = floatx8_lerp(n[c * 2], n[c * 2 + 1], t);
+    }
+  }
+
+  return n[0] * floatx8(SOC_NOISE_PERLIN4_SCALE);
+}
+
+// Returns the fBm (fractal Brownian motion) at every point `(x, y)`, which is `octaves` layers of the 2D noise of the 
+// given `type`, each one with its frequency multiplied by `lacunarity` and its amplitude multiplied by `gain`
+// NOTE: The sum gets divided by the total amplitude to stay roughly in `[-1, 1]`, so with 1 octave this is the same as the noise.
+SOC_INLINE const floatx8 noise_fbm2x8(const NoiseType type, const floatx8& x, const floatx8& y, const uint32 octaves, const float32 lacunarity, const float32 gain) {
+  floatx8 sum(0.0f);
+  float32 frequency = 1.0f; 
+  float32 amplitude = 1.0f;
+  float32 total     = 0.0f;
+
+  for(uint32 i = 0; i < octaves; i++) {
+    floatx8 freq(frequency);
+    floatx8 n = type == NOISE_SIMPLEX ? noise_simplex2x8(x * freq, y * freq) : noise_perlin2x8(x * freq, y * freq);
+
+    sum        = sum + n * floatx8(amplitude);
+    total     += amplitude;
+    frequency *= lacunarity;
+    amplitude *= gain;
+  }
+
+  return total > 0.0f ? sum * floatx8(1.0f / total) : sum;
+}
+
+// The same as `noise_fbm2x8` but in 3D
+SOC_INLINE const floatx8 noise_fbm3x8(const NoiseType type, const floatx8& x, const floatx8& y, const floatx8& z, const uint32 octaves, const float32 lacunarity, const float32 gain) {
+  floatx8 sum(0.0f);
+  float32 frequency = 1.0f; 
+  float32 amplitude = 1.0f;
+  float32 total     = 0.0f;
+
+  for(uint32 i = 0; i < octaves; i++) {
+    floatx8 freq(frequency);
+    floatx8 n = type == NOISE_SIMPLEX ? noise_simplex3x8(x * freq, y * freq, z * freq) : noise_perlin3x8(x * freq, y * freq, z * freq);
+
+    sum        = sum + n * floatx8(amplitude);
+    total     += amplitude;
+    frequency *= lacunarity;
+    amplitude *= gain;
+  }
+
+  return total > 0.0f ? sum * floatx8(1.0f / total) : sum;
+}
+
+// The same as `noise_fbm2x8` but in 4D
+SOC_INLINE const floatx8 noise_fbm4x8(const NoiseType type, 
+                                      const floatx8& x, 
+                                      const floatx8& y, 
+                                      const floatx8& z, 
+                                      const floatx8& w, 
+                                      const uint32 octaves, 
+                                      const float32 lacunarity, 
+                                      const float32 gain) {
+  floatx8 sum(0.0f);
+  float32 frequency = 1.0f; 
+  float32 amplitude = 1.0f;
+  float32 total     = 0.0f;
+
+  for(uint32 i = 0; i < octaves; i++) {
+    floatx8 freq(frequency);
+    floatx8 n = type == NOISE_SIMPLEX ? noise_simplex4x8(x * freq, y * freq, z * freq, w * freq) : 
+                                        noise_perlin4x8(x * freq, y * freq, z * freq, w * freq);
+
+    sum        = sum + n * floatx8(amplitude);
+    total     += amplitude;
+    frequency *= lacunarity;
+    amplitude *= gain;
+  }
+
+  return total > 0.0f ? sum * floatx8(1.0f / total) : sum;
+}
+
+// Returns the 2D simplex noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_simplex2(const Vector2& p) {
+  return noise_simplex2x8(floatx8(p.x), floatx8(p.y)).lanes[0];
+}
+
+// Returns the 3D simplex noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_simplex3(const Vector3& p) {
+  return noise_simplex3x8(floatx8(p.x), floatx8(p.y), floatx8(p.z)).lanes[0];
+}
+
+// Returns the 4D simplex noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_simplex4(const Vector4& p) {
+  return noise_simplex4x8(floatx8(p.x), floatx8(p.y), floatx8(p.z), floatx8(p.w)).lanes[0];
+}
+
+// Returns the 2D gradient (Perlin) noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_perlin2(const Vector2& p) {
+  return noise_perlin2x8(floatx8(p.x), floatx8(p.y)).lanes[0];
+}
+
+// Returns the 3D gradient (Perlin) noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_perlin3(const Vector3& p) {
+  return noise_perlin3x8(floatx8(p.x), floatx8(p.y), floatx8(p.z)).lanes[0];
+}
+
+// Returns the 4D gradient (Perlin) noise at `p` (roughly in `[-1, 1]`)
+SOC_INLINE const float32 noise_perlin4(const Vector4& p) {
+  return noise_perlin4x8(floatx8(p.x), floatx8(p.y), floatx8(p.z), floatx8(p.w)).lanes[0];
+}
+
+// Returns the 2D fBm at `p` (see `noise_fbm2x8`)
+SOC_INLINE const float32 noise_fbm2(const NoiseType type, const Vector2& p, const uint32 octaves, const float32 lacunarity, const float32 gain) {
+  return noise_fbm2x8(type, floatx8(p.x), floatx8(p.y), octaves, lacunarity, gain).lanes[0];
+}
+
+// Returns the 3D fBm at `p` (see `noise_fbm2x8`)
+SOC_INLINE const float32 noise_fbm3(const NoiseType type, const Vector3& p, const uint32 octaves, const float32 lacunarity, const float32 gain) {
+  return noise_fbm3x8(type, floatx8(p.x), floatx8(p.y), floatx8(p.z), octaves, lacunarity, gain).lanes[0];
+}
+
+// Returns the 4D fBm at `p` (see `noise_fbm2x8`)
+SOC_INLINE const float32 noise_fbm4(const NoiseType type, const Vector4& p, const uint32 octaves, const float32 lacunarity, const float32 gain) {
+  return noise_fbm4x8(type, floatx8(p.x), floatx8(p.y), floatx8(p.z), floatx8(p.w), octaves, lacunarity, gain).lanes[0];
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Loads up to 8 of the `count` points (of `dimensions` floats each) into `out_lanes` (one `floatx8` per dimension), 
+// repeating the last point in the missing lanes
+SOC_INLINE void noise_load_points(const float32* points, const uint32 dimensions, const uint32 count, floatx8* out_lanes) {
+  for(uint32 i = 0; i < 8; i++) {
+    const float32* point = points + (uint64)(i < count ? i : count - 1) * dimensions;
+
+    for(uint32 d = 0; d < dimensions; d++) {
+      out_lanes[d].lanes[i] = point[d];
+    }
+  }
+}
+
+// Writes the first `count` lanes of `values` into `out_values`
+SOC_INLINE void noise_store_values(const floatx8& values, const uint32 count, float32* out_values) {
+  if(count >= 8) {
+    floatx8_store(values, out_values);
+  }
+  else {
+    std::memcpy(out_values, values.lanes, count * sizeof(float32));
+  }
+}
+
+#endif
+
+// Writes the 2D fBm (see `noise_fbm2x8`) of each of the `count` `points` into `out_values`
+// NOTE: 8 points are done at a time, and every value is exactly the same as the one `noise_fbm2` gives.
+SOC_API void noise_fbm2_batch(const NoiseType type, 
+                              const Vector2* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void noise_fbm2_batch(const NoiseType type, 
+                              const Vector2* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values) {
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 p[2];
+    noise_load_points(points[i].components, 2, count - i, p);
+
+    noise_store_values(noise_fbm2x8(type, p[0], p[1], octaves, lacunarity, gain), count - i, out_values + i);
+  }
+}
+#endif
+
+// The same as `noise_fbm2_batch` but in 3D
+SOC_API void noise_fbm3_batch(const NoiseType type, 
+                              const Vector3* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void noise_fbm3_batch(const NoiseType type, 
+                              const Vector3* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values) {
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 p[3];
+    noise_load_points(points[i].components, 3, count - i, p);
+
+    noise_store_values(noise_fbm3x8(type, p[0], p[1], p[2], octaves, lacunarity, gain), count - i, out_values + i);
+  }
+}
+#endif
+
+// The same as `noise_fbm2_batch` but in 4D
+SOC_API void noise_fbm4_batch(const NoiseType type, 
+                              const Vector4* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void noise_fbm4_batch(const NoiseType type, 
+                              const Vector4* points, 
+                              const uint32 count, 
+                              const uint32 octaves, 
+                              const float32 lacunarity, 
+                              const float32 gain, 
+                              float32* out_values) {
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 p[4];
+    noise_load_points(points[i].components, 4, count - i, p);
+
+    noise_store_values(noise_fbm4x8(type, p[0], p[1], p[2], p[3], octaves, lacunarity, gain), count - i, out_values + i);
+  }
+}
+#endif
+
+// Fills the `width * height` `out_values` (row by row) with the 2D fBm (see `noise_fbm2x8`) of a grid 
+// that starts at `origin` and moves by `step` on each cell
+// NOTE: The value at `(x, y)` is exactly the same as `noise_fbm2` at `origin + Vector2(x, y) * step`.
+SOC_API void noise_fbm2_grid(const NoiseType type, 
+                             const Vector2& origin, 
+                             const Vector2& step, 
+                             const uint32 width, 
+                             const uint32 height, 
+                             const uint32 octaves, 
+                             const float32 lacunarity, 
+                             const float32 gain, 
+                             float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void noise_fbm2_grid(const NoiseType type, 
+                             const Vector2& origin, 
+                             const Vector2& step, 
+                             const uint32 width, 
+                             const uint32 height, 
+                             const uint32 octaves, 
+                             const float32 lacunarity, 
+                             const float32 gain, 
+                             float32* out_values) {
+  for(uint32 y = 0; y < height; y++) {
+    floatx8 py(origin.y + (float32)y * step.y);
+
+    for(uint32 x = 0; x < width; x += 8) {
+      floatx8 px;
+      for(uint32 i = 0; i < 8; i++) {
+        px.lanes[i] = origin.x + (float32)(x + i) * step.x;
+      }
+
+      noise_store_values(noise_fbm2x8(type, px, py, octaves, lacunarity, gain), width - x, out_values + (uint64)y * width + x);
+    }
+  }
+}
+#endif
+
+// Fills the `width * height * depth` `out_values` (row by row and then slice by slice) with the 3D fBm 
+// (see `noise_fbm2x8`) of a grid that starts at `origin` and moves by `step` on each cell
+// NOTE: The value at `(x, y, z)` is exactly the same as `noise_fbm3` at `origin + Vector3(x, y, z) * step`.
+SOC_API void noise_fbm3_grid(const NoiseType type, 
+                             const Vector3& origin, 
+                             const Vector3& step, 
+                             const uint32 width, 
+                             const uint32 height, 
+                             const uint32 depth, 
+                             const uint32 octaves, 
+                             const float32 lacunarity, 
+                             const float32 gain, 
+                             float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void noise_fbm3_grid(const NoiseType type, 
+                             const Vector3& origin, 
+                             const Vector3& step, 
+                             const uint32 width, 
+                             const uint32 height, 
+                             const uint32 depth, 
+                             const uint32 octaves, 
+                             const float32 lacunarity, 
+                             const float32 gain, 
+                             float32* out_values) {
+  for(uint32 z = 0; z < depth; z++) {
+    floatx8 pz(origin.z + (float32)z * step.z);
+
+    for(uint32 y = 0; y < height; y++) {
+      floatx8 py(origin.y + (float32)y * step.y);
+      float32* row = out_values + ((uint64)z * height + y) * width;
+
+      for(uint32 x = 0; x < width; x += 8) {
+        floatx8 px;
+        for(uint32 i = 0; i < 8; i++) {
+          px.lanes[i] = origin.x + (float32)(x + i) * step.x;
+        }
+
+        noise_store_values(noise_fbm3x8(type, px, py, pz, octaves, lacunarity, gain), width - x, row + x);
+      }
+    }
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Spline types
+///////////////////////////////////////////////////////////////
+
+// The kinds of cubic curves a `Spline` can be made of
+//
+// `SPLINE_BEZIER` uses every 4 control points as a cubic Bézier segment, where the last point of a segment is the first 
+// point of the next one (so `3 * segments + 1` points). 
+// `SPLINE_CATMULL_ROM` is a centripetal Catmull-Rom spline that passes through every point except the first and the last one, 
+// which only shape the ends (so `segments + 3` points). It never loops or cusps inside of a segment. 
+// `SPLINE_HERMITE` takes the points as `(position, tangent)` pairs (so `2 * (segments + 1)` points).
+enum SplineType {
+  SPLINE_BEZIER = 0, 
+  SPLINE_CATMULL_ROM, 
+  SPLINE_HERMITE,
+};
+
+// A curve of cubic segments with a table to move along it at a constant speed
+//
+// Each segment is kept as the 4 `coefficients` `a`, `b`, `c`, and `d` of `a*u^3 + b*u^2 + c*u + d`, no matter the `SplineType`, 
+// and the whole curve goes from `t = 0` to `t = 1`. `arc_params` holds the `t` at `arc_samples + 1` evenly spaced distances 
+// along the curve, which is what `spline_param_at_distance` looks up. Use `spline_memory_size` and `spline_create` to set one up.
+// NOTE: The spline does NOT own its memory.
+struct Spline {
+  Vector3* coefficients;
+  float32* arc_params;
+
+  uint32 segments_count;
+  uint32 arc_samples;
+  float32 length;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Spline functions
+///////////////////////////////////////////////////////////////
+
+// Returns the number of segments a spline of the given `type` makes out of `points_count` control points
+// NOTE: Returns 0 if there are not enough points for a single segment.
+SOC_INLINE const uint32 spline_segments_count(const SplineType type, const uint32 points_count) {
+  if(points_count < 4) {
+    return 0;
+  }
+
+  switch(type) {
+    case SPLINE_BEZIER:
+      return (points_count - 1) / 3;
+    case SPLINE_CATMULL_ROM:
+      return points_count - 3;
+    case SPLINE_HERMITE:
+      return (points_count / 2) - 1;
+  }
+
+  return 0;
+}
+
+// Returns the number of bytes a spline of `segments_count` segments and `arc_samples` arc-length samples needs
+SOC_INLINE const uint64 spline_memory_size(const uint32 segments_count, const uint32 arc_samples) {
+  return ((uint64)segments_count * 4 * sizeof(Vector3)) + (((uint64)arc_samples + 1) * sizeof(float32));
+}
+
+// Returns the segment of `spline` that `t` lands on and its local parameter in `out_u` 
+// NOTE: `t` gets clamped between 0 and 1.
+SOC_INLINE const uint32 spline_locate(const Spline& spline, const float32 t, float32* out_u) {
+  float32 clamped = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+  float32 scaled  = clamped * (float32)spline.segments_count;
+
+  uint32 segment = (uint32)scaled;
+  segment        = segment < spline.segments_count ? segment : spline.segments_count - 1;
+
+  *out_u = scaled - (float32)segment;
+  return segment;
+}
+
+// Returns the position on `spline` at `t` (from 0 to 1)
+SOC_INLINE const Vector3 spline_evaluate(const Spline& spline, const float32 t) {
+  float32 u;
+  const Vector3* coeff = spline.coefficients + (spline_locate(spline, t, &u) * 4);
+
+  return (((coeff[0] * u) + coeff[1]) * u + coeff[2]) * u + coeff[3];
+}
+
+// Returns the derivative of `spline` at `t` (from 0 to 1) 
+// NOTE: The tangent is NOT normalized. Its length is the speed (in units per 1 of `t`) of the curve at `t`.
+SOC_INLINE const Vector3 spline_tangent(const Spline& spline, const float32 t) {
+  float32 u;
+  const Vector3* coeff = spline.coefficients + (spline_locate(spline, t, &u) * 4);
+
+  return (((coeff[0] * (3.0f * u)) + (coeff[1] * 2.0f)) * u + coeff[2]) * (float32)spline.segments_count;
+}
+
+// Returns the `t` of `spline` that is `distance` units along the curve from its start, which takes O(1) time
+// NOTE: `distance` gets clamped between 0 and `spline.length`. Between the samples of `spline.arc_params`, 
+// `t` is linearly interpolated.
+SOC_INLINE const float32 spline_param_at_distance(const Spline& spline, const float32 distance) {
+  float32 scale  = spline.length > 0.0f ? (float32)spline.arc_samples / spline.length : 0.0f;
+  float32 scaled = distance * scale;
+  scaled         = scaled < 0.0f ? 0.0f : (scaled > (float32)spline.arc_samples ? (float32)spline.arc_samples : scaled);
+
+  uint32 index = (uint32)scaled;
+  index        = index < spline.arc_samples ? index : spline.arc_samples - 1;
+
+  float32 start = spline.arc_params[index];
+  return start + (spline.arc_params[index + 1] - start) * (scaled - (float32)index);
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Number of steps each segment gets integrated over when building the arc-length table of a `Spline` 
+#define SOC_SPLINE_ARC_STEPS 32
+
+// Returns the arc length of the segment `coeff` between `u0` and `u1` using a 5-point Gauss-Legendre quadrature
+SOC_INLINE const float32 spline_segment_length(const Vector3* coeff, const float32 u0, const float32 u1) {
+  const float32 nodes[5]   = {0.0f, -0.5384693101f, 0.5384693101f, -0.9061798459f, 0.9061798459f};
+  const float32 weights[5] = {0.5688888889f, 0.4786286705f, 0.4786286705f, 0.2369268851f, 0.2369268851f};
+
+  float32 half_range = (u1 - u0) * 0.5f;
+  float32 middle     = (u1 + u0) * 0.5f;
+  float32 length     = 0.0f;
+
+  for(uint32 i = 0; i < 5; i++) {
+    float32 u = middle + half_range * nodes[i];
+    length   += weights[i] * vec3_length(((coeff[0] * (3.0f * u)) + (coeff[1] * 2.0f)) * u + coeff[2]);
+  }
+
+  return length * half_range;
+}
+
+// Writes the polynomial coefficients of the cubic Hermite segment from `p0` to `p1` (with the tangents `m0` and `m1`) into `out_coeff`
+SOC_INLINE void spline_hermite_coefficients(const Vector3& p0, const Vector3& m0, const Vector3& p1, const Vector3& m1, Vector3* out_coeff) {
+  out_coeff[0] = (p0 * 2.0f) + m0 - (p1 * 2.0f) + m1;
+  out_coeff[1] = (p1 * 3.0f) - (p0 * 3.0f) - (m0 * 2.0f) - m1;
+  out_coeff[2] = m0;
+  out_coeff[3] = p0;
+}
+
+#endif
+
+// Creates and returns a spline of the given `type` through the `points_count` control `points` inside of `memory`, 
+// with an arc-length table of `arc_samples` samples
+// NOTE: `memory` must be at least `spline_memory_size(spline_segments_count(type, points_count), arc_samples)` bytes, 
+// and there must be at least 1 segment and 1 sample. The `points` are NOT kept around, so they can be freed afterwards. 
+// More `arc_samples` make `spline_param_at_distance` closer to a true constant speed (8 per segment is usually enough for smooth paths).
+SOC_API const Spline spline_create(void* memory, 
+                                   const SplineType type, 
+                                   const Vector3* points, 
+                                   const uint32 points_count, 
+                                   const uint32 arc_samples);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Spline spline_create(void* memory, 
+                                   const SplineType type, 
+                                   const Vector3* points, 
+                                   const uint32 points_count, 
+                                   const uint32 arc_samples) {
+  Spline spline;
+  spline.segments_count = spline_segments_count(type, points_count);
+  spline.arc_samples    = arc_samples;
+  spline.coefficients   = (Vector3*)memory;
+  spline.arc_params     = (float32*)(spline.coefficients + (spline.segments_count * 4));
+  spline.length         = 0.0f;
+
+  // Every type gets turned into the same polynomial form, so evaluating does not care about the type
+  for(uint32 i = 0; i < spline.segments_count; i++) {
+    Vector3* coeff = spline.coefficients + (i * 4);
+
+    switch(type) {
+      case SPLINE_BEZIER: {
+        const Vector3* p = points + (i * 3);
+
+        coeff[0] = (p[1] * 3.0f) - (p[2] * 3.0f) + p[3] - p[0];
+        coeff[1] = (p[0] * 3.0f) - (p[1] * 6.0f) + (p[2] * 3.0f);
+        coeff[2] = (p[1] - p[0]) * 3.0f;
+        coeff[3] = p[0];
+      } break;
+      case SPLINE_CATMULL_ROM: {
+        const Vector3* p = points + i;
+
+        // The knots are spaced by the square root of the distances between the points (hence "centripetal")
+        float32 d0 = (float32)sqrt(vec3_length(p[1] - p[0]));
+        float32 d1 = (float32)sqrt(vec3_length(p[2] - p[1]));
+        float32 d2 = (float32)sqrt(vec3_length(p[3] - p[2]));
+
+        // Points that are on top of each other would divide by zero
+        d1 = d1 < SOC_EPSILON ? 1.0f : d1;
+        d0 = d0 < SOC_EPSILON ? d1 : d0;
+        d2 = d2 < SOC_EPSILON ? d1 : d2;
+
+        Vector3 m1 = ((p[1] - p[0]) / d0) - ((p[2] - p[0]) / (d0 + d1)) + ((p[2] - p[1]) / d1);
+        Vector3 m2 = ((p[2] - p[1]) / d1) - ((p[3] - p[1]) / (d1 + d2)) + ((p[3] - p[2]) / d2);
+
+        spline_hermite_coefficients(p[1], m1 * d1, p[2], m2 * d1, coeff);
+      } break;
+      case SPLINE_HERMITE: {
+        const Vector3* p = points + (i * 2);
+        spline_hermite_coefficients(p[0], p[1], p[2], p[3], coeff);
+      } break;
+    }
+  }
+
+  // The first pass gets the total length...
+  float32 step = 1.0f / (float32)SOC_SPLINE_ARC_STEPS;
+  for(uint32 i = 0; i < spline.segments_count; i++) {
+    for(uint32 s = 0; s < SOC_SPLINE_ARC_STEPS; s++) {
+      spline.length += spline_segment_length(spline.coefficients + (i * 4), (float32)s * step, (float32)(s + 1) * step);
+    }
+  }
+
+  // ...and the second pass walks the exact same steps again to find the `t` at every sample distance
+  float32 sample_length = spline.length / (float32)arc_samples;
+  float32 walked        = 0.0f;
+  uint32 sample         = 1;
+
+  spline.arc_params[0] = 0.0f;
+  for(uint32 i = 0; i < spline.segments_count && sample < arc_samples; i++) {
+    for(uint32 s = 0; s < SOC_SPLINE_ARC_STEPS; s++) {
+      float32 u0     = (float32)s * step;
+      float32 u1     = (float32)(s + 1) * step;
+      float32 length = spline_segment_length(spline.coefficients + (i * 4), u0, u1);
+
+      while(sample < arc_samples && walked + length >= (float32)sample * sample_length) {
+        float32 amount            = length > 0.0f ? ((float32)sample * sample_length - walked) / length : 0.0f;
+        spline.arc_params[sample] = ((float32)i + u0 + (u1 - u0) * amount) / (float32)spline.segments_count;
+        sample++;
+      }
+
+      walked += length;
+    }
+  }
+
+  // Whatever rounding left over sits at the very end
+  for(; sample <= arc_samples; sample++) {
+    spline.arc_params[sample] = 1.0f;
+  }
+
+  return spline;
+}
+#endif
+
+#ifndef SOC_DECLARE_ONLY
+
+// Writes the position (and the tangent if `out_tangent` is not `nullptr`) of `spline` at `t`, looking up the segment only once
+SOC_INLINE void spline_evaluate_point(const Spline& spline, const float32 t, Vector3* out_position, Vector3* out_tangent) {
+  float32 u;
+  const Vector3* coeff = spline.coefficients + (spline_locate(spline, t, &u) * 4);
+
+  *out_position = (((coeff[0] * u) + coeff[1]) * u + coeff[2]) * u + coeff[3];
+  if(out_tangent) {
+    *out_tangent = (((coeff[0] * (3.0f * u)) + (coeff[1] * 2.0f)) * u + coeff[2]) * (float32)spline.segments_count;
+  }
+}
+
+#endif
+
+// Writes the positions of `spline` at each of the `count` `params` (from 0 to 1) into `out_positions`, and the 
+// tangents (see `spline_tangent`) into `out_tangents` 
+// NOTE: `out_tangents` can be `nullptr` if the tangents are not needed. The segment of each point is only looked up once, 
+// and every position and tangent is exactly the same as the one `spline_evaluate` and `spline_tangent` give.
+SOC_API void spline_evaluate_batch(const Spline& spline, 
+                                   const float32* params, 
+                                   const uint32 count, 
+                                   Vector3* out_positions, 
+                                   Vector3* out_tangents);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void spline_evaluate_batch(const Spline& spline, 
+                                   const float32* params, 
+                                   const uint32 count, 
+                                   Vector3* out_positions, 
+                                   Vector3* out_tangents) {
+  for(uint32 i = 0; i < count; i++) {
+    spline_evaluate_point(spline, params[i], out_positions + i, out_tangents ? out_tangents + i : nullptr);
+  }
+}
+#endif
+
+// The same as `spline_evaluate_batch` but each point is `distances[i]` units along `spline` 
+// (see `spline_param_at_distance`), which makes anything moving by the same distance every frame go at a constant speed
+SOC_API void spline_evaluate_distance_batch(const Spline& spline, 
+                                            const float32* distances, 
+                                            const uint32 count, 
+                                            Vector3* out_positions, 
+                                            Vector3* out_tangents);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void spline_evaluate_distance_batch(const Spline& spline, 
+                                            const float32* distances, 
+                                            const uint32 count, 
+                                            Vector3* out_positions, 
+                                            Vector3* out_tangents) {
+  for(uint32 i = 0; i < count; i++) {
+    spline_evaluate_point(spline, spline_param_at_distance(spline, distances[i]), out_positions + i, out_tangents ? out_tangents + i : nullptr);
+  }
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Random types
+///////////////////////////////////////////////////////////////
+
+// NOTE: The generators are xoshiro128** with their state seeded by splitmix64. Every `(seed, stream)` pair gives 
+// its own reproducible sequence, so giving each thread (or each chunk of work) its own `stream` keeps parallel 
+// generation deterministic no matter how the work gets scheduled. The generators are NOT thread-safe, and 
+// they are NOT meant for anything cryptographic.
+
+// A scalar random number generator (see `random_create`)
+struct Random {
+  uint32 state[4];
+};
+
+// 8 random number generators that run side by side, one in each lane (see `randomx8_create`)
+// NOTE: Lane `i` gives the exact same numbers as `random_create(seed, stream * 8 + i)`.
+struct Randomx8 {
+  uint32 state[4][8];
+};
+
+///////////////////////////////////////////////////////////////
+
+// Random functions
+///////////////////////////////////////////////////////////////
+
+// Advances the splitmix64 `state` and returns its next value
+// NOTE: Every step is done in 64 bits (`uint64` is 64 bits wide on every platform), so a `seed` gives the same 
+// sequence everywhere.
+SOC_INLINE const uint64 random_splitmix64(uint64& state) {
+  state   += 0x9e3779b97f4a7c15ull;
+  uint64 z = state;
+
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+// Returns `x` rotated to the left by `k` bits
+SOC_INLINE const uint32 random_rotl(const uint32 x, const uint32 k) {
+  return (x << k) | (x >> (32 - k));
+}
+
+// Creates and returns a generator for the given `seed` and `stream`
+SOC_INLINE const Random random_create(const uint64 seed, const uint32 stream) {
+  // Mixing the stream in first keeps neighboring streams far apart from each other
+  uint64 stream_state = stream;
+  uint64 state        = seed ^ random_splitmix64(stream_state);
+
+  uint64 low  = random_splitmix64(state);
+  uint64 high = random_splitmix64(state);
+
+  Random random;
+  random.state[0] = (uint32)low;
+  random.state[1] = (uint32)(low >> 32);
+  random.state[2] = (uint32)high;
+  random.state[3] = (uint32)(high >> 32) | 1; // The state can never be all zeros
+
+  return random;
+}
+
+// Returns the next random 32-bit number of `random`
+SOC_INLINE const uint32 random_next(Random& random) {
+  uint32* s     = random.state;
+  uint32 result = random_rotl(s[1] * 5, 7) * 9;
+  uint32 t      = s[1] << 9;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3]  = random_rotl(s[3], 11);
+
+  return result;
+}
+
+// Returns a random float in `[0, 1)`
+// NOTE: The float is made from the top 24 bits of `random_next`, so every value is a multiple of `2^-24`.
+SOC_INLINE const float32 random_float(Random& random) {
+  return (float32)(random_next(random) >> 8) * (1.0f / 16777216.0f);
+}
+
+// NOTE: The sampling functions below (along with their `Randomx8` and `*_batch` versions) are compiled without fused 
+// multiply-adds (see `SOC_FP_STRICT_BEGIN`), so a `(seed, stream)` pair gives the exact same values in every build.
+SOC_FP_STRICT_BEGIN
+
+// Returns a random float in `[min, max)`
+SOC_INLINE const float32 random_float_range(Random& random, const float32 min, const float32 max) {
+  return min + (max - min) * random_float(random);
+}
+
+// Returns a uniformly distributed random point inside of the unit disk
+SOC_INLINE const Vector2 random_vec2_in_disk(Random& random) {
+  float32 radius = std::sqrt(random_float(random));
+  Vector2 sc     = sincos_fast(random_float(random) * (float32)(SOC_PI * 2.0));
+
+  return Vector2(sc.y * radius, sc.x * radius);
+}
+
+// Returns a uniformly distributed random unit vector (a point on the unit sphere)
+SOC_INLINE const Vector3 random_unit_vec3(Random& random) {
+  float32 z      = 1.0f - 2.0f * random_float(random);
+  float32 radius = std::sqrt(1.0f - z * z);
+  Vector2 sc     = sincos_fast(random_float(random) * (float32)(SOC_PI * 2.0));
+
+  return Vector3(sc.y * radius, sc.x * radius, z);
+}
+
+// Returns a uniformly distributed random unit vector on the hemisphere around `normal`
+// NOTE: `normal` does not need to be normalized.
+SOC_INLINE const Vector3 random_unit_vec3_hemisphere(Random& random, const Vector3& normal) {
+  Vector3 v = random_unit_vec3(random);
+  return vec3_dot(v, normal) < 0.0f ? -v : v;
+}
+
+// Returns a uniformly distributed random point inside of the unit sphere
+SOC_INLINE const Vector3 random_vec3_in_sphere(Random& random) {
+  Vector3 v = random_unit_vec3(random);
+  return v * std::cbrt(random_float(random));
+}
+
+// Returns a uniformly distributed random point inside of `aabb`
+SOC_INLINE const Vector3 random_vec3_in_aabb(Random& random, const AABB& aabb) {
+  float32 x = random_float(random);
+  float32 y = random_float(random);
+  float32 z = random_float(random);
+
+  return aabb.min + (aabb.max - aabb.min) * Vector3(x, y, z);
+}
+
+// Returns a uniformly distributed random rotation
+// NOTE: Uses Shoemake's method, so the rotations are uniform over the whole sphere of rotations.
+SOC_INLINE const Quaternion random_quat(Random& random) {
+  float32 u = random_float(random);
+  float32 a = std::sqrt(1.0f - u);
+  float32 b = std::sqrt(u);
+
+  Vector2 sc1 = sincos_fast(random_float(random) * (float32)(SOC_PI * 2.0));
+  Vector2 sc2 = sincos_fast(random_float(random) * (float32)(SOC_PI * 2.0));
+
+  return Quaternion(a * sc1.x, a * sc1.y, b * sc2.x, b * sc2.y);
+}
+
+SOC_FP_STRICT_END
+
+// Creates and returns 8 generators for the given `seed` and `stream` 
+// NOTE: Lane `i` is `random_create(seed, stream * 8 + i)`, so two `Randomx8`s never share a lane with the same `stream`.
+SOC_INLINE const Randomx8 randomx8_create(const uint64 seed, const uint32 stream) {
+  Randomx8 random;
+
+  for(uint32 i = 0; i < 8; i++) {
+    Random lane = random_create(seed, stream * 8 + i);
+    for(uint32 s = 0; s < 4; s++) {
+      random.state[s][i] = lane.state[s];
+    }
+  }
+
+  return random;
+}
+
+#ifdef SOC_SIMD_SSE
+
+// Returns `x` rotated to the left by `k` bits on every lane
+#define SOC_RANDOM_ROTL(x, k) _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - (k)))
+
+// Advances the 4 lanes of `random` starting at `lane` and returns their next random floats (see `random_float`)
+SOC_INLINE __m128 randomx4_next_float(Randomx8& random, const uint32 lane) {
+  __m128i s0 = _mm_loadu_si128((__m128i*)(random.state[0] + lane));
+  __m128i s1 = _mm_loadu_si128((__m128i*)(random.state[1] + lane));
+  __m128i s2 = _mm_loadu_si128((__m128i*)(random.state[2] + lane));
+  __m128i s3 = _mm_loadu_si128((__m128i*)(random.state[3] + lane));
+
+  // SSE2 has no 32-bit multiply, so `* 5` and `* 9` are done with shifts
+  __m128i x5     = _mm_add_epi32(_mm_slli_epi32(s1, 2), s1);
+  __m128i rot    = SOC_RANDOM_ROTL(x5, 7);
+  __m128i result = _mm_add_epi32(_mm_slli_epi32(rot, 3), rot);
+  __m128i t      = _mm_slli_epi32(s1, 9);
+
+  s2 = _mm_xor_si128(s2, s0);
+  s3 = _mm_xor_si128(s3, s1);
+  s1 = _mm_xor_si128(s1, s2);
+  s0 = _mm_xor_si128(s0, s3);
+  s2 = _mm_xor_si128(s2, t);
+  s3 = SOC_RANDOM_ROTL(s3, 11);
+
+  _mm_storeu_si128((__m128i*)(random.state[0] + lane), s0);
+  _mm_storeu_si128((__m128i*)(random.state[1] + lane), s1);
+  _mm_storeu_si128((__m128i*)(random.state[2] + lane), s2);
+  _mm_storeu_si128((__m128i*)(random.state[3] + lane), s3);
+
+  return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+}
+
+#undef SOC_RANDOM_ROTL
+
+#endif
+
+// Returns the next random float in `[0, 1)` of every lane of `random` 
+// NOTE: Every lane gives the exact same numbers as `random_float` on its own scalar generator.
+SOC_INLINE const floatx8 randomx8_float(Randomx8& random) {
+#if defined(SOC_SIMD_AVX)
+  return floatx8(_mm256_insertf128_ps(_mm256_castps128_ps256(randomx4_next_float(random, 0)), randomx4_next_float(random, 4), 1));
+#elif defined(SOC_SIMD_SSE)
+  return floatx8(floatx4(randomx4_next_float(random, 0)), floatx4(randomx4_next_float(random, 4)));
+#else
+  floatx8 result;
+  for(uint32 i = 0; i < 8; i++) {
+    Random lane = {{random.state[0][i], random.state[1][i], random.state[2][i], random.state[3][i]}};
+    result.lanes[i] = random_float(lane);
+
+    for(uint32 s = 0; s < 4; s++) {
+      random.state[s][i] = lane.state[s];
+    }
+  }
+
+  return result;
+#endif
+}
+
+SOC_FP_STRICT_BEGIN
+
+#ifndef SOC_DECLARE_ONLY
+
+// Returns 8 uniformly distributed random unit vectors (see `random_unit_vec3`)
+SOC_INLINE const Vector3x8 randomx8_unit_vec3(Randomx8& random) {
+  floatx8 z      = floatx8(1.0f) - floatx8(2.0f) * randomx8_float(random);
+  floatx8 radius = floatx8_sqrt(floatx8(1.0f) - z * z);
+
+  floatx8 sin, cos;
+  floatx8_sincos_fast(randomx8_float(random) * floatx8((float32)(SOC_PI * 2.0)), &sin, &cos);
+
+  return Vector3x8(cos * radius, sin * radius, z);
+}
+
+// Stores the first `count` vectors of `v` into `out_vectors`
+SOC_INLINE void random_store_vec3x8(const Vector3x8& v, const uint32 count, Vector3* out_vectors) {
+  if(count >= 8) {
+    vec3x8_store(v, out_vectors);
+    return;
+  }
+
+  for(uint32 i = 0; i < count; i++) {
+    out_vectors[i] = vec3x8_get(v, i);
+  }
+}
+
+#endif
+
+// NOTE: All of the `*_batch` functions below fill 8 values at a time, one from each lane of `random`, so output `i` 
+// comes from lane `i % 8`. The lanes draw their numbers in the same order as the scalar functions, which means 
+// that the results are exactly the same as calling the scalar version on the scalar generator of each lane. 
+// When `count` is not a multiple of 8, the lanes of the last (partial) group still get advanced.
+
+// Fills `out_values` with `count` random floats in `[min, max)` (see `random_float_range`)
+SOC_API void random_float_batch(Randomx8& random, const float32 min, const float32 max, const uint32 count, float32* out_values);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_float_batch(Randomx8& random, const float32 min, const float32 max, const uint32 count, float32* out_values) {
+  floatx8 start(min);
+  floatx8 range(max - min);
+
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 values = start + range * randomx8_float(random);
+
+    if(count - i >= 8) {
+      floatx8_store(values, out_values + i);
+    }
+    else {
+      std::memcpy(out_values + i, values.lanes, (count - i) * sizeof(float32));
+    }
+  }
+}
+#endif
+
+// Fills `out_points` with `count` uniformly distributed random points inside of the unit disk (see `random_vec2_in_disk`)
+SOC_API void random_vec2_in_disk_batch(Randomx8& random, const uint32 count, Vector2* out_points);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_vec2_in_disk_batch(Randomx8& random, const uint32 count, Vector2* out_points) {
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 radius = floatx8_sqrt(randomx8_float(random));
+
+    floatx8 sin, cos;
+    floatx8_sincos_fast(randomx8_float(random) * floatx8((float32)(SOC_PI * 2.0)), &sin, &cos);
+
+    floatx8 x = cos * radius;
+    floatx8 y = sin * radius;
+
+    uint32 lanes = (count - i) < 8 ? (count - i) : 8;
+    for(uint32 j = 0; j < lanes; j++) {
+      out_points[i + j] = Vector2(x.lanes[j], y.lanes[j]);
+    }
+  }
+}
+#endif
+
+// Fills `out_vectors` with `count` uniformly distributed random unit vectors (see `random_unit_vec3`)
+SOC_API void random_unit_vec3_batch(Randomx8& random, const uint32 count, Vector3* out_vectors);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_unit_vec3_batch(Randomx8& random, const uint32 count, Vector3* out_vectors) {
+  for(uint32 i = 0; i < count; i += 8) {
+    random_store_vec3x8(randomx8_unit_vec3(random), count - i, out_vectors + i);
+  }
+}
+#endif
+
+// Fills `out_vectors` with `count` uniformly distributed random unit vectors on the hemisphere around `normal` 
+// (see `random_unit_vec3_hemisphere`)
+SOC_API void random_unit_vec3_hemisphere_batch(Randomx8& random, const Vector3& normal, const uint32 count, Vector3* out_vectors);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_unit_vec3_hemisphere_batch(Randomx8& random, const Vector3& normal, const uint32 count, Vector3* out_vectors) {
+  Vector3x8 n(normal);
+  floatx8 zero(0.0f);
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 v = randomx8_unit_vec3(random);
+    random_store_vec3x8(vec3x8_select(vec3x8_dot(v, n) < zero, -v, v), count - i, out_vectors + i);
+  }
+}
+#endif
+
+// Fills `out_points` with `count` uniformly distributed random points inside of the unit sphere (see `random_vec3_in_sphere`)
+SOC_API void random_vec3_in_sphere_batch(Randomx8& random, const uint32 count, Vector3* out_points);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_vec3_in_sphere_batch(Randomx8& random, const uint32 count, Vector3* out_points) {
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 v     = randomx8_unit_vec3(random);
+    floatx8 radius  = randomx8_float(random);
+
+    // There is no wide cube root, but this is the cheap part anyway
+    for(uint32 j = 0; j < 8; j++) {
+      radius.lanes[j] = std::cbrt(radius.lanes[j]);
+    }
+
+    random_store_vec3x8(v * radius, count - i, out_points + i);
+  }
+}
+#endif
+
+// Fills `out_points` with `count` uniformly distributed random points inside of `aabb` (see `random_vec3_in_aabb`)
+SOC_API void random_vec3_in_aabb_batch(Randomx8& random, const AABB& aabb, const uint32 count, Vector3* out_points);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_vec3_in_aabb_batch(Randomx8& random, const AABB& aabb, const uint32 count, Vector3* out_points) {
+  Vector3x8 min(aabb.min);
+  Vector3x8 size(aabb.max - aabb.min);
+
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 x = randomx8_float(random);
+    floatx8 y = randomx8_float(random);
+    floatx8 z = randomx8_float(random);
+
+    random_store_vec3x8(min + size * Vector3x8(x, y, z), count - i, out_points + i);
+  }
+}
+#endif
+
+// Fills `out_rotations` with `count` uniformly distributed random rotations (see `random_quat`)
+SOC_API void random_quat_batch(Randomx8& random, const uint32 count, Quaternion* out_rotations);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void random_quat_batch(Randomx8& random, const uint32 count, Quaternion* out_rotations) {
+  floatx8 two_pi((float32)(SOC_PI * 2.0));
+
+  for(uint32 i = 0; i < count; i += 8) {
+    floatx8 u = randomx8_float(random);
+    floatx8 a = floatx8_sqrt(floatx8(1.0f) - u);
+    floatx8 b = floatx8_sqrt(u);
+
+    floatx8 sin1, cos1, sin2, cos2;
+    floatx8_sincos_fast(randomx8_float(random) * two_pi, &sin1, &cos1);
+    floatx8_sincos_fast(randomx8_float(random) * two_pi, &sin2, &cos2);
+
+    floatx8 x = a * sin1;
+    floatx8 y = a * cos1;
+    floatx8 z = b * sin2;
+    floatx8 w = b * cos2;
+
+    uint32 lanes = (count - i) < 8 ? (count - i) : 8;
+    for(uint32 j = 0; j < lanes; j++) {
+      out_rotations[i + j] = Quaternion(x.lanes[j], y.lanes[j], z.lanes[j], w.lanes[j]);
+    }
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// Collision types
+///////////////////////////////////////////////////////////////
+
+// NOTE: Every contact between a shape `a` and a shape `b` has a `normal` that points from `a` towards `b` 
+// (moving `b` by `normal * depth` pulls the shapes apart) and a `depth` that is how far the shapes go into each other.
+
+// A sphere
+struct Sphere {
+  Vector3 center; 
+  float32 radius;
+
+  // Default CTOR with a sphere of no size at the origin
+  Sphere() 
+    :center(0.0f), radius(0.0f)
+  {}
+
+  // Takes the `center` and the `radius` of the sphere
+  Sphere(const Vector3& center, const float32 radius) 
+    :center(center), radius(radius)
+  {}
+};
+
+// A capsule (every point within `radius` of the segment from `start` to `end`)
+struct Capsule {
+  Vector3 start; 
+  Vector3 end; 
+  float32 radius;
+
+  // Default CTOR with a capsule of no size at the origin
+  Capsule() 
+    :start(0.0f), end(0.0f), radius(0.0f)
+  {}
+
+  // Takes the `start` and `end` of the segment and the `radius` around it
+  Capsule(const Vector3& start, const Vector3& end, const float32 radius) 
+    :start(start), end(end), radius(radius)
+  {}
+};
+
+// An oriented bounding box
+// NOTE: The columns of `orientation` are the local X, Y, and Z axes of the box, which must be normalized and perpendicular, 
+// and `extents` is half the size of the box along each of them.
+struct OBB {
+  Vector3 center; 
+  Vector3 extents;
+  Matrix3 orientation;
+
+  // Default CTOR with a box of no size at the origin
+  OBB() 
+    :center(0.0f), extents(0.0f), orientation()
+  {}
+
+  // Takes the `center`, the half-sizes (`extents`), and the `orientation` of the box
+  OBB(const Vector3& center, const Vector3& extents, const Matrix3& orientation) 
+    :center(center), extents(extents), orientation(orientation)
+  {}
+};
+
+// The contact between two shapes (see the note above)
+struct Contact {
+  Vector3 normal; 
+  float32 depth;
+
+  // Default CTOR with a normal pointing up and no depth
+  Contact() 
+    :normal(0.0f, 1.0f, 0.0f), depth(0.0f)
+  {}
+};
+
+// An array of spheres stored as SoA
+struct SphereSoA {
+  Vector3SoA centers; 
+  float32* radii;
+};
+
+// An array of capsules stored as SoA
+struct CapsuleSoA {
+  Vector3SoA starts;
+  Vector3SoA ends;
+  float32* radii;
+};
+
+// An array of AABBs stored as SoA
+struct AABBSoA {
+  Vector3SoA mins; 
+  Vector3SoA maxs;
+};
+
+// An array of OBBs stored as SoA, with the 3 columns of each orientation in `axes`
+struct OBBSoA {
+  Vector3SoA centers; 
+  Vector3SoA extents;
+  Vector3SoA axes[3];
+};
+
+// The contacts of an array of shape pairs stored as SoA
+// NOTE: `hits` has one bit per pair (pair `i` is bit `i % 8` of `hits[i / 8]`), and the `normals` and `depths` 
+// only mean something for the pairs whose bit is on.
+struct ContactSoA {
+  uint8* hits;
+  Vector3SoA normals;
+  float32* depths;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Collision functions
+///////////////////////////////////////////////////////////////
+
+// Returns the number of bytes a `SphereSoA` of `count` spheres needs
+SOC_INLINE const uint64 sphere_soa_memory_size(const uint32 count) {
+  return soa_memory_size(4, count);
+}
+
+// Creates and returns a zeroed `SphereSoA` of `count` spheres inside of `memory`
+// NOTE: `memory` must be at least `sphere_soa_memory_size(count)` bytes.
+SOC_INLINE const SphereSoA sphere_soa_create(void* memory, const uint32 count) {
+  float32* arrays[4];
+  soa_split_memory(memory, 4, count, arrays);
+
+  return SphereSoA{Vector3SoA{arrays[0], arrays[1], arrays[2], count}, arrays[3]};
+}
+
+// Returns the number of bytes a `CapsuleSoA` of `count` capsules needs
+SOC_INLINE const uint64 capsule_soa_memory_size(const uint32 count) {
+  return soa_memory_size(7, count);
+}
+
+// Creates and returns a zeroed `CapsuleSoA` of `count` capsules inside of `memory`
+// NOTE: `memory` must be at least `capsule_soa_memory_size(count)` bytes.
+SOC_INLINE const CapsuleSoA capsule_soa_create(void* memory, const uint32 count) {
+  float32* arrays[7];
+  soa_split_memory(memory, 7, count, arrays);
+
+  return CapsuleSoA{Vector3SoA{arrays[0], arrays[1], arrays[2], count}, Vector3SoA{arrays[3], arrays[4], arrays[5], count}, arrays[6]};
+}
+
+// Returns the number of bytes an `AABBSoA` of `count` boxes needs
+SOC_INLINE const uint64 aabb_soa_memory_size(const uint32 count) {
+  return soa_memory_size(6, count);
+}
+
+// Creates and returns a zeroed `AABBSoA` of `count` boxes inside of `memory`
+// NOTE: `memory` must be at least `aabb_soa_memory_size(count)` bytes.
+SOC_INLINE const AABBSoA aabb_soa_create(void* memory, const uint32 count) {
+  float32* arrays[6];
+  soa_split_memory(memory, 6, count, arrays);
+
+  return AABBSoA{Vector3SoA{arrays[0], arrays[1], arrays[2], count}, Vector3SoA{arrays[3], arrays[4], arrays[5], count}};
+}
+
+// Returns the number of bytes an `OBBSoA` of `count` boxes needs
+SOC_INLINE const uint64 obb_soa_memory_size(const uint32 count) {
+  return soa_memory_size(15, count);
+}
+
+// Creates and returns a zeroed `OBBSoA` of `count` boxes inside of `memory`
+// NOTE: `memory` must be at least `obb_soa_memory_size(count)` bytes.
+SOC_INLINE const OBBSoA obb_soa_create(void* memory, const uint32 count) {
+  float32* arrays[15];
+  soa_split_memory(memory, 15, count, arrays);
+
+  OBBSoA soa;
+  soa.centers = Vector3SoA{arrays[0], arrays[1], arrays[2], count};
+  soa.extents = Vector3SoA{arrays[3], arrays[4], arrays[5], count};
+  soa.axes[0] = Vector3SoA{arrays[6], arrays[7], arrays[8], count};
+  soa.axes[1] = Vector3SoA{arrays[9], arrays[10], arrays[11], count};
+  soa.axes[2] = Vector3SoA{arrays[12], arrays[13], arrays[14], count};
+
+  return soa;
+}
+
+// Returns the number of bytes a `ContactSoA` of `count` pairs needs
+SOC_INLINE const uint64 contact_soa_memory_size(const uint32 count) {
+  return soa_memory_size(5, count);
+}
+
+// Creates and returns a zeroed `ContactSoA` of `count` pairs inside of `memory`
+// NOTE: `memory` must be at least `contact_soa_memory_size(count)` bytes.
+SOC_INLINE const ContactSoA contact_soa_create(void* memory, const uint32 count) {
+  float32* arrays[5];
+  soa_split_memory(memory, 5, count, arrays);
+
+  // The hit bits only need an eighth of a byte per pair, so a whole array is more than enough
+  return ContactSoA{(uint8*)arrays[4], Vector3SoA{arrays[0], arrays[1], arrays[2], count}, arrays[3]};
+}
+
+// Returns the local `axis` (0, 1, or 2) of `obb` in world space
+SOC_INLINE const Vector3 obb_axis(const OBB& obb, const uint32 axis) {
+  return Vector3(obb.orientation.data[axis * 3 + 0], obb.orientation.data[axis * 3 + 1], obb.orientation.data[axis * 3 + 2]);
+}
+
+SOC_FP_STRICT_BEGIN
+
+// Returns `value` between `min` and `max` 
+// NOTE: Picks the same value as `floatx4_clamp` and `floatx8_clamp` in every case, which keeps the scalar and the 
+// batch collision functions exactly the same.
+SOC_INLINE const float32 collision_clamp(const float32 value, const float32 min, const float32 max) {
+  float32 low = value > min ? value : min;
+  return low < max ? low : max;
+}
+
+// Returns the point on the segment from `start` to `end` that is the closest to `point`
+SOC_INLINE const Vector3 segment_closest_point(const Vector3& start, const Vector3& end, const Vector3& point) {
+  Vector3 dir      = end - start;
+  float32 length2  = vec3_dot(dir, dir);
+  float32 amount   = vec3_dot(point - start, dir) / (length2 > SOC_EPSILON ? length2 : 1.0f);
+
+  return start + dir * collision_clamp(amount, 0.0f, 1.0f);
+}
+
+// Finds the closest points between the segment from `start1` to `end1` and the segment from `start2` to `end2` 
+// and writes them into `out_point1` and `out_point2` respectively
+SOC_INLINE void segment_closest_points(const Vector3& start1, 
+                                       const Vector3& end1, 
+                                       const Vector3& start2, 
+                                       const Vector3& end2, 
+                                       Vector3* out_point1, 
+                                       Vector3* out_point2) {
+  Vector3 d1 = end1 - start1;
+  Vector3 d2 = end2 - start2;
+  Vector3 r  = start1 - start2;
+
+  float32 a = vec3_dot(d1, d1);
+  float32 b = vec3_dot(d1, d2);
+  float32 c = vec3_dot(d1, r);
+  float32 e = vec3_dot(d2, d2);
+  float32 f = vec3_dot(d2, r);
+
+  // Branchless version of "Real-Time Collision Detection" 5.1.9 (so it matches the batch functions exactly)
+  float32 safe_a = a > SOC_EPSILON ? a : 1.0f;
+  float32 safe_e = e > SOC_EPSILON ? e : 1.0f;
+  float32 denom  = (a * e) - (b * b);
+
+  float32 s = denom > 0.0f ? collision_clamp(((b * f) - (c * e)) / denom, 0.0f, 1.0f) : 0.0f;
+  float32 t = ((b * s) + f) / safe_e;
+
+  float32 s_start = collision_clamp(-c / safe_a, 0.0f, 1.0f);
+  float32 s_end   = collision_clamp((b - c) / safe_a, 0.0f, 1.0f);
+
+  s = t < 0.0f ? s_start : (t > 1.0f ? s_end : s);
+  t = collision_clamp(t, 0.0f, 1.0f);
+
+  // Either segment can be a single point 
+  float32 t_only = collision_clamp(f / safe_e, 0.0f, 1.0f);
+
+  s = e > SOC_EPSILON ? s : s_start;
+  t = e > SOC_EPSILON ? t : 0.0f;
+  s = a > SOC_EPSILON ? s : 0.0f;
+  t = a > SOC_EPSILON ? t : t_only;
+
+  *out_point1 = start1 + d1 * s;
+  *out_point2 = start2 + d2 * t;
+}
+
+// Returns the point inside of `box` that is the closest to `point`
+SOC_INLINE const Vector3 aabb_closest_point(const AABB& box, const Vector3& point) {
+  return Vector3(collision_clamp(point.x, box.min.x, box.max.x), 
+                 collision_clamp(point.y, box.min.y, box.max.y), 
+                 collision_clamp(point.z, box.min.z, box.max.z));
+}
+
+// Returns the point inside of `obb` that is the closest to `point`
+SOC_INLINE const Vector3 obb_closest_point(const OBB& obb, const Vector3& point) {
+  Vector3 diff   = point - obb.center;
+  Vector3 result = obb.center;
+
+  for(uint32 i = 0; i < 3; i++) {
+    Vector3 axis = obb_axis(obb, i);
+    result      += axis * collision_clamp(vec3_dot(diff, axis), -obb.extents.components[i], obb.extents.components[i]);
+  }
+
+  return result;
+}
+
+// Returns the point inside of `sphere` that is the closest to `point`
+SOC_INLINE const Vector3 sphere_closest_point(const Sphere& sphere, const Vector3& point) {
+  Vector3 diff     = point - sphere.center;
+  float32 length2  = vec3_dot(diff, diff);
+
+  if(length2 <= (sphere.radius * sphere.radius)) {
+    return point;
+  }
+
+  return sphere.center + diff * (sphere.radius / (float32)sqrt(length2));
+}
+
+// Returns the point inside of `capsule` that is the closest to `point`
+SOC_INLINE const Vector3 capsule_closest_point(const Capsule& capsule, const Vector3& point) {
+  return sphere_closest_point(Sphere(segment_closest_point(capsule.start, capsule.end, point), capsule.radius), point);
+}
+
+// Returns true if the sphere at `center1` with `radius1` and the sphere at `center2` with `radius2` overlap 
+// and writes their contact into `out_contact` (see `sphere_contact`)
+SOC_INLINE const bool collision_sphere_contact(const Vector3& center1, 
+                                               const float32 radius1, 
+                                               const Vector3& center2, 
+                                               const float32 radius2, 
+                                               Contact* out_contact) {
+  Vector3 diff    = center2 - center1;
+  float32 dist2   = vec3_dot(diff, diff);
+  float32 radius  = radius1 + radius2;
+  float32 dist    = (float32)sqrt(dist2);
+
+  // Spheres right on top of each other get pushed apart along Y
+  out_contact->normal = dist > SOC_EPSILON ? diff / dist : Vector3(0.0f, 1.0f, 0.0f);
+  out_contact->depth  = radius - dist;
+
+  return dist2 <= (radius * radius);
+}
+
+// Returns true if the spheres `a` and `b` overlap 
+SOC_INLINE const bool sphere_overlap(const Sphere& a, const Sphere& b) {
+  float32 radius = a.radius + b.radius;
+  return vec3_distance_squared(a.center, b.center) <= (radius * radius);
+}
+
+// Returns true if the spheres `a` and `b` overlap and writes their contact into `out_contact`
+// NOTE: `out_contact` always gets written, and the depth is the negative distance between the spheres if they do not overlap.
+SOC_INLINE const bool sphere_contact(const Sphere& a, const Sphere& b, Contact* out_contact) {
+  return collision_sphere_contact(a.center, a.radius, b.center, b.radius, out_contact);
+}
+
+// Returns true if `sphere` and `capsule` overlap 
+SOC_INLINE const bool sphere_capsule_overlap(const Sphere& sphere, const Capsule& capsule) {
+  float32 radius = sphere.radius + capsule.radius;
+  Vector3 point  = segment_closest_point(capsule.start, capsule.end, sphere.center);
+
+  return vec3_distance_squared(sphere.center, point) <= (radius * radius);
+}
+
+// Returns true if `sphere` and `capsule` overlap and writes their contact into `out_contact` (see `sphere_contact`)
+SOC_INLINE const bool sphere_capsule_contact(const Sphere& sphere, const Capsule& capsule, Contact* out_contact) {
+  Vector3 point = segment_closest_point(capsule.start, capsule.end, sphere.center);
+  return collision_sphere_contact(sphere.center, sphere.radius, point, capsule.radius, out_contact);
+}
+
+// Returns true if the capsules `a` and `b` overlap 
+SOC_INLINE const bool capsule_overlap(const Capsule& a, const Capsule& b) {
+  Vector3 point1, point2;
+  segment_closest_points(a.start, a.end, b.start, b.end, &point1, &point2);
+
+  float32 radius = a.radius + b.radius;
+  return vec3_distance_squared(point1, point2) <= (radius * radius);
+}
+
+// Returns true if the capsules `a` and `b` overlap and writes their contact into `out_contact` (see `sphere_contact`)
+SOC_INLINE const bool capsule_contact(const Capsule& a, const Capsule& b, Contact* out_contact) {
+  Vector3 point1, point2;
+  segment_closest_points(a.start, a.end, b.start, b.end, &point1, &point2);
+
+  return collision_sphere_contact(point1, a.radius, point2, b.radius, out_contact);
+}
+
+// Returns true if `sphere` and `box` overlap 
+SOC_INLINE const bool sphere_aabb_overlap(const Sphere& sphere, const AABB& box) {
+  return vec3_distance_squared(sphere.center, aabb_closest_point(box, sphere.center)) <= (sphere.radius * sphere.radius);
+}
+
+// Writes the contact between a sphere at `center` with `radius` and the box around the origin with `extents` 
+// into `out_contact` and returns true if they overlap (everything is in the local space of the box)
+SOC_INLINE const bool collision_sphere_box_contact(const Vector3& center, const float32 radius, const Vector3& extents, Contact* out_contact) {
+  Vector3 closest(collision_clamp(center.x, -extents.x, extents.x), 
+                  collision_clamp(center.y, -extents.y, extents.y), 
+                  collision_clamp(center.z, -extents.z, extents.z));
+
+  Vector3 diff  = closest - center;
+  float32 dist2 = vec3_dot(diff, diff);
+  float32 dist  = (float32)sqrt(dist2);
+
+  // When the center is inside of the box, the sphere gets pushed out of the closest face
+  float32 face_dist = extents.x - center.x;
+  Vector3 face_normal(-1.0f, 0.0f, 0.0f);
+
+  float32 faces[5] = {extents.x + center.x, extents.y - center.y, extents.y + center.y, extents.z - center.z, extents.z + center.z};
+  Vector3 normals[5] = {
+    Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f), Vector3(0.0f, 0.0f, 1.0f),
+  };
+
+  for(uint32 i = 0; i < 5; i++) {
+    face_normal = faces[i] < face_dist ? normals[i] : face_normal;
+    face_dist   = faces[i] < face_dist ? faces[i] : face_dist;
+  }
+
+  bool outside        = dist2 > 0.0f;
+  out_contact->normal = outside ? diff / dist : face_normal;
+  out_contact->depth  = outside ? radius - dist : radius + face_dist;
+
+  return dist2 <= (radius * radius);
+}
+
+// Returns true if `sphere` and `box` overlap and writes their contact into `out_contact` 
+// NOTE: `out_contact` always gets written. If the center of the sphere is inside of the box, the contact pushes 
+// the sphere out of the closest face.
+SOC_INLINE const bool sphere_aabb_contact(const Sphere& sphere, const AABB& box, Contact* out_contact) {
+  Vector3 center  = (box.min + box.max) * 0.5f;
+  Vector3 extents = (box.max - box.min) * 0.5f;
+
+  return collision_sphere_box_contact(sphere.center - center, sphere.radius, extents, out_contact);
+}
+
+// Returns true if `sphere` and `obb` overlap 
+SOC_INLINE const bool sphere_obb_overlap(const Sphere& sphere, const OBB& obb) {
+  return vec3_distance_squared(sphere.center, obb_closest_point(obb, sphere.center)) <= (sphere.radius * sphere.radius);
+}
+
+// Returns true if `sphere` and `obb` overlap and writes their contact into `out_contact` (see `sphere_aabb_contact`)
+SOC_INLINE const bool sphere_obb_contact(const Sphere& sphere, const OBB& obb, Contact* out_contact) {
+  Vector3 axes[3] = {obb_axis(obb, 0), obb_axis(obb, 1), obb_axis(obb, 2)};
+  Vector3 diff    = sphere.center - obb.center;
+
+  Vector3 local(vec3_dot(diff, axes[0]), vec3_dot(diff, axes[1]), vec3_dot(diff, axes[2]));
+  bool hit = collision_sphere_box_contact(local, sphere.radius, obb.extents, out_contact);
+
+  Vector3 normal      = out_contact->normal;
+  out_contact->normal = (axes[0] * normal.x) + (axes[1] * normal.y) + (axes[2] * normal.z);
+
+  return hit;
+}
+
+// Returns true if the boxes `a` and `b` overlap 
+SOC_INLINE const bool aabb_overlap(const AABB& a, const AABB& b) {
+  return (a.min.x <= b.max.x) && (a.max.x >= b.min.x) && 
+         (a.min.y <= b.max.y) && (a.max.y >= b.min.y) && 
+         (a.min.z <= b.max.z) && (a.max.z >= b.min.z);
+}
+
+// Returns true if the boxes `a` and `b` overlap and writes their contact into `out_contact` 
+// NOTE: `out_contact` always gets written. The normal is the axis the boxes overlap the least on.
+SOC_INLINE const bool aabb_contact(const AABB& a, const AABB& b, Contact* out_contact) {
+  // How far `b` needs to move along the positive and the negative direction of each axis to get out of `a`
+  Vector3 positive = a.max - b.min;
+  Vector3 negative = b.max - a.min;
+
+  Vector3 overlap(positive.x < negative.x ? positive.x : negative.x, 
+                  positive.y < negative.y ? positive.y : negative.y, 
+                  positive.z < negative.z ? positive.z : negative.z);
+
+  Vector3 normal(positive.x < negative.x ? 1.0f : -1.0f, 0.0f, 0.0f);
+  float32 depth = overlap.x;
+
+  if(overlap.y < depth) {
+    normal = Vector3(0.0f, positive.y < negative.y ? 1.0f : -1.0f, 0.0f);
+    depth  = overlap.y;
+  }
+  if(overlap.z < depth) {
+    normal = Vector3(0.0f, 0.0f, positive.z < negative.z ? 1.0f : -1.0f);
+    depth  = overlap.z;
+  }
+
+  out_contact->normal = normal;
+  out_contact->depth  = depth;
+
+  return (overlap.x >= 0.0f) && (overlap.y >= 0.0f) && (overlap.z >= 0.0f);
+}
+
+// The slack added to the rotation terms of the OBB tests, which keeps (almost) parallel edges from giving false separations
+#define SOC_OBB_EPSILON 1e-6f
+
+// Returns true if `a` and `b` overlap and writes their contact into `out_contact` if it is not `nullptr`
+// NOTE: Uses the separating axis test (the 3 face axes of both boxes and the 9 edge cross products) from 
+// "Real-Time Collision Detection" 4.4.1. The contact is along the axis with the least overlap, where the 
+// face axes win any ties and edge axes of (almost) parallel edges are skipped.
+SOC_API const bool obb_contact(const OBB& a, const OBB& b, Contact* out_contact);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool obb_contact(const OBB& a, const OBB& b, Contact* out_contact) {
+  Vector3 axes_a[3] = {obb_axis(a, 0), obb_axis(a, 1), obb_axis(a, 2)};
+  Vector3 axes_b[3] = {obb_axis(b, 0), obb_axis(b, 1), obb_axis(b, 2)};
+  Vector3 diff      = b.center - a.center;
+
+  // Everything is done in the space of `a`
+  float32 rot[3][3], abs_rot[3][3], t[3];
+  for(uint32 i = 0; i < 3; i++) {
+    t[i] = vec3_dot(diff, axes_a[i]);
+
+    for(uint32 j = 0; j < 3; j++) {
+      rot[i][j]     = vec3_dot(axes_a[i], axes_b[j]);
+      abs_rot[i][j] = std::fabs(rot[i][j]) + SOC_OBB_EPSILON;
+    }
+  }
+
+  const float32* ea = a.extents.components;
+  const float32* eb = b.extents.components;
+
+  bool hit      = true;
+  float32 depth = SOC_FLOAT_MAX;
+  Vector3 normal(0.0f, 1.0f, 0.0f);
+
+  // The face axes of `a`...
+  for(uint32 i = 0; i < 3; i++) {
+    float32 rb      = (eb[0] * abs_rot[i][0]) + (eb[1] * abs_rot[i][1]) + (eb[2] * abs_rot[i][2]);
+    float32 overlap = (ea[i] + rb) - std::fabs(t[i]);
+
+    hit    = hit && overlap >= 0.0f;
+    normal = overlap < depth ? (t[i] < 0.0f ? -axes_a[i] : axes_a[i]) : normal;
+    depth  = overlap < depth ? overlap : depth;
+  }
+
+  // ...the face axes of `b`...
+  for(uint32 j = 0; j < 3; j++) {
+    float32 ra      = (ea[0] * abs_rot[0][j]) + (ea[1] * abs_rot[1][j]) + (ea[2] * abs_rot[2][j]);
+    float32 dist    = (t[0] * rot[0][j]) + (t[1] * rot[1][j]) + (t[2] * rot[2][j]);
+    float32 overlap = (ra + eb[j]) - std::fabs(dist);
+
+    hit    = hit && overlap >= 0.0f;
+    normal = overlap < depth ? (dist < 0.0f ? -axes_b[j] : axes_b[j]) : normal;
+    depth  = overlap < depth ? overlap : depth;
+  }
+
+  // ...and the cross products of every pair of edges
+  for(uint32 i = 0; i < 3; i++) {
+    uint32 i1 = (i + 1) % 3;
+    uint32 i2 = (i + 2) % 3;
+
+    for(uint32 j = 0; j < 3; j++) {
+      uint32 j1 = (j + 1) % 3;
+      uint32 j2 = (j + 2) % 3;
+
+      float32 ra      = (ea[i1] * abs_rot[i2][j]) + (ea[i2] * abs_rot[i1][j]);
+      float32 rb      = (eb[j1] * abs_rot[i][j2]) + (eb[j2] * abs_rot[i][j1]);
+      float32 dist    = (t[i2] * rot[i1][j]) - (t[i1] * rot[i2][j]);
+      float32 overlap = (ra + rb) - std::fabs(dist);
+      hit             = hit && overlap >= 0.0f;
+
+      // The axis is not normalized, so the overlap gets scaled by its length
+      Vector3 axis    = vec3_cross(axes_a[i], axes_b[j]);
+      float32 length2 = vec3_dot(axis, axis);
+      float32 length  = (float32)sqrt(length2 > SOC_OBB_EPSILON ? length2 : 1.0f);
+      overlap         = overlap / length;
+      axis            = axis / length;
+
+      bool use = (length2 > SOC_OBB_EPSILON) && (overlap < depth);
+
+      normal = use ? (dist < 0.0f ? -axis : axis) : normal;
+      depth  = use ? overlap : depth;
+    }
+  }
+
+  if(out_contact) {
+    out_contact->normal = normal;
+    out_contact->depth  = depth;
+  }
+
+  return hit;
+}
+#endif
+
+// Returns true if `a` and `b` overlap (see `obb_contact`)
+SOC_INLINE const bool obb_overlap(const OBB& a, const OBB& b) {
+  return obb_contact(a, b, nullptr);
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Writes the 8 contacts starting at `index` into `out` and masks off the hits past `count`
+SOC_INLINE void contact_soa_store(const ContactSoA& out, const uint32 index, const uint32 count, const maskx8& hit, const Vector3x8& normal, const floatx8& depth) {
+  uint32 bits        = maskx8_bits(hit);
+  out.hits[index / 8] = (uint8)((count - index) >= 8 ? bits : (bits & ((1u << (count - index)) - 1)));
+
+  floatx8_store(normal.x, out.normals.x + index);
+  floatx8_store(normal.y, out.normals.y + index);
+  floatx8_store(normal.z, out.normals.z + index);
+  floatx8_store(depth, out.depths + index);
+}
+
+// Loads the 8 vectors of `soa` starting at `index`
+SOC_INLINE const Vector3x8 collision_load_vec3x8(const Vector3SoA& soa, const uint32 index) {
+  return Vector3x8(floatx8_load(soa.x + index), floatx8_load(soa.y + index), floatx8_load(soa.z + index));
+}
+
+// The same as `collision_sphere_contact` but on 8 pairs of spheres
+SOC_INLINE const maskx8 collisionx8_sphere_contact(const Vector3x8& center1, 
+                                                   const floatx8& radius1, 
+                                                   const Vector3x8& center2, 
+                                                   const floatx8& radius2, 
+                                                   Vector3x8* out_normal, 
+                                                   floatx8* out_depth) {
+  Vector3x8 diff = center2 - center1;
+  floatx8 dist2  = vec3x8_dot(diff, diff);
+  floatx8 radius = radius1 + radius2;
+  floatx8 dist   = floatx8_sqrt(dist2);
+
+  maskx8 apart = dist > floatx8(SOC_EPSILON);
+  *out_normal  = vec3x8_select(apart, diff / floatx8_select(apart, dist, floatx8(1.0f)), Vector3x8(Vector3(0.0f, 1.0f, 0.0f)));
+  *out_depth   = radius - dist;
+
+  return dist2 <= (radius * radius);
+}
+
+// The same as `segment_closest_point` but on 8 segments and points
+SOC_INLINE const Vector3x8 collisionx8_segment_closest_point(const Vector3x8& start, const Vector3x8& end, const Vector3x8& point) {
+  Vector3x8 dir   = end - start;
+  floatx8 length2 = vec3x8_dot(dir, dir);
+  floatx8 amount  = vec3x8_dot(point - start, dir) / floatx8_select(length2 > floatx8(SOC_EPSILON), length2, floatx8(1.0f));
+
+  return start + dir * floatx8_clamp(amount, floatx8(0.0f), floatx8(1.0f));
+}
+
+// The same as `segment_closest_points` but on 8 pairs of segments
+SOC_INLINE void collisionx8_segment_closest_points(const Vector3x8& start1, 
+                                                   const Vector3x8& end1, 
+                                                   const Vector3x8& start2, 
+                                                   const Vector3x8& end2, 
+                                                   Vector3x8* out_point1, 
+                                                   Vector3x8* out_point2) {
+  Vector3x8 d1 = end1 - start1;
+  Vector3x8 d2 = end2 - start2;
+  Vector3x8 r  = start1 - start2;
+
+  floatx8 a = vec3x8_dot(d1, d1);
+  floatx8 b = vec3x8_dot(d1, d2);
+  floatx8 c = vec3x8_dot(d1, r);
+  floatx8 e = vec3x8_dot(d2, d2);
+  floatx8 f = vec3x8_dot(d2, r);
+
+  floatx8 zero(0.0f);
+  floatx8 one(1.0f);
+  maskx8 a_valid = a > floatx8(SOC_EPSILON);
+  maskx8 e_valid = e > floatx8(SOC_EPSILON);
+
+  floatx8 safe_a = floatx8_select(a_valid, a, one);
+  floatx8 safe_e = floatx8_select(e_valid, e, one);
+  floatx8 denom  = (a * e) - (b * b);
+
+  maskx8 solvable = denom > zero;
+  floatx8 s       = floatx8_select(solvable, floatx8_clamp(((b * f) - (c * e)) / floatx8_select(solvable, denom, one), zero, one), zero);
+  floatx8 t       = ((b * s) + f) / safe_e;
+
+  floatx8 s_start = floatx8_clamp(-c / safe_a, zero, one);
+  floatx8 s_end   = floatx8_clamp((b - c) / safe_a, zero, one);
+
+  s = floatx8_select(t < zero, s_start, floatx8_select(t > one, s_end, s));
+  t = floatx8_clamp(t, zero, one);
+
+  floatx8 t_only = floatx8_clamp(f / safe_e, zero, one);
+
+  s = floatx8_select(e_valid, s, s_start);
+  t = floatx8_select(e_valid, t, zero);
+  s = floatx8_select(a_valid, s, zero);
+  t = floatx8_select(a_valid, t, t_only);
+
+  *out_point1 = start1 + d1 * s;
+  *out_point2 = start2 + d2 * t;
+}
+
+// The same as `collision_sphere_box_contact` but on 8 spheres and boxes
+SOC_INLINE const maskx8 collisionx8_sphere_box_contact(const Vector3x8& center, 
+                                                       const floatx8& radius, 
+                                                       const Vector3x8& extents, 
+                                                       Vector3x8* out_normal, 
+                                                       floatx8* out_depth) {
+  Vector3x8 closest(floatx8_clamp(center.x, -extents.x, extents.x), 
+                    floatx8_clamp(center.y, -extents.y, extents.y), 
+                    floatx8_clamp(center.z, -extents.z, extents.z));
+
+  Vector3x8 diff = closest - center;
+  floatx8 dist2  = vec3x8_dot(diff, diff);
+  floatx8 dist   = floatx8_sqrt(dist2);
+
+  floatx8 face_dist = extents.x - center.x;
+  Vector3x8 face_normal(Vector3(-1.0f, 0.0f, 0.0f));
+
+  floatx8 faces[5] = {extents.x + center.x, extents.y - center.y, extents.y + center.y, extents.z - center.z, extents.z + center.z};
+  Vector3 normals[5] = {
+    Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f), Vector3(0.0f, 0.0f, 1.0f),
+  };
+
+  for(uint32 i = 0; i < 5; i++) {
+    maskx8 closer = faces[i] < face_dist;
+    face_normal   = vec3x8_select(closer, Vector3x8(normals[i]), face_normal);
+    face_dist     = floatx8_select(closer, faces[i], face_dist);
+  }
+
+  maskx8 outside = dist2 > floatx8(0.0f);
+  *out_normal    = vec3x8_select(outside, diff / floatx8_select(outside, dist, floatx8(1.0f)), face_normal);
+  *out_depth     = floatx8_select(outside, radius - dist, radius + face_dist);
+
+  return dist2 <= (radius * radius);
+}
+
+#endif
+
+// NOTE: The `*_contact_batch` functions below test pair `i` of `a` against pair `i` of `b` for every one of the 
+// `a` pairs (8 pairs at a time) and write the results into `out` (see `ContactSoA`). Every hit, normal, and depth 
+// is exactly the same as the one its scalar `*_contact` function gives, in every build, since all of the collision 
+// functions are compiled without fused multiply-adds (see `SOC_FP_STRICT_BEGIN`). Just like the other block-wise 
+// SoA functions, the padding gets processed too, so `out` needs at least the same `count` as `a` and `b`.
+
+// Tests every pair of spheres in `a` and `b` (see `sphere_contact`)
+SOC_API void sphere_contact_batch(const SphereSoA& a, const SphereSoA& b, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void sphere_contact_batch(const SphereSoA& a, const SphereSoA& b, const ContactSoA& out) {
+  uint32 count = a.centers.count;
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 normal;
+    floatx8 depth;
+
+    maskx8 hit = collisionx8_sphere_contact(collision_load_vec3x8(a.centers, i), floatx8_load(a.radii + i), 
+                                            collision_load_vec3x8(b.centers, i), floatx8_load(b.radii + i), 
+                                            &normal, &depth);
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every sphere in `spheres` against its capsule in `capsules` (see `sphere_capsule_contact`)
+SOC_API void sphere_capsule_contact_batch(const SphereSoA& spheres, const CapsuleSoA& capsules, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void sphere_capsule_contact_batch(const SphereSoA& spheres, const CapsuleSoA& capsules, const ContactSoA& out) {
+  uint32 count = spheres.centers.count;
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 center = collision_load_vec3x8(spheres.centers, i);
+    Vector3x8 point  = collisionx8_segment_closest_point(collision_load_vec3x8(capsules.starts, i), collision_load_vec3x8(capsules.ends, i), center);
+
+    Vector3x8 normal;
+    floatx8 depth;
+
+    maskx8 hit = collisionx8_sphere_contact(center, floatx8_load(spheres.radii + i), point, floatx8_load(capsules.radii + i), &normal, &depth);
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every pair of capsules in `a` and `b` (see `capsule_contact`)
+SOC_API void capsule_contact_batch(const CapsuleSoA& a, const CapsuleSoA& b, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void capsule_contact_batch(const CapsuleSoA& a, const CapsuleSoA& b, const ContactSoA& out) {
+  uint32 count = a.starts.count;
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 point1, point2;
+    collisionx8_segment_closest_points(collision_load_vec3x8(a.starts, i), collision_load_vec3x8(a.ends, i), 
+                                       collision_load_vec3x8(b.starts, i), collision_load_vec3x8(b.ends, i), 
+                                       &point1, &point2);
+
+    Vector3x8 normal;
+    floatx8 depth;
+
+    maskx8 hit = collisionx8_sphere_contact(point1, floatx8_load(a.radii + i), point2, floatx8_load(b.radii + i), &normal, &depth);
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every sphere in `spheres` against its box in `boxes` (see `sphere_aabb_contact`)
+SOC_API void sphere_aabb_contact_batch(const SphereSoA& spheres, const AABBSoA& boxes, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void sphere_aabb_contact_batch(const SphereSoA& spheres, const AABBSoA& boxes, const ContactSoA& out) {
+  uint32 count = spheres.centers.count;
+  floatx8 half(0.5f);
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 min = collision_load_vec3x8(boxes.mins, i);
+    Vector3x8 max = collision_load_vec3x8(boxes.maxs, i);
+
+    Vector3x8 center  = (min + max) * half;
+    Vector3x8 extents = (max - min) * half;
+
+    Vector3x8 normal;
+    floatx8 depth;
+
+    maskx8 hit = collisionx8_sphere_box_contact(collision_load_vec3x8(spheres.centers, i) - center, floatx8_load(spheres.radii + i), extents, &normal, &depth);
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every sphere in `spheres` against its box in `boxes` (see `sphere_obb_contact`)
+SOC_API void sphere_obb_contact_batch(const SphereSoA& spheres, const OBBSoA& boxes, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void sphere_obb_contact_batch(const SphereSoA& spheres, const OBBSoA& boxes, const ContactSoA& out) {
+  uint32 count = spheres.centers.count;
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 axes[3] = {collision_load_vec3x8(boxes.axes[0], i), collision_load_vec3x8(boxes.axes[1], i), collision_load_vec3x8(boxes.axes[2], i)};
+    Vector3x8 diff    = collision_load_vec3x8(spheres.centers, i) - collision_load_vec3x8(boxes.centers, i);
+    Vector3x8 local(vec3x8_dot(diff, axes[0]), vec3x8_dot(diff, axes[1]), vec3x8_dot(diff, axes[2]));
+
+    Vector3x8 normal;
+    floatx8 depth;
+
+    maskx8 hit = collisionx8_sphere_box_contact(local, floatx8_load(spheres.radii + i), collision_load_vec3x8(boxes.extents, i), &normal, &depth);
+    normal     = (axes[0] * normal.x) + (axes[1] * normal.y) + (axes[2] * normal.z);
+
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every pair of boxes in `a` and `b` (see `aabb_contact`)
+SOC_API void aabb_contact_batch(const AABBSoA& a, const AABBSoA& b, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void aabb_contact_batch(const AABBSoA& a, const AABBSoA& b, const ContactSoA& out) {
+  uint32 count = a.mins.count;
+  floatx8 zero(0.0f);
+  floatx8 one(1.0f);
+
+  for(uint32 i = 0; i < count; i += 8) {
+    Vector3x8 a_min = collision_load_vec3x8(a.mins, i);
+    Vector3x8 a_max = collision_load_vec3x8(a.maxs, i);
+    Vector3x8 b_min = collision_load_vec3x8(b.mins, i);
+    Vector3x8 b_max = collision_load_vec3x8(b.maxs, i);
+
+    Vector3x8 positive = a_max - b_min;
+    Vector3x8 negative = b_max - a_min;
+    Vector3x8 overlap(floatx8_min(positive.x, negative.x), floatx8_min(positive.y, negative.y), floatx8_min(positive.z, negative.z));
+
+    Vector3x8 normal(floatx8_select(positive.x < negative.x, one, -one), zero, zero);
+    floatx8 depth = overlap.x;
+
+    maskx8 use_y = overlap.y < depth;
+    normal       = vec3x8_select(use_y, Vector3x8(zero, floatx8_select(positive.y < negative.y, one, -one), zero), normal);
+    depth        = floatx8_select(use_y, overlap.y, depth);
+
+    maskx8 use_z = overlap.z < depth;
+    normal       = vec3x8_select(use_z, Vector3x8(zero, zero, floatx8_select(positive.z < negative.z, one, -one)), normal);
+    depth        = floatx8_select(use_z, overlap.z, depth);
+
+    maskx8 hit = (overlap.x >= zero) & (overlap.y >= zero) & (overlap.z >= zero);
+    contact_soa_store(out, i, count, hit, normal, depth);
+  }
+}
+#endif
+
+// Tests every pair of boxes in `a` and `b` (see `obb_contact`)
+SOC_API void obb_contact_batch(const OBBSoA& a, const OBBSoA& b, const ContactSoA& out);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void obb_contact_batch(const OBBSoA& a, const OBBSoA& b, const ContactSoA& out) {
+  uint32 count = a.centers.count;
+  floatx8 zero(0.0f);
+  floatx8 one(1.0f);
+  floatx8 epsilon(SOC_OBB_EPSILON);
+
+  for(uint32 index = 0; index < count; index += 8) {
+    Vector3x8 axes_a[3] = {collision_load_vec3x8(a.axes[0], index), collision_load_vec3x8(a.axes[1], index), collision_load_vec3x8(a.axes[2], index)};
+    Vector3x8 axes_b[3] = {collision_load_vec3x8(b.axes[0], index), collision_load_vec3x8(b.axes[1], index), collision_load_vec3x8(b.axes[2], index)};
+    Vector3x8 diff      = collision_load_vec3x8(b.centers, index) - collision_load_vec3x8(a.centers, index);
+
+    Vector3x8 a_extents = collision_load_vec3x8(a.extents, index);
+    Vector3x8 b_extents = collision_load_vec3x8(b.extents, index);
+    floatx8 ea[3]       = {a_extents.x, a_extents.y, a_extents.z};
+    floatx8 eb[3]       = {b_extents.x, b_extents.y, b_extents.z};
+
+    floatx8 rot[3][3], abs_rot[3][3], t[3];
+    for(uint32 i = 0; i < 3; i++) {
+      t[i] = vec3x8_dot(diff, axes_a[i]);
+
+      for(uint32 j = 0; j < 3; j++) {
+        rot[i][j]     = vec3x8_dot(axes_a[i], axes_b[j]);
+        abs_rot[i][j] = floatx8_abs(rot[i][j]) + epsilon;
+      }
+    }
+
+    maskx8 hit = zero <= zero;
+    floatx8 depth(SOC_FLOAT_MAX);
+    Vector3x8 normal(Vector3(0.0f, 1.0f, 0.0f));
+
+    for(uint32 i = 0; i < 3; i++) {
+      floatx8 rb      = (eb[0] * abs_rot[i][0]) + (eb[1] * abs_rot[i][1]) + (eb[2] * abs_rot[i][2]);
+      floatx8 overlap = (ea[i] + rb) - floatx8_abs(t[i]);
+
+      maskx8 use = overlap < depth;
+      hit        = hit & (overlap >= zero);
+      normal     = vec3x8_select(use, vec3x8_select(t[i] < zero, -axes_a[i], axes_a[i]), normal);
+      depth      = floatx8_select(use, overlap, depth);
+    }
+
+    for(uint32 j = 0; j < 3; j++) {
+      floatx8 ra      = (ea[0] * abs_rot[0][j]) + (ea[1] * abs_rot[1][j]) + (ea[2] * abs_rot[2][j]);
+      floatx8 dist    = (t[0] * rot[0][j]) + (t[1] * rot[1][j]) + (t[2] * rot[2][j]);
+      floatx8 overlap = (ra + eb[j]) - floatx8_abs(dist);
+
+      maskx8 use = overlap < depth;
+      hit        = hit & (overlap >= zero);
+      normal     = vec3x8_select(use, vec3x8_select(dist < zero, -axes_b[j], axes_b[j]), normal);
+      depth      = floatx8_select(use, overlap, depth);
+    }
+
+    for(uint32 i = 0; i < 3; i++) {
+      uint32 i1 = (i + 1) % 3;
+      uint32 i2 = (i + 2) % 3;
+
+      for(uint32 j = 0; j < 3; j++) {
+        uint32 j1 = (j + 1) % 3;
+        uint32 j2 = (j + 2) % 3;
+
+        floatx8 ra      = (ea[i1] * abs_rot[i2][j]) + (ea[i2] * abs_rot[i1][j]);
+        floatx8 rb      = (eb[j1] * abs_rot[i][j2]) + (eb[j2] * abs_rot[i][j1]);
+        floatx8 dist    = (t[i2] * rot[i1][j]) - (t[i1] * rot[i2][j]);
+        floatx8 overlap = (ra + rb) - floatx8_abs(dist);
+        hit             = hit & (overlap >= zero);
+
+        Vector3x8 axis  = vec3x8_cross(axes_a[i], axes_b[j]);
+        floatx8 length2 = vec3x8_dot(axis, axis);
+        maskx8 valid    = length2 > epsilon;
+        floatx8 length  = floatx8_sqrt(floatx8_select(valid, length2, one));
+        overlap         = overlap / length;
+        axis            = axis / length;
+
+        maskx8 use = valid & (overlap < depth);
+
+        normal = vec3x8_select(use, vec3x8_select(dist < zero, -axis, axis), normal);
+        depth  = floatx8_select(use, overlap, depth);
+      }
+    }
+
+    contact_soa_store(out, index, count, hit, normal, depth);
+  }
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// GJK types
+///////////////////////////////////////////////////////////////
+
+// The maximum number of iterations `gjk_intersect` and `gjk_distance` will take
+#define SOC_GJK_MAX_ITERATIONS 32
+
+// The relative tolerance at which `gjk_distance` stops getting closer 
+#define SOC_GJK_TOLERANCE 1e-5f
+
+// The maximum number of vertices and faces of the polytope in `epa_penetration`
+// NOTE: Every iteration of EPA adds one vertex, so `SOC_EPA_MAX_VERTICES` is also the maximum number of iterations.
+#define SOC_EPA_MAX_VERTICES 64
+#define SOC_EPA_MAX_FACES    128
+
+// The absolute tolerance at which `epa_penetration` stops growing the polytope
+#define SOC_EPA_TOLERANCE 1e-4f
+
+// The function that returns the point of `shape` that is the furthest along `direction` (both in world space)
+// NOTE: The `direction` is never zero, but it is not always normalized.
+typedef const Vector3(*SupportFunc)(const void* shape, const Vector3& direction);
+
+// Any convex shape, described by its `support` function and the `data` that gets passed to it
+struct ConvexShape {
+  SupportFunc support;
+  const void* data;
+
+  // Default CTOR with no shape
+  ConvexShape() 
+    :support(nullptr), data(nullptr)
+  {}
+
+  // Takes the `support` function of the shape and its `data` (a `Sphere*` for `sphere_support`, for example)
+  ConvexShape(const SupportFunc support, const void* data) 
+    :support(support), data(data)
+  {}
+};
+
+// A convex hull of `points` in local space, placed in the world at `position` with `rotation`
+// NOTE: The hull does not own the `points`, and any point that is not on the hull is simply never picked.
+struct ConvexHull {
+  const Vector3* points;
+  uint32 points_count;
+
+  Vector3 position; 
+  Quaternion rotation;
+
+  // Default CTOR with no points at the origin
+  ConvexHull() 
+    :points(nullptr), points_count(0), position(0.0f), rotation()
+  {}
+
+  // Takes the local `points` of the hull and its `position` and `rotation` in the world
+  ConvexHull(const Vector3* points, const uint32 points_count, const Vector3& position, const Quaternion& rotation) 
+    :points(points), points_count(points_count), position(position), rotation(rotation)
+  {}
+};
+
+// The simplex that GJK builds on the Minkowski difference `a - b`
+// NOTE: Every vertex in `points` is `points_a - points_b` found along one of the `directions`, and `weights` are 
+// the barycentric coordinates of the point closest to the origin (only meaningful when the simplex does not enclose the origin).
+struct GJKSimplex {
+  Vector3 points[4];
+  Vector3 points_a[4];
+  Vector3 points_b[4];
+  Vector3 directions[4];
+  float32 weights[4];
+
+  uint32 count;
+};
+
+// The result of `gjk_distance` 
+// NOTE: The `axis` is normalized and points from `a` towards `b`. Passing it (and the `simplex`) back 
+// in the next frame makes GJK start right at the answer, which usually takes one or two iterations for shapes that barely moved.
+struct GJKResult {
+  GJKSimplex simplex;
+
+  Vector3 point_a;  // The closest point on `a` (only when the shapes are apart)
+  Vector3 point_b;  // The closest point on `b` (only when the shapes are apart)
+  Vector3 axis;
+  
+  float32 distance; // Zero when the shapes intersect
+  uint32 iterations;
+  bool is_intersecting;
+};
+
+// The result of `epa_penetration`
+struct EPAResult {
+  Contact contact;
+
+  Vector3 point_a; // The deepest point of `a` inside of `b`
+  Vector3 point_b; // The deepest point of `b` inside of `a`
+
+  uint32 iterations;
+};
+
+///////////////////////////////////////////////////////////////
+
+// GJK functions
+///////////////////////////////////////////////////////////////
+
+// Returns the point of `shape` (a `Sphere*`) that is the furthest along `direction`
+SOC_INLINE const Vector3 sphere_support(const void* shape, const Vector3& direction) {
+  const Sphere* sphere = (const Sphere*)shape;
+  return sphere->center + direction * (sphere->radius / vec3_length(direction));
+}
+
+// Returns the point of `shape` (a `Capsule*`) that is the furthest along `direction`
+SOC_INLINE const Vector3 capsule_support(const void* shape, const Vector3& direction) {
+  const Capsule* capsule = (const Capsule*)shape;
+  Vector3 point          = vec3_dot(capsule->end - capsule->start, direction) > 0.0f ? capsule->end : capsule->start;
+
+  return point + direction * (capsule->radius / vec3_length(direction));
+}
+
+// Returns the point of `shape` (an `AABB*`) that is the furthest along `direction`
+SOC_INLINE const Vector3 aabb_support(const void* shape, const Vector3& direction) {
+  const AABB* box = (const AABB*)shape;
+  
+  return Vector3(direction.x > 0.0f ? box->max.x : box->min.x, 
+                 direction.y > 0.0f ? box->max.y : box->min.y, 
+                 direction.z > 0.0f ? box->max.z : box->min.z);
+}
+
+// Returns the point of `shape` (an `OBB*`) that is the furthest along `direction`
+SOC_INLINE const Vector3 obb_support(const void* shape, const Vector3& direction) {
+  const OBB* obb = (const OBB*)shape;
+  Vector3 result = obb->center;
+
+  for(uint32 i = 0; i < 3; i++) {
+    Vector3 axis = obb_axis(*obb, i);
+    result      += axis * (vec3_dot(axis, direction) > 0.0f ? obb->extents.components[i] : -obb->extents.components[i]);
+  }
+
+  return result;
+}
+
+// Returns the point of `shape` (a `ConvexHull*`) that is the furthest along `direction`
+// NOTE: This goes through every point of the hull, so it is best kept for hulls with a few dozen points.
+SOC_INLINE const Vector3 convex_hull_support(const void* shape, const Vector3& direction) {
+  const ConvexHull* hull = (const ConvexHull*)shape;
+  
+  Quaternion inverse(-hull->rotation.x, -hull->rotation.y, -hull->rotation.z, hull->rotation.w);
+  Vector3 local = quat_rotate_vec3(inverse, direction);
+
+  uint32 best      = 0;
+  float32 best_dot = -SOC_FLOAT_MAX;
+  for(uint32 i = 0; i < hull->points_count; i++) {
+    float32 dot = vec3_dot(hull->points[i], local);
+    
+    best     = dot > best_dot ? i : best;
+    best_dot = dot > best_dot ? dot : best_dot;
+  }
+
+  return hull->position + quat_rotate_vec3(hull->rotation, hull->points[best]);
+}
+
+// Returns the result of GJK between `a` and `b`, starting the search from `axis` (from `a` towards `b`)
+// NOTE: Any `axis` works (a zero one as well), but the previous frame's `GJKResult::axis` converges the fastest. 
+// If `cache` is not `nullptr`, it is the previous frame's `GJKResult::simplex`, and its vertices get found again 
+// along the same directions before anything else, which is even faster. 
+// When the shapes intersect, the `simplex` of the result can go straight into `epa_penetration`.
+SOC_API const GJKResult gjk_distance(const ConvexShape& a, const ConvexShape& b, const Vector3& axis, const GJKSimplex* cache);
+
+// Returns true if `a` and `b` intersect, starting the search from `axis` (from `a` towards `b`)
+// NOTE: This stops as soon as it finds an axis that separates the shapes, which makes it cheaper than `gjk_distance`. 
+// That axis gets written into `out_axis` (if it is not `nullptr`) for the next frame.
+SOC_API const bool gjk_intersect(const ConvexShape& a, const ConvexShape& b, const Vector3& axis, Vector3* out_axis);
+
+// Returns the contact between the intersecting shapes `a` and `b` using EPA, starting from the `simplex` of `gjk_distance` 
+// NOTE: Everything lives on the stack, with the polytope capped at `SOC_EPA_MAX_VERTICES` and `SOC_EPA_MAX_FACES`. 
+// When the cap is reached, the best contact so far is returned. Round shapes (spheres and capsules) reach it a lot 
+// when they go deep, so their own contact functions are the better pick whenever both shapes are known.
+SOC_API const EPAResult epa_penetration(const ConvexShape& a, const ConvexShape& b, const GJKSimplex& simplex);
+
+// Returns true if `a` and `b` intersect and writes their contact into `out_contact` (if it is not `nullptr`)
+// NOTE: This starts GJK from `axis` and writes the axis to start from in the next frame into `out_axis` 
+// (if it is not `nullptr`), which is the contact normal when the shapes intersect.
+SOC_INLINE const bool convex_contact(const ConvexShape& a, const ConvexShape& b, const Vector3& axis, Contact* out_contact, Vector3* out_axis) {
+  GJKResult gjk = gjk_distance(a, b, axis, nullptr);
+  if(!gjk.is_intersecting) {
+    if(out_axis) {
+      *out_axis = gjk.axis;
+    }
+
+    return false;
+  }
+
+  EPAResult epa = epa_penetration(a, b, gjk.simplex);
+  if(out_contact) {
+    *out_contact = epa.contact;
+  }
+  if(out_axis) {
+    *out_axis = epa.contact.normal;
+  }
+
+  return true;
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// Writes the weights of the point on the segment `p0`-`p1` that is the closest to the origin into `out_weights`
+SOC_INLINE void gjk_closest_segment(const Vector3& p0, const Vector3& p1, float32* out_weights) {
+  Vector3 edge   = p1 - p0;
+  float32 amount = -vec3_dot(p0, edge);
+  float32 length = vec3_dot(edge, edge);
+
+  if(amount <= 0.0f) {
+    out_weights[0] = 1.0f; 
+    out_weights[1] = 0.0f;
+  }
+  else if(amount >= length) {
+    out_weights[0] = 0.0f; 
+    out_weights[1] = 1.0f;
+  }
+  else {
+    out_weights[1] = amount / length;
+    out_weights[0] = 1.0f - out_weights[1];
+  }
+}
+
+// Writes the weights of the point on the triangle `p0`-`p1`-`p2` that is the closest to the origin into `out_weights`
+// NOTE: This is "Real-Time Collision Detection" 5.1.5 with the point at the origin.
+SOC_INLINE void gjk_closest_triangle(const Vector3& p0, const Vector3& p1, const Vector3& p2, float32* out_weights) {
+  Vector3 e1 = p1 - p0;
+  Vector3 e2 = p2 - p0;
+
+  out_weights[0] = 0.0f; 
+  out_weights[1] = 0.0f; 
+  out_weights[2] = 0.0f;
+
+  float32 d1 = -vec3_dot(e1, p0);
+  float32 d2 = -vec3_dot(e2, p0);
+  if(d1 <= 0.0f && d2 <= 0.0f) {
+    out_weights[0] = 1.0f;
+    return;
+  }
+
+  float32 d3 = -vec3_dot(e1, p1);
+  float32 d4 = -vec3_dot(e2, p1);
+  if(d3 >= 0.0f && d4 <= d3) {
+    out_weights[1] = 1.0f;
+    return;
+  }
+
+  float32 vc = (d1 * d4) - (d3 * d2);
+  if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+    out_weights[1] = d1 / (d1 - d3);
+    out_weights[0] = 1.0f - out_weights[1];
+    return;
+  }
+
+  float32 d5 = -vec3_dot(e1, p2);
+  float32 d6 = -vec3_dot(e2, p2);
+  if(d6 >= 0.0f && d5 <= d6) {
+    out_weights[2] = 1.0f;
+    return;
+  }
+
+  float32 vb = (d5 * d2) - (d1 * d6);
+  if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+    out_weights[2] = d2 / (d2 - d6);
+    out_weights[0] = 1.0f - out_weights[2];
+    return;
+  }
+
+  float32 va = (d3 * d6) - (d5 * d4);
+  if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+    out_weights[2] = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    out_weights[1] = 1.0f - out_weights[2];
+    return;
+  }
+
+  // A flat triangle is only as good as its best edge
+  float32 sum = va + vb + vc;
+  if(sum <= 0.0f) {
+    const uint32 edges[3][2] = {{0, 1}, {1, 2}, {2, 0}};
+    const Vector3 points[3]  = {p0, p1, p2};
+    
+    float32 best = SOC_FLOAT_MAX;
+    for(uint32 i = 0; i < 3; i++) {
+      float32 weights[2];
+      gjk_closest_segment(points[edges[i][0]], points[edges[i][1]], weights);
+
+      Vector3 closest = (points[edges[i][0]] * weights[0]) + (points[edges[i][1]] * weights[1]);
+      float32 dist2   = vec3_dot(closest, closest);
+      if(dist2 < best) {
+        best = dist2;
+
+        out_weights[0] = 0.0f; 
+        out_weights[1] = 0.0f; 
+        out_weights[2] = 0.0f;
+        out_weights[edges[i][0]] = weights[0];
+        out_weights[edges[i][1]] = weights[1];
+      }
+    }
+
+    return;
+  }
+
+  out_weights[1] = vb / sum;
+  out_weights[2] = vc / sum;
+  out_weights[0] = 1.0f - out_weights[1] - out_weights[2];
+}
+
+// Keeps only the vertices of `simplex` that have a weight in `weights` 
+SOC_INLINE void gjk_simplex_keep(GJKSimplex& simplex, const float32* weights) {
+  uint32 count = 0;
+  for(uint32 i = 0; i < simplex.count; i++) {
+    if(weights[i] <= 0.0f) {
+      continue;
+    }
+
+    simplex.points[count]     = simplex.points[i];
+    simplex.points_a[count]   = simplex.points_a[i];
+    simplex.points_b[count]   = simplex.points_b[i];
+    simplex.directions[count] = simplex.directions[i];
+    simplex.weights[count]    = weights[i];
+    count++;
+  }
+
+  simplex.count = count;
+}
+
+// Reduces `simplex` to the vertices that support its point closest to the origin and writes that point into `out_closest`
+// NOTE: Returns false (and leaves the simplex alone) when the simplex is a tetrahedron that encloses the origin.
+SOC_INLINE const bool gjk_simplex_reduce(GJKSimplex& simplex, Vector3* out_closest) {
+  float32 weights[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+  const Vector3* p   = simplex.points;
+
+  if(simplex.count == 2) {
+    gjk_closest_segment(p[0], p[1], weights);
+  }
+  else if(simplex.count == 3) {
+    gjk_closest_triangle(p[0], p[1], p[2], weights);
+  }
+  else if(simplex.count == 4) {
+    // Every face is opposite of one vertex, and only the faces that have the origin on their outer side can be the closest
+    const uint32 faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+
+    bool is_inside = true;
+    float32 best   = SOC_FLOAT_MAX;
+
+    float32 scale2 = 0.0f;
+    for(uint32 i = 0; i < 4; i++) {
+      float32 length2 = vec3_dot(p[i], p[i]);
+      scale2          = length2 > scale2 ? length2 : scale2;
+    }
+    
+    for(uint32 i = 0; i < 4; i++) {
+      const uint32* face = faces[i];
+      
+      Vector3 normal        = vec3_cross(p[face[1]] - p[face[0]], p[face[2]] - p[face[0]]);
+      float32 origin_side   = -vec3_dot(p[face[0]], normal);
+      float32 opposite_side = vec3_dot(p[face[3]] - p[face[0]], normal);
+
+      // The sides of a flat tetrahedron are only rounding noise, so it can never enclose the origin 
+      float32 flat_side = SOC_GJK_TOLERANCE * SOC_GJK_TOLERANCE * scale2 * vec3_dot(normal, normal);
+      bool is_flat      = (opposite_side * opposite_side) <= flat_side;
+      if(!is_flat && (origin_side * opposite_side) > 0.0f) {
+        continue;
+      }
+
+      is_inside = false;
+      
+      float32 face_weights[3];
+      gjk_closest_triangle(p[face[0]], p[face[1]], p[face[2]], face_weights);
+
+      Vector3 closest = (p[face[0]] * face_weights[0]) + (p[face[1]] * face_weights[1]) + (p[face[2]] * face_weights[2]);
+      float32 dist2   = vec3_dot(closest, closest);
+      if(dist2 < best) {
+        best = dist2;
+
+        weights[face[0]] = face_weights[0];
+        weights[face[1]] = face_weights[1];
+        weights[face[2]] = face_weights[2];
+        weights[face[3]] = 0.0f;
+      }
+    }
+
+    if(is_inside) {
+      return false;
+    }
+  }
+
+  gjk_simplex_keep(simplex, weights);
+
+  Vector3 closest(0.0f);
+  for(uint32 i = 0; i < simplex.count; i++) {
+    closest += simplex.points[i] * simplex.weights[i];
+  }
+
+  *out_closest = closest;
+  return true;
+}
+
+// Adds the point of the Minkowski difference `a - b` that is the furthest along `direction` to `simplex` 
+SOC_INLINE void gjk_simplex_add(GJKSimplex& simplex, const ConvexShape& a, const ConvexShape& b, const Vector3& direction) {
+  uint32 index = simplex.count++;
+
+  simplex.points_a[index]   = a.support(a.data, direction);
+  simplex.points_b[index]   = b.support(b.data, -direction);
+  simplex.points[index]     = simplex.points_a[index] - simplex.points_b[index];
+  simplex.directions[index] = direction;
+  simplex.weights[index]    = 0.0f;
+}
+
+// Runs GJK between `a` and `b` from `axis` (or the `cache` if it is not `nullptr`) and writes the result into `out_result`
+// NOTE: When `is_early_out` is on, this stops as soon as the shapes are known to be apart (before their distance is known).
+SOC_INLINE void gjk_solve(const ConvexShape& a, 
+                          const ConvexShape& b, 
+                          const Vector3& axis, 
+                          const GJKSimplex* cache, 
+                          const bool is_early_out, 
+                          GJKResult* out_result) {
+  GJKResult& result = *out_result;
+  
+  result.simplex.count   = 0;
+  result.point_a         = Vector3(0.0f);
+  result.point_b         = Vector3(0.0f);
+  result.distance        = 0.0f;
+  result.iterations      = 0;
+  result.is_intersecting = false;
+
+  Vector3 direction = vec3_dot(axis, axis) > SOC_EPSILON ? axis : Vector3(1.0f, 0.0f, 0.0f);
+  Vector3 closest(0.0f);
+  float32 dist2     = SOC_FLOAT_MAX;
+  float32 max_dist2 = 0.0f;
+
+  GJKSimplex& simplex = result.simplex;
+
+  // The cached vertices count as a single iteration
+  if(cache && cache->count > 0) {
+    result.iterations++;
+
+    for(uint32 i = 0; i < cache->count; i++) {
+      gjk_simplex_add(simplex, a, b, cache->directions[i]);
+
+      // Shapes that moved can bring two vertices together
+      Vector3 point     = simplex.points[simplex.count - 1];
+      bool is_duplicate = false;
+      for(uint32 j = 0; j < simplex.count - 1; j++) {
+        Vector3 diff = simplex.points[j] - point;
+        is_duplicate = is_duplicate || vec3_dot(diff, diff) == 0.0f;
+      }
+
+      simplex.count -= is_duplicate ? 1 : 0;
+    }
+
+    for(uint32 i = 0; i < simplex.count; i++) {
+      float32 point_dist2 = vec3_dot(simplex.points[i], simplex.points[i]);
+      max_dist2           = point_dist2 > max_dist2 ? point_dist2 : max_dist2;
+    }
+
+    if(!gjk_simplex_reduce(simplex, &closest)) {
+      result.is_intersecting = true;
+    }
+    else {
+      dist2                  = vec3_dot(closest, closest);
+      result.is_intersecting = dist2 <= (SOC_GJK_TOLERANCE * SOC_GJK_TOLERANCE * max_dist2);
+      direction              = result.is_intersecting ? direction : -closest;
+    }
+  }
+
+  while(!result.is_intersecting && result.iterations < SOC_GJK_MAX_ITERATIONS) {
+    result.iterations++;
+
+    GJKSimplex previous = simplex;
+    gjk_simplex_add(simplex, a, b, direction);
+    
+    Vector3 point = simplex.points[simplex.count - 1];
+    
+    // The support plane already separates the shapes
+    if(is_early_out && vec3_dot(point, direction) < 0.0f) {
+      simplex = previous;
+      break;
+    }
+
+    float32 point_dist2 = vec3_dot(point, point);
+    max_dist2           = point_dist2 > max_dist2 ? point_dist2 : max_dist2;
+
+    // No more progress (including a point that is already in the simplex)
+    bool is_done = simplex.count > 1 && (dist2 - vec3_dot(closest, point)) <= (SOC_GJK_TOLERANCE * dist2);
+    for(uint32 i = 0; i < simplex.count - 1; i++) {
+      Vector3 diff = simplex.points[i] - point;
+      is_done      = is_done || vec3_dot(diff, diff) == 0.0f;
+    }
+
+    if(is_done) {
+      simplex = previous;
+      break;
+    }
+
+    Vector3 next;
+    if(!gjk_simplex_reduce(simplex, &next)) {
+      result.is_intersecting = true;
+      break;
+    }
+
+    // Rounding can make a nearly flat simplex go backwards, so the last simplex is as close as it gets
+    float32 next_dist2 = vec3_dot(next, next);
+    if(next_dist2 >= dist2) {
+      simplex = previous;
+      break;
+    }
+
+    closest = next;
+    dist2   = next_dist2;
+
+    // Close enough to call it a touch 
+    if(dist2 <= (SOC_GJK_TOLERANCE * SOC_GJK_TOLERANCE * max_dist2)) {
+      result.is_intersecting = true;
+      break;
+    }
+
+    direction = -closest;
+  }
+
+  if(result.is_intersecting) {
+    result.axis = vec3_normalize(direction);
+    return;
+  }
+
+  // Only the early out can leave without a closest point
+  if(dist2 == SOC_FLOAT_MAX) {
+    result.axis     = vec3_normalize(direction);
+    result.distance = SOC_FLOAT_MAX;
+    return;
+  }
+
+  for(uint32 i = 0; i < result.simplex.count; i++) {
+    result.point_a += result.simplex.points_a[i] * result.simplex.weights[i];
+    result.point_b += result.simplex.points_b[i] * result.simplex.weights[i];
+  }
+
+  result.distance = sqrt(dist2);
+  result.axis     = -closest / result.distance;
+}
+
+SOC_API const GJKResult gjk_distance(const ConvexShape& a, const ConvexShape& b, const Vector3& axis, const GJKSimplex* cache) {
+  GJKResult result;
+  gjk_solve(a, b, axis, cache, false, &result);
+
+  return result;
+}
+
+SOC_API const bool gjk_intersect(const ConvexShape& a, const ConvexShape& b, const Vector3& axis, Vector3* out_axis) {
+  GJKResult result;
+  gjk_solve(a, b, axis, nullptr, true, &result);
+
+  if(out_axis) {
+    *out_axis = result.axis;
+  }
+
+  return result.is_intersecting;
+}
+
+// A face of the EPA polytope with its outward `normal` and its `distance` from the origin
+struct EPAFace {
+  uint32 indices[3];
+  Vector3 normal;
+  float32 distance;
+};
+
+// Sets the `face` to the vertices `i0`, `i1`, and `i2` of `points` (in counter-clockwise order seen from outside)
+SOC_INLINE void epa_face_set(EPAFace& face, const Vector3* points, const uint32 i0, const uint32 i1, const uint32 i2) {
+  face.indices[0] = i0; 
+  face.indices[1] = i1; 
+  face.indices[2] = i2;
+
+  Vector3 normal = vec3_cross(points[i1] - points[i0], points[i2] - points[i0]);
+  float32 length = vec3_length(normal);
+
+  // A face with no area can never be the closest one
+  face.normal   = length > 0.0f ? normal / length : Vector3(0.0f);
+  face.distance = length > 0.0f ? vec3_dot(face.normal, points[i0]) : SOC_FLOAT_MAX;
+}
+
+// Adds the edge `i0`-`i1` to the horizon `edges`, or removes it if its twin is already there
+SOC_INLINE void epa_edge_toggle(uint32 (*edges)[2], uint32& edges_count, const uint32 i0, const uint32 i1) {
+  for(uint32 i = 0; i < edges_count; i++) {
+    if(edges[i][0] == i1 && edges[i][1] == i0) {
+      edges[i][0] = edges[edges_count - 1][0];
+      edges[i][1] = edges[edges_count - 1][1];
+      edges_count--;
+
+      return;
+    }
+  }
+
+  edges[edges_count][0] = i0;
+  edges[edges_count][1] = i1;
+  edges_count++;
+}
+
+// Grows `simplex` into a tetrahedron around the origin and returns false if the Minkowski difference of `a` and `b` is flat
+// NOTE: GJK can stop with fewer than 4 vertices when the shapes only touch.
+SOC_INLINE const bool epa_simplex_expand(GJKSimplex& simplex, const ConvexShape& a, const ConvexShape& b) {
+  const float32 tolerance = SOC_EPA_TOLERANCE * SOC_EPA_TOLERANCE;
+  const Vector3 axes[6]   = {
+    Vector3(1.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 0.0f), 
+    Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), 
+    Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 0.0f, -1.0f),
+  };
+
+  if(simplex.count == 0) {
+    gjk_simplex_add(simplex, a, b, axes[0]);
+  }
+
+  for(uint32 i = 0; simplex.count == 1 && i < 6; i++) {
+    gjk_simplex_add(simplex, a, b, axes[i]);
+    
+    Vector3 diff   = simplex.points[1] - simplex.points[0];
+    simplex.count -= vec3_dot(diff, diff) > tolerance ? 0 : 1;
+  }
+
+  if(simplex.count == 2) {
+    Vector3 edge = simplex.points[1] - simplex.points[0];
+    
+    // Any axis that is not too close to the edge gives a perpendicular direction
+    Vector3 abs_edge(std::fabs(edge.x), std::fabs(edge.y), std::fabs(edge.z));
+    uint32 smallest = abs_edge.x < abs_edge.y ? (abs_edge.x < abs_edge.z ? 0 : 2) : (abs_edge.y < abs_edge.z ? 1 : 2);
+    
+    Vector3 perp1 = vec3_cross(edge, axes[smallest * 2]);
+    Vector3 perp2 = vec3_cross(edge, perp1);
+    const Vector3 directions[4] = {perp1, -perp1, perp2, -perp2};
+
+    for(uint32 i = 0; simplex.count == 2 && i < 4; i++) {
+      gjk_simplex_add(simplex, a, b, directions[i]);
+      
+      Vector3 area   = vec3_cross(simplex.points[2] - simplex.points[0], edge);
+      simplex.count -= vec3_dot(area, area) > tolerance ? 0 : 1;
+    }
+  }
+
+  if(simplex.count == 3) {
+    Vector3 normal = vec3_cross(simplex.points[1] - simplex.points[0], simplex.points[2] - simplex.points[0]);
+    
+    for(uint32 i = 0; simplex.count == 3 && i < 2; i++) {
+      gjk_simplex_add(simplex, a, b, i == 0 ? normal : -normal);
+      
+      float32 height = vec3_dot(simplex.points[3] - simplex.points[0], normal);
+      simplex.count -= (height * height) > (tolerance * vec3_dot(normal, normal)) ? 0 : 1;
+    }
+  }
+
+  return simplex.count == 4;
+}
+
+SOC_API const EPAResult epa_penetration(const ConvexShape& a, const ConvexShape& b, const GJKSimplex& simplex) {
+  EPAResult result;
+  result.point_a    = Vector3(0.0f);
+  result.point_b    = Vector3(0.0f);
+  result.iterations = 0;
+
+  GJKSimplex start = simplex;
+  if(!epa_simplex_expand(start, a, b)) {
+    // Flat shapes only touch, so any normal of the flat part works
+    if(start.count == 3) {
+      result.contact.normal = vec3_normalize(vec3_cross(start.points[1] - start.points[0], start.points[2] - start.points[0]));
+    }
+
+    result.point_a = start.points_a[0];
+    result.point_b = start.points_b[0];
+    return result;
+  }
+
+  Vector3 points[SOC_EPA_MAX_VERTICES];
+  Vector3 points_a[SOC_EPA_MAX_VERTICES];
+  Vector3 points_b[SOC_EPA_MAX_VERTICES];
+  uint32 points_count = 4;
+
+  EPAFace faces[SOC_EPA_MAX_FACES];
+  uint32 faces_count = 4;
+
+  uint32 edges[SOC_EPA_MAX_VERTICES * 3][2];
+  uint32 edges_count = 0;
+
+  // The tetrahedron has to wind the same way on every face for the normals to point out
+  bool is_flipped = vec3_dot(vec3_cross(start.points[1] - start.points[0], start.points[2] - start.points[0]), start.points[3] - start.points[0]) > 0.0f;
+  const uint32 order[4] = {0, is_flipped ? 2u : 1u, is_flipped ? 1u : 2u, 3};
+
+  for(uint32 i = 0; i < 4; i++) {
+    points[i]   = start.points[order[i]];
+    points_a[i] = start.points_a[order[i]];
+    points_b[i] = start.points_b[order[i]];
+  }
+
+  epa_face_set(faces[0], points, 0, 1, 2);
+  epa_face_set(faces[1], points, 0, 3, 1);
+  epa_face_set(faces[2], points, 0, 2, 3);
+  epa_face_set(faces[3], points, 1, 3, 2);
+
+  // The closest face is kept aside since running out of room can leave the polytope half-patched
+  EPAFace face;
+  while(true) {
+    uint32 closest = 0;
+    for(uint32 i = 1; i < faces_count; i++) {
+      closest = faces[i].distance < faces[closest].distance ? i : closest;
+    }
+
+    face = faces[closest];
+    if(points_count == SOC_EPA_MAX_VERTICES) {
+      break;
+    }
+    result.iterations++;
+
+    // The face is on the surface of the Minkowski difference when the support point does not go any further
+    Vector3 point_a = a.support(a.data, face.normal);
+    Vector3 point_b = b.support(b.data, -face.normal);
+    Vector3 point   = point_a - point_b;
+
+    if((vec3_dot(point, face.normal) - face.distance) < SOC_EPA_TOLERANCE) {
+      break;
+    }
+
+    // Remove every face that can see the new point, leaving a hole with the horizon edges around it
+    edges_count = 0;
+    for(uint32 i = 0; i < faces_count;) {
+      const EPAFace& visible = faces[i];
+      if(vec3_dot(visible.normal, point - points[visible.indices[0]]) <= 0.0f) {
+        i++;
+        continue;
+      }
+
+      epa_edge_toggle(edges, edges_count, visible.indices[0], visible.indices[1]);
+      epa_edge_toggle(edges, edges_count, visible.indices[1], visible.indices[2]);
+      epa_edge_toggle(edges, edges_count, visible.indices[2], visible.indices[0]);
+
+      faces[i] = faces[--faces_count];
+    }
+
+    // Out of room, so the closest face so far has to do
+    if((faces_count + edges_count) > SOC_EPA_MAX_FACES) {
+      break;
+    }
+
+    points[points_count]   = point;
+    points_a[points_count] = point_a;
+    points_b[points_count] = point_b;
+
+    for(uint32 i = 0; i < edges_count; i++) {
+      epa_face_set(faces[faces_count++], points, edges[i][0], edges[i][1], points_count);
+    }
+    points_count++;
+  }
+
+  // Shapes that only touch can leave the origin a hair outside of the polytope
+  result.contact.normal = face.normal;
+  result.contact.depth  = face.distance > 0.0f ? face.distance : 0.0f;
+
+  // The barycentric coordinates of the origin projected onto the face give the points on each shape
+  Vector3 p0 = points[face.indices[0]];
+  Vector3 e1 = points[face.indices[1]] - p0;
+  Vector3 e2 = points[face.indices[2]] - p0;
+  Vector3 pp = (face.normal * face.distance) - p0;
+
+  float32 d00   = vec3_dot(e1, e1);
+  float32 d01   = vec3_dot(e1, e2);
+  float32 d11   = vec3_dot(e2, e2);
+  float32 d20   = vec3_dot(pp, e1);
+  float32 d21   = vec3_dot(pp, e2);
+  float32 denom = (d00 * d11) - (d01 * d01);
+  
+  float32 w1 = denom > 0.0f ? ((d11 * d20) - (d01 * d21)) / denom : 0.0f;
+  float32 w2 = denom > 0.0f ? ((d00 * d21) - (d01 * d20)) / denom : 0.0f;
+  float32 w0 = 1.0f - w1 - w2;
+
+  result.point_a = (points_a[face.indices[0]] * w0) + (points_a[face.indices[1]] * w1) + (points_a[face.indices[2]] * w2);
+  result.point_b = (points_b[face.indices[0]] * w0) + (points_b[face.indices[1]] * w1) + (points_b[face.indices[2]] * w2);
+
+  return result;
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Rigid body types
+///////////////////////////////////////////////////////////////
+
+// An array of symmetric 3x3 matrices stored as SoA (only the 6 unique entries)
+struct SymmetricMatrix3SoA {
+  float32* xx;
+  float32* yy;
+  float32* zz;
+  float32* xy;
+  float32* xz;
+  float32* yz;
+};
+
+// A pool of rigid bodies stored as SoA streams
+//
+// The bodies live in `[0, count)` of each stream. The `angular_velocities` are in world space, and the 
+// `local_inverse_inertias` are the diagonals of the inverse inertia tensors along the principal axes of each body. 
+// The `forces` and `torques` get added up by the user over a frame and are used up (zeroed) by `rigid_body_integrate`, 
+// which also keeps the `world_inverse_inertias` in step with the `orientations`. Use `rigid_body_soa_memory_size`, 
+// `rigid_body_soa_create`, and `rigid_body_add` to set one up.
+// NOTE: The pool does NOT own its memory, and the streams have `capacity` entries (padded like the other SoA types).
+struct RigidBodySoA {
+  Vector3SoA positions;
+  QuaternionSoA orientations;
+  Vector3SoA linear_velocities;
+  Vector3SoA angular_velocities;
+  Vector3SoA forces;
+  Vector3SoA torques;
+
+  float32* inverse_masses;
+  Vector3SoA local_inverse_inertias;
+  SymmetricMatrix3SoA world_inverse_inertias;
+
+  uint32 count;
+  uint32 capacity;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Rigid body functions
+///////////////////////////////////////////////////////////////
+
+SOC_FP_STRICT_BEGIN
+
+// Returns the number of bytes a `RigidBodySoA` of `capacity` bodies needs
+SOC_INLINE const uint64 rigid_body_soa_memory_size(const uint32 capacity) {
+  return soa_memory_size(29, capacity);
+}
+
+// Creates and returns an empty `RigidBodySoA` that can hold up to `capacity` bodies inside of `memory`
+// NOTE: `memory` must be at least `rigid_body_soa_memory_size(capacity)` bytes.
+SOC_INLINE const RigidBodySoA rigid_body_soa_create(void* memory, const uint32 capacity) {
+  float32* arrays[29];
+  soa_split_memory(memory, 29, capacity, arrays);
+
+  RigidBodySoA bodies;
+  bodies.positions              = Vector3SoA{arrays[0], arrays[1], arrays[2], capacity};
+  bodies.orientations           = QuaternionSoA{arrays[3], arrays[4], arrays[5], arrays[6], capacity};
+  bodies.linear_velocities      = Vector3SoA{arrays[7], arrays[8], arrays[9], capacity};
+  bodies.angular_velocities     = Vector3SoA{arrays[10], arrays[11], arrays[12], capacity};
+  bodies.forces                 = Vector3SoA{arrays[13], arrays[14], arrays[15], capacity};
+  bodies.torques                = Vector3SoA{arrays[16], arrays[17], arrays[18], capacity};
+  bodies.inverse_masses         = arrays[19];
+  bodies.local_inverse_inertias = Vector3SoA{arrays[20], arrays[21], arrays[22], capacity};
+  bodies.world_inverse_inertias = SymmetricMatrix3SoA{arrays[23], arrays[24], arrays[25], arrays[26], arrays[27], arrays[28]};
+  bodies.count                  = 0;
+  bodies.capacity               = capacity;
+
+  return bodies;
+}
+
+// Returns the world inverse inertia tensor `R * D * R^T` of a body with the `orientation` (the rotation `R`) and 
+// the `local_inverse_inertia` (the diagonal `D`)
+// NOTE: The result is symmetric, so only its 6 unique entries get computed, straight from the quaternion 
+// without building `R` or doing any matrix multiplies. `rigid_body_integrate` gives the exact same results.
+SOC_INLINE const Matrix3 rigid_body_world_inverse_inertia(const Quaternion& orientation, const Vector3& local_inverse_inertia) {
+  float32 x2 = orientation.x * orientation.x; 
+  float32 y2 = orientation.y * orientation.y; 
+  float32 z2 = orientation.z * orientation.z;
+
+  float32 xy = orientation.x * orientation.y; 
+  float32 xz = orientation.x * orientation.z;
+  float32 yz = orientation.y * orientation.z;
+  float32 wx = orientation.w * orientation.x;
+  float32 wy = orientation.w * orientation.y;
+  float32 wz = orientation.w * orientation.z;
+
+  // The columns of `R`
+  Vector3 axis_x(1.0f - 2.0f * (y2 + z2), 2.0f * (xy + wz), 2.0f * (xz - wy));
+  Vector3 axis_y(2.0f * (xy - wz), 1.0f - 2.0f * (x2 + z2), 2.0f * (yz + wx));
+  Vector3 axis_z(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (x2 + y2));
+
+  Vector3 scaled_x = axis_x * local_inverse_inertia.x;
+  Vector3 scaled_y = axis_y * local_inverse_inertia.y;
+  Vector3 scaled_z = axis_z * local_inverse_inertia.z;
+
+  float32 xx_entry = (scaled_x.x * axis_x.x) + (scaled_y.x * axis_y.x) + (scaled_z.x * axis_z.x);
+  float32 yy_entry = (scaled_x.y * axis_x.y) + (scaled_y.y * axis_y.y) + (scaled_z.y * axis_z.y);
+  float32 zz_entry = (scaled_x.z * axis_x.z) + (scaled_y.z * axis_y.z) + (scaled_z.z * axis_z.z);
+  float32 xy_entry = (scaled_x.x * axis_x.y) + (scaled_y.x * axis_y.y) + (scaled_z.x * axis_z.y);
+  float32 xz_entry = (scaled_x.x * axis_x.z) + (scaled_y.x * axis_y.z) + (scaled_z.x * axis_z.z);
+  float32 yz_entry = (scaled_x.y * axis_x.z) + (scaled_y.y * axis_y.z) + (scaled_z.y * axis_z.z);
+
+  return Matrix3(xx_entry, xy_entry, xz_entry, 
+                 xy_entry, yy_entry, yz_entry, 
+                 xz_entry, yz_entry, zz_entry);
+}
+
+// Returns the `orientation` turned by the world-space `angular_velocity` for `delta_time` seconds
+// NOTE: This adds `0.5 * dt * (angular_velocity, 0) * orientation` to the quaternion and normalizes it again, 
+// which is exactly what `rigid_body_integrate` does.
+SOC_INLINE const Quaternion quat_integrate(const Quaternion& orientation, const Vector3& angular_velocity, const float32 delta_time) {
+  float32 half_dt = delta_time * 0.5f;
+  const Quaternion& q = orientation;
+  const Vector3& w    = angular_velocity;
+
+  float32 x = q.x + (((w.x * q.w) + (w.y * q.z) - (w.z * q.y)) * half_dt);
+  float32 y = q.y + (((w.y * q.w) + (w.z * q.x) - (w.x * q.z)) * half_dt);
+  float32 z = q.z + (((w.z * q.w) + (w.x * q.y) - (w.y * q.x)) * half_dt);
+  float32 s = q.w - (((w.x * q.x) + (w.y * q.y) + (w.z * q.z)) * half_dt);
+
+  float32 length2 = (x * x) + (y * y) + (z * z) + (s * s);
+  float32 inverse = length2 > 0.0f ? 1.0f / (float32)sqrt(length2) : 0.0f;
+
+  return Quaternion(x * inverse, y * inverse, z * inverse, s * inverse);
+}
+
+// Adds a body at `position` with `orientation`, `inverse_mass`, and `local_inverse_inertia` (see `RigidBodySoA`) 
+// to `bodies` with no velocity or forces
+// NOTE: Returns false (and adds nothing) if `bodies` is full. An `inverse_mass` of 0 makes a body that 
+// gravity and forces do not move.
+SOC_INLINE const bool rigid_body_add(RigidBodySoA& bodies, 
+                                     const Vector3& position, 
+                                     const Quaternion& orientation, 
+                                     const float32 inverse_mass, 
+                                     const Vector3& local_inverse_inertia) {
+  if(bodies.count >= bodies.capacity) {
+    return false;
+  }
+
+  uint32 i = bodies.count++;
+
+  bodies.positions.x[i]    = position.x;
+  bodies.positions.y[i]    = position.y;
+  bodies.positions.z[i]    = position.z;
+  bodies.orientations.x[i] = orientation.x;
+  bodies.orientations.y[i] = orientation.y;
+  bodies.orientations.z[i] = orientation.z;
+  bodies.orientations.w[i] = orientation.w;
+
+  Vector3SoA* zeroed[4] = {&bodies.linear_velocities, &bodies.angular_velocities, &bodies.forces, &bodies.torques};
+  for(Vector3SoA* stream : zeroed) {
+    stream->x[i] = 0.0f;
+    stream->y[i] = 0.0f;
+    stream->z[i] = 0.0f;
+  }
+
+  bodies.inverse_masses[i]           = inverse_mass;
+  bodies.local_inverse_inertias.x[i] = local_inverse_inertia.x;
+  bodies.local_inverse_inertias.y[i] = local_inverse_inertia.y;
+  bodies.local_inverse_inertias.z[i] = local_inverse_inertia.z;
+
+  Matrix3 inertia = rigid_body_world_inverse_inertia(orientation, local_inverse_inertia);
+  bodies.world_inverse_inertias.xx[i] = inertia[0];
+  bodies.world_inverse_inertias.yy[i] = inertia[4];
+  bodies.world_inverse_inertias.zz[i] = inertia[8];
+  bodies.world_inverse_inertias.xy[i] = inertia[1];
+  bodies.world_inverse_inertias.xz[i] = inertia[2];
+  bodies.world_inverse_inertias.yz[i] = inertia[5];
+
+  return true;
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// The shared state of the `rigid_body_integrate` ranges
+struct RigidBodyJob {
+  RigidBodySoA* bodies;
+
+  Vector3 gravity;
+  float32 linear_drag;
+  float32 angular_drag;
+  float32 delta_time;
+};
+
+// Moves the linear state of the 8 bodies at `index` forward by `job.delta_time` seconds
+// (semi-implicit Euler, like `PARTICLE_INTEGRATOR_SEMI_IMPLICIT_EULER`)
+SOC_INLINE void rigid_bodyx8_integrate_linear(const RigidBodyJob& job, const uint32 index) {
+  RigidBodySoA* bodies = job.bodies;
+  floatx8 dt(job.delta_time);
+  floatx8 zero(0.0f);
+
+  floatx8 inverse_mass = floatx8_load(bodies->inverse_masses + index);
+  Vector3x8 gravity    = vec3x8_select(inverse_mass > zero, Vector3x8(job.gravity), Vector3x8(Vector3(0.0f)));
+  
+  Vector3x8 pos(floatx8_load(bodies->positions.x + index), floatx8_load(bodies->positions.y + index), floatx8_load(bodies->positions.z + index));
+  Vector3x8 vel(floatx8_load(bodies->linear_velocities.x + index), floatx8_load(bodies->linear_velocities.y + index), floatx8_load(bodies->linear_velocities.z + index));
+  Vector3x8 force(floatx8_load(bodies->forces.x + index), floatx8_load(bodies->forces.y + index), floatx8_load(bodies->forces.z + index));
+
+  Vector3x8 accel = gravity + (force * inverse_mass) - (vel * floatx8(job.linear_drag));
+  vel             = vel + (accel * dt);
+  pos             = pos + (vel * dt);
+
+  floatx8_store(pos.x, bodies->positions.x + index);
+  floatx8_store(pos.y, bodies->positions.y + index);
+  floatx8_store(pos.z, bodies->positions.z + index);
+  floatx8_store(vel.x, bodies->linear_velocities.x + index);
+  floatx8_store(vel.y, bodies->linear_velocities.y + index);
+  floatx8_store(vel.z, bodies->linear_velocities.z + index);
+  floatx8_store(zero, bodies->forces.x + index);
+  floatx8_store(zero, bodies->forces.y + index);
+  floatx8_store(zero, bodies->forces.z + index);
+}
+
+// Moves the angular velocities and the orientations of the 8 bodies at `index` forward by `job.delta_time` seconds 
+// (the same as `quat_integrate`)
+SOC_INLINE void rigid_bodyx8_integrate_angular(const RigidBodyJob& job, const uint32 index) {
+  RigidBodySoA* bodies = job.bodies;
+  floatx8 dt(job.delta_time);
+  floatx8 half_dt(job.delta_time * 0.5f);
+  floatx8 zero(0.0f);
+  floatx8 one(1.0f);
+
+  // The world inverse inertia still belongs to the current orientation
+  floatx8 ixx = floatx8_load(bodies->world_inverse_inertias.xx + index);
+  floatx8 iyy = floatx8_load(bodies->world_inverse_inertias.yy + index);
+  floatx8 izz = floatx8_load(bodies->world_inverse_inertias.zz + index);
+  floatx8 ixy = floatx8_load(bodies->world_inverse_inertias.xy + index);
+  floatx8 ixz = floatx8_load(bodies->world_inverse_inertias.xz + index);
+  floatx8 iyz = floatx8_load(bodies->world_inverse_inertias.yz + index);
+
+  Vector3x8 torque(floatx8_load(bodies->torques.x + index), floatx8_load(bodies->torques.y + index), floatx8_load(bodies->torques.z + index));
+  Vector3x8 ang(floatx8_load(bodies->angular_velocities.x + index), floatx8_load(bodies->angular_velocities.y + index), floatx8_load(bodies->angular_velocities.z + index));
+
+  Vector3x8 ang_accel((ixx * torque.x) + (ixy * torque.y) + (ixz * torque.z), 
+                      (ixy * torque.x) + (iyy * torque.y) + (iyz * torque.z), 
+                      (ixz * torque.x) + (iyz * torque.y) + (izz * torque.z));
+  ang = ang + ((ang_accel - (ang * floatx8(job.angular_drag))) * dt);
+
+  floatx8 qx = floatx8_load(bodies->orientations.x + index);
+  floatx8 qy = floatx8_load(bodies->orientations.y + index);
+  floatx8 qz = floatx8_load(bodies->orientations.z + index);
+  floatx8 qw = floatx8_load(bodies->orientations.w + index);
+
+  floatx8 x = qx + (((ang.x * qw) + (ang.y * qz) - (ang.z * qy)) * half_dt);
+  floatx8 y = qy + (((ang.y * qw) + (ang.z * qx) - (ang.x * qz)) * half_dt);
+  floatx8 z = qz + (((ang.z * qw) + (ang.x * qy) - (ang.y * qx)) * half_dt);
+  floatx8 w = qw - (((ang.x * qx) + (ang.y * qy) + (ang.z * qz)) * half_dt);
+
+  // The padding has no orientation at all
+  floatx8 length2 = (x * x) + (y * y) + (z * z) + (w * w);
+  maskx8 is_valid = length2 > zero;
+  floatx8 inverse = floatx8_select(is_valid, one / floatx8_sqrt(floatx8_select(is_valid, length2, one)), zero);
+
+  floatx8_store(ang.x, bodies->angular_velocities.x + index);
+  floatx8_store(ang.y, bodies->angular_velocities.y + index);
+  floatx8_store(ang.z, bodies->angular_velocities.z + index);
+  floatx8_store(x * inverse, bodies->orientations.x + index);
+  floatx8_store(y * inverse, bodies->orientations.y + index);
+  floatx8_store(z * inverse, bodies->orientations.z + index);
+  floatx8_store(w * inverse, bodies->orientations.w + index);
+  floatx8_store(zero, bodies->torques.x + index);
+  floatx8_store(zero, bodies->torques.y + index);
+  floatx8_store(zero, bodies->torques.z + index);
+}
+
+// Rebuilds the world inverse inertias of the 8 bodies at `index` from their orientations 
+// (the same as `rigid_body_world_inverse_inertia`)
+SOC_INLINE void rigid_bodyx8_update_inertia(RigidBodySoA* bodies, const uint32 index) {
+  floatx8 one(1.0f);
+  floatx8 two(2.0f);
+
+  floatx8 x = floatx8_load(bodies->orientations.x + index);
+  floatx8 y = floatx8_load(bodies->orientations.y + index);
+  floatx8 z = floatx8_load(bodies->orientations.z + index);
+  floatx8 w = floatx8_load(bodies->orientations.w + index);
+
+  floatx8 x2 = x * x; 
+  floatx8 y2 = y * y; 
+  floatx8 z2 = z * z;
+  floatx8 xy = x * y; 
+  floatx8 xz = x * z;
+  floatx8 yz = y * z;
+  floatx8 wx = w * x;
+  floatx8 wy = w * y;
+  floatx8 wz = w * z;
+
+  Vector3x8 axis_x(one - two * (y2 + z2), two * (xy + wz), two * (xz - wy));
+  Vector3x8 axis_y(two * (xy - wz), one - two * (x2 + z2), two * (yz + wx));
+  Vector3x8 axis_z(two * (xz + wy), two * (yz - wx), one - two * (x2 + y2));
+
+  Vector3x8 scaled_x = axis_x * floatx8_load(bodies->local_inverse_inertias.x + index);
+  Vector3x8 scaled_y = axis_y * floatx8_load(bodies->local_inverse_inertias.y + index);
+  Vector3x8 scaled_z = axis_z * floatx8_load(bodies->local_inverse_inertias.z + index);
+
+  floatx8_store((scaled_x.x * axis_x.x) + (scaled_y.x * axis_y.x) + (scaled_z.x * axis_z.x), bodies->world_inverse_inertias.xx + index);
+  floatx8_store((scaled_x.y * axis_x.y) + (scaled_y.y * axis_y.y) + (scaled_z.y * axis_z.y), bodies->world_inverse_inertias.yy + index);
+  floatx8_store((scaled_x.z * axis_x.z) + (scaled_y.z * axis_y.z) + (scaled_z.z * axis_z.z), bodies->world_inverse_inertias.zz + index);
+  floatx8_store((scaled_x.x * axis_x.y) + (scaled_y.x * axis_y.y) + (scaled_z.x * axis_z.y), bodies->world_inverse_inertias.xy + index);
+  floatx8_store((scaled_x.x * axis_x.z) + (scaled_y.x * axis_y.z) + (scaled_z.x * axis_z.z), bodies->world_inverse_inertias.xz + index);
+  floatx8_store((scaled_x.y * axis_x.z) + (scaled_y.y * axis_y.z) + (scaled_z.y * axis_z.z), bodies->world_inverse_inertias.yz + index);
+}
+
+// Integrates the bodies of the blocks in `[begin, end)` (each block is `SOC_SOA_BLOCK` bodies)
+SOC_INLINE void rigid_body_integrate_range(void* user_data, const uint32 begin, const uint32 end) {
+  RigidBodyJob* job = (RigidBodyJob*)user_data;
+
+  for(uint32 i = begin * SOC_SOA_BLOCK; i < end * SOC_SOA_BLOCK; i += SOC_SOA_BLOCK) {
+    rigid_bodyx8_integrate_linear(*job, i);
+    rigid_bodyx8_integrate_angular(*job, i);
+    rigid_bodyx8_update_inertia(job->bodies, i);
+  }
+}
+
+#endif
+
+// Moves every body of `bodies` forward by `delta_time` seconds, splitting the work across `threads_count` threads
+//
+// The linear acceleration of each body is `gravity + force * inverse_mass - linear_velocity * linear_drag` and 
+// the angular acceleration is `world_inverse_inertia * torque - angular_velocity * angular_drag`, both applied 
+// with semi-implicit Euler. The orientations get turned by the new angular velocities (see `quat_integrate`), 
+// and the world inverse inertias get rebuilt for the new orientations (see `rigid_body_world_inverse_inertia`).
+// NOTE: The forces and torques are zeroed afterwards. The bodies are updated 8 at a time with the same results 
+// on every thread count and on both the SIMD and scalar paths, since the rigid body functions are compiled without 
+// fused multiply-adds (see `SOC_FP_STRICT_BEGIN`).
+SOC_API void rigid_body_integrate(RigidBodySoA& bodies, 
+                                  const Vector3& gravity, 
+                                  const float32 linear_drag, 
+                                  const float32 angular_drag, 
+                                  const float32 delta_time, 
+                                  const uint32 threads_count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void rigid_body_integrate(RigidBodySoA& bodies, 
+                                  const Vector3& gravity, 
+                                  const float32 linear_drag, 
+                                  const float32 angular_drag, 
+                                  const float32 delta_time, 
+                                  const uint32 threads_count) {
+  RigidBodyJob job;
+  job.bodies       = &bodies;
+  job.gravity      = gravity;
+  job.linear_drag  = linear_drag;
+  job.angular_drag = angular_drag;
+  job.delta_time   = delta_time;
+
+  parallel_for(soa_padded_count(bodies.count) / SOC_SOA_BLOCK, threads_count, rigid_body_integrate_range, &job);
+}
+#endif
+
+SOC_FP_STRICT_END
+
+///////////////////////////////////////////////////////////////
+
+// PCA types
+///////////////////////////////////////////////////////////////
+
+// The maximum number of Jacobi sweeps `mat3_eigen_symmetric` will take (it usually needs 4 or 5)
+#define SOC_EIGEN_MAX_SWEEPS 16
+
+// The number of points `covariance_accumulate` adds up in floats before moving the totals into doubles
+#define SOC_COVARIANCE_CHUNK 1024
+
+// The running covariance of a set of points
+//
+// Every point is added relative to `origin` (the first point ever added), which keeps the sums small, and the 
+// totals are kept in doubles, so millions of points far away from the world origin still give a good covariance. 
+// Accumulators of separate point sets (from separate threads, for example) can be combined with `covariance_merge`.
+struct Covariance {
+  Vector3 origin;
+
+  float64 sums[3];
+  float64 products[6]; // `xx`, `yy`, `zz`, `xy`, `xz`, and `yz`
+  uint64 count;
+
+  // Default CTOR with no points
+  Covariance() 
+    :origin(0.0f), sums{0.0, 0.0, 0.0}, products{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, count(0)
+  {}
+};
+
+///////////////////////////////////////////////////////////////
+
+// PCA functions
+///////////////////////////////////////////////////////////////
+
+#ifndef SOC_DECLARE_ONLY
+
+// Zeroes `a[p][q]` of the symmetric `a` with a Jacobi rotation ("Numerical Recipes" 11.1) and adds the same 
+// rotation to the eigenvectors in `v`, where `r` is the remaining index
+// NOTE: Always called with constant indices, so the arrays stay in registers once inlined.
+SOC_INLINE void mat3_jacobi_rotate(float32 a[3][3], float32 v[3][3], const uint32 p, const uint32 q, const uint32 r) {
+  float32 apq = a[p][q];
+  if(apq == 0.0f) {
+    return;
+  }
+
+  // The smaller of the two angles that zero `a[p][q]` 
+  float32 theta = (a[q][q] - a[p][p]) / (2.0f * apq);
+  float32 t     = std::fabs(theta) > 1e10f ? 0.5f / theta 
+                                           : (theta >= 0.0f ? 1.0f : -1.0f) / (std::fabs(theta) + std::sqrt((theta * theta) + 1.0f));
+  float32 c     = 1.0f / std::sqrt((t * t) + 1.0f);
+  float32 s     = t * c;
+
+  a[p][p] -= t * apq;
+  a[q][q] += t * apq;
+  a[p][q]  = 0.0f;
+  a[q][p]  = 0.0f;
+
+  float32 arp = a[r][p];
+  float32 arq = a[r][q];
+  a[r][p]     = (c * arp) - (s * arq);
+  a[p][r]     = a[r][p];
+  a[r][q]     = (s * arp) + (c * arq);
+  a[q][r]     = a[r][q];
+
+  for(uint32 k = 0; k < 3; k++) {
+    float32 vkp = v[k][p];
+    float32 vkq = v[k][q];
+    v[k][p]     = (c * vkp) - (s * vkq);
+    v[k][q]     = (s * vkp) + (c * vkq);
+  }
+}
+
+#endif
+
+// Returns the eigenvalues of the symmetric matrix `m` from the biggest to the smallest and writes the matching 
+// eigenvectors into the columns of `out_vectors` and the same rotation into `out_rotation` (if they are not `nullptr`)
+// NOTE: This uses cyclic Jacobi rotations, which are slower than a closed form but never fall apart when two 
+// eigenvalues are (almost) the same. The eigenvectors always make a right-handed rotation.
+SOC_API const Vector3 mat3_eigen_symmetric(const Matrix3& m, Matrix3* out_vectors, Quaternion* out_rotation);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Vector3 mat3_eigen_symmetric(const Matrix3& m, Matrix3* out_vectors, Quaternion* out_rotation) {
+  float32 a[3][3] = {
+    {m.data[0], m.data[1], m.data[2]}, 
+    {m.data[3], m.data[4], m.data[5]}, 
+    {m.data[6], m.data[7], m.data[8]},
+  };
+  float32 v[3][3] = {
+    {1.0f, 0.0f, 0.0f}, 
+    {0.0f, 1.0f, 0.0f}, 
+    {0.0f, 0.0f, 1.0f},
+  };
+
+  for(uint32 sweep = 0; sweep < SOC_EIGEN_MAX_SWEEPS; sweep++) {
+    float32 off  = (a[0][1] * a[0][1]) + (a[0][2] * a[0][2]) + (a[1][2] * a[1][2]);
+    float32 diag = (a[0][0] * a[0][0]) + (a[1][1] * a[1][1]) + (a[2][2] * a[2][2]);
+    if(off <= (SOC_EPSILON * SOC_EPSILON * diag) || off == 0.0f) {
+      break;
+    }
+
+    mat3_jacobi_rotate(a, v, 0, 1, 2);
+    mat3_jacobi_rotate(a, v, 0, 2, 1);
+    mat3_jacobi_rotate(a, v, 1, 2, 0);
+  }
+
+  // From the biggest eigenvalue to the smallest
+  uint32 order[3] = {0, 1, 2};
+  for(uint32 i = 0; i < 2; i++) {
+    for(uint32 j = 0; j < 2 - i; j++) {
+      if(a[order[j]][order[j]] < a[order[j + 1]][order[j + 1]]) {
+        uint32 temp  = order[j];
+        order[j]     = order[j + 1];
+        order[j + 1] = temp;
+      }
+    }
+  }
+
+  Vector3 axes[3];
+  for(uint32 i = 0; i < 3; i++) {
+    axes[i] = Vector3(v[0][order[i]], v[1][order[i]], v[2][order[i]]);
+  }
+
+  // Flipping an eigenvector keeps it an eigenvector
+  if(vec3_dot(vec3_cross(axes[0], axes[1]), axes[2]) < 0.0f) {
+    axes[2] = -axes[2];
+  }
+
+  Matrix3 vectors(axes[0], axes[1], axes[2]);
+  if(out_vectors) {
+    *out_vectors = vectors;
+  }
+  if(out_rotation) {
+    *out_rotation = quat_set_mat3(vectors);
+  }
+
+  return Vector3(a[order[0]][order[0]], a[order[1]][order[1]], a[order[2]][order[2]]);
+}
+#endif
+
+// Returns the mean of the points in `cov`
+SOC_INLINE const Vector3 covariance_mean(const Covariance& cov) {
+  float64 count = cov.count > 0 ? (float64)cov.count : 1.0;
+  return cov.origin + Vector3((float32)(cov.sums[0] / count), (float32)(cov.sums[1] / count), (float32)(cov.sums[2] / count));
+}
+
+// Returns the (population) covariance matrix of the points in `cov`
+SOC_INLINE const Matrix3 covariance_matrix(const Covariance& cov) {
+  float64 count = cov.count > 0 ? (float64)cov.count : 1.0;
+  float64 mean[3] = {cov.sums[0] / count, cov.sums[1] / count, cov.sums[2] / count};
+
+  float32 xx = (float32)((cov.products[0] / count) - (mean[0] * mean[0]));
+  float32 yy = (float32)((cov.products[1] / count) - (mean[1] * mean[1]));
+  float32 zz = (float32)((cov.products[2] / count) - (mean[2] * mean[2]));
+  float32 xy = (float32)((cov.products[3] / count) - (mean[0] * mean[1]));
+  float32 xz = (float32)((cov.products[4] / count) - (mean[0] * mean[2]));
+  float32 yz = (float32)((cov.products[5] / count) - (mean[1] * mean[2]));
+
+  return Matrix3(xx, xy, xz, 
+                 xy, yy, yz, 
+                 xz, yz, zz);
+}
+
+// Adds every point in `other` to `cov` 
+// NOTE: The two can have different origins, so any two accumulators can be merged in any order.
+SOC_INLINE void covariance_merge(Covariance& cov, const Covariance& other) {
+  if(other.count == 0) {
+    return;
+  }
+  else if(cov.count == 0) {
+    cov = other;
+    return;
+  }
+
+  // Moving the sums of `other` over to the origin of `cov`
+  float64 shift[3] = {
+    (float64)other.origin.x - (float64)cov.origin.x, 
+    (float64)other.origin.y - (float64)cov.origin.y, 
+    (float64)other.origin.z - (float64)cov.origin.z,
+  };
+  float64 count = (float64)other.count;
+
+  const uint32 pairs[6][2] = {{0, 0}, {1, 1}, {2, 2}, {0, 1}, {0, 2}, {1, 2}};
+  for(uint32 i = 0; i < 6; i++) {
+    uint32 j = pairs[i][0];
+    uint32 k = pairs[i][1];
+
+    cov.products[i] += other.products[i] + (shift[j] * other.sums[k]) + (other.sums[j] * shift[k]) + (count * shift[j] * shift[k]);
+  }
+
+  for(uint32 i = 0; i < 3; i++) {
+    cov.sums[i] += other.sums[i] + (count * shift[i]);
+  }
+
+  cov.count += other.count;
+}
+
+// Adds the `count` points in `points` to `cov`, 8 at a time 
+SOC_API void covariance_accumulate(Covariance& cov, const Vector3* points, const uint32 count);
+
+#ifndef SOC_DECLARE_ONLY
+
+// Returns the sum of the lanes of `v` (always in the same order)
+SOC_INLINE const float64 covariance_lanes_sum(const floatx8& v) {
+  float64 low  = ((float64)v.lanes[0] + (float64)v.lanes[1]) + ((float64)v.lanes[2] + (float64)v.lanes[3]);
+  float64 high = ((float64)v.lanes[4] + (float64)v.lanes[5]) + ((float64)v.lanes[6] + (float64)v.lanes[7]);
+
+  return low + high;
+}
+
+SOC_API void covariance_accumulate(Covariance& cov, const Vector3* points, const uint32 count) {
+  if(count == 0) {
+    return;
+  }
+  else if(cov.count == 0) {
+    cov.origin = points[0];
+  }
+
+  Vector3x8 origin(cov.origin);
+  uint32 i = 0;
+
+  while(i + 8 <= count) {
+    floatx8 x, y, z;
+    floatx8 xx, yy, zz, xy, xz, yz;
+    
+    uint32 end = (count - i) > SOC_COVARIANCE_CHUNK ? (i + SOC_COVARIANCE_CHUNK) : count;
+    for(; i + 8 <= end; i += 8) {
+      Vector3x8 d = vec3x8_load(points + i) - origin;
+
+      x  = x + d.x;
+      y  = y + d.y;
+      z  = z + d.z;
+      xx = xx + (d.x * d.x);
+      yy = yy + (d.y * d.y);
+      zz = zz + (d.z * d.z);
+      xy = xy + (d.x * d.y);
+      xz = xz + (d.x * d.z);
+      yz = yz + (d.y * d.z);
+    }
+
+    cov.sums[0]     += covariance_lanes_sum(x);
+    cov.sums[1]     += covariance_lanes_sum(y);
+    cov.sums[2]     += covariance_lanes_sum(z);
+    cov.products[0] += covariance_lanes_sum(xx);
+    cov.products[1] += covariance_lanes_sum(yy);
+    cov.products[2] += covariance_lanes_sum(zz);
+    cov.products[3] += covariance_lanes_sum(xy);
+    cov.products[4] += covariance_lanes_sum(xz);
+    cov.products[5] += covariance_lanes_sum(yz);
+  }
+
+  for(; i < count; i++) {
+    Vector3 d = points[i] - cov.origin;
+
+    cov.sums[0]     += d.x;
+    cov.sums[1]     += d.y;
+    cov.sums[2]     += d.z;
+    cov.products[0] += d.x * d.x;
+    cov.products[1] += d.y * d.y;
+    cov.products[2] += d.z * d.z;
+    cov.products[3] += d.x * d.y;
+    cov.products[4] += d.x * d.z;
+    cov.products[5] += d.y * d.z;
+  }
+
+  cov.count += count;
+}
+
+// The shared state of the `covariance_from_points` ranges
+struct CovarianceJob {
+  const Vector3* points; 
+  uint32 count;
+  uint32 parts_count;
+
+  Covariance parts[SOC_MAX_THREADS];
+};
+
+// Accumulates the parts in `[begin, end)` of the points
+SOC_INLINE void covariance_from_points_range(void* user_data, const uint32 begin, const uint32 end) {
+  CovarianceJob* job = (CovarianceJob*)user_data;
+
+  for(uint32 i = begin; i < end; i++) {
+    uint32 first = (uint32)(((uint64)job->count * i) / job->parts_count);
+    uint32 last  = (uint32)(((uint64)job->count * (i + 1)) / job->parts_count);
+
+    covariance_accumulate(job->parts[i], job->points + first, last - first);
+  }
+}
+
+#endif
+
+// Returns the covariance of the `count` points in `points`, splitting the work across `threads_count` threads
+// NOTE: Every thread fills its own `Covariance` and they get merged at the end, so the result only depends on `threads_count`.
+SOC_API const Covariance covariance_from_points(const Vector3* points, const uint32 count, const uint32 threads_count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Covariance covariance_from_points(const Vector3* points, const uint32 count, const uint32 threads_count) {
+  CovarianceJob job;
+  job.points      = points;
+  job.count       = count;
+  job.parts_count = threads_count < 1 ? 1 : (threads_count > SOC_MAX_THREADS ? SOC_MAX_THREADS : threads_count);
+
+  parallel_for(job.parts_count, job.parts_count, covariance_from_points_range, &job);
+
+  Covariance result;
+  for(uint32 i = 0; i < job.parts_count; i++) {
+    covariance_merge(result, job.parts[i]);
+  }
+
+  return result;
+}
+#endif
+
+// Returns an OBB around the `count` points in `points` with the principal axes of their covariance
+// NOTE: The box is as tight as PCA gets, which is usually close to the tightest box but not always (points spread 
+// evenly along two or three axes have no preferred direction, for example). Returns an empty box at the origin if `count` is 0.
+SOC_API const OBB obb_fit(const Vector3* points, const uint32 count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const OBB obb_fit(const Vector3* points, const uint32 count) {
+  if(count == 0) {
+    return OBB();
+  }
+
+  Covariance cov;
+  covariance_accumulate(cov, points, count);
+
+  Matrix3 orientation;
+  mat3_eigen_symmetric(covariance_matrix(cov), &orientation, nullptr);
+
+  // The extents along each axis (relative to the first point to keep the numbers small)
+  Vector3 axes[3] = {Vector3(orientation.data[0], orientation.data[1], orientation.data[2]), 
+                     Vector3(orientation.data[3], orientation.data[4], orientation.data[5]), 
+                     Vector3(orientation.data[6], orientation.data[7], orientation.data[8])};
+  float32 mins[3] = {0.0f, 0.0f, 0.0f};
+  float32 maxs[3] = {0.0f, 0.0f, 0.0f};
+  Vector3x8 origin(cov.origin);
+  
+  uint32 i = 0;
+  if(count >= 8) {
+    Vector3x8 axes_x8[3] = {Vector3x8(axes[0]), Vector3x8(axes[1]), Vector3x8(axes[2])};
+    floatx8 mins_x8[3];
+    floatx8 maxs_x8[3];
+
+    for(; i + 8 <= count; i += 8) {
+      Vector3x8 d = vec3x8_load(points + i) - origin;
+
+      for(uint32 k = 0; k < 3; k++) {
+        floatx8 dist = vec3x8_dot(d, axes_x8[k]);
+        mins_x8[k]   = floatx8_min(mins_x8[k], dist);
+        maxs_x8[k]   = floatx8_max(maxs_x8[k], dist);
+      }
+    }
+
+    for(uint32 k = 0; k < 3; k++) {
+      for(uint32 j = 0; j < 8; j++) {
+        mins[k] = mins_x8[k].lanes[j] < mins[k] ? mins_x8[k].lanes[j] : mins[k];
+        maxs[k] = maxs_x8[k].lanes[j] > maxs[k] ? maxs_x8[k].lanes[j] : maxs[k];
+      }
+    }
+  }
+
+  for(; i < count; i++) {
+    Vector3 d = points[i] - cov.origin;
+
+    for(uint32 k = 0; k < 3; k++) {
+      float32 dist = vec3_dot(d, axes[k]);
+      mins[k]      = dist < mins[k] ? dist : mins[k];
+      maxs[k]      = dist > maxs[k] ? dist : maxs[k];
+    }
+  }
+
+  Vector3 center = cov.origin;
+  Vector3 extents;
+  for(uint32 k = 0; k < 3; k++) {
+    center                += axes[k] * ((mins[k] + maxs[k]) * 0.5f);
+    extents.components[k]  = (maxs[k] - mins[k]) * 0.5f;
+  }
+
+  return OBB(center, extents, orientation);
+}
+#endif
+
+#ifndef SOC_DECLARE_ONLY
+
+// The shared state of the `obb_fit_batch` ranges
+struct OBBFitJob {
+  const Vector3* points; 
+  const uint32* offsets;
+  OBB* out_obbs;
+};
+
+// Fits the OBBs of the point sets in `[begin, end)`
+SOC_INLINE void obb_fit_range(void* user_data, const uint32 begin, const uint32 end) {
+  OBBFitJob* job = (OBBFitJob*)user_data;
+
+  for(uint32 i = begin; i < end; i++) {
+    job->out_obbs[i] = obb_fit(job->points + job->offsets[i], job->offsets[i + 1] - job->offsets[i]);
+  }
+}
+
+#endif
+
+// Fits an OBB (see `obb_fit`) around each of the `count` point sets in `points` and writes them into `out_obbs`, 
+// splitting the work across `threads_count` threads
+// NOTE: `offsets` has `count + 1` entries where the points of set `i` are in the range `[offsets[i], offsets[i + 1])`, 
+// which fits meshlets and other clusters that are packed one after the other.
+SOC_API void obb_fit_batch(const Vector3* points, const uint32* offsets, const uint32 count, OBB* out_obbs, const uint32 threads_count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void obb_fit_batch(const Vector3* points, const uint32* offsets, const uint32 count, OBB* out_obbs, const uint32 threads_count) {
+  OBBFitJob job;
+  job.points   = points;
+  job.offsets  = offsets;
+  job.out_obbs = out_obbs;
+
+  parallel_for(count, threads_count, obb_fit_range, &job);
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Bounding volume types
+///////////////////////////////////////////////////////////////
+
+// Points that are within `SOC_WELZL_TOLERANCE` (relative to the squared radius) outside of a sphere count as inside
+// while building the minimum sphere, which keeps nearly degenerate support points from blowing it up
+#define SOC_WELZL_TOLERANCE 1e-7
+
+// The number of points `sphere_from_points_welzl` samples (evenly) to start its working set with
+#define SOC_WELZL_SAMPLE 512
+
+// Points that are within `SOC_HULL_TOLERANCE` float epsilons (relative to the size of the points) of a hull face count 
+// as being on the face
+#define SOC_HULL_TOLERANCE 3.0f
+
+// The index of "no face" or "no point" in `HullFace`
+#define SOC_HULL_NONE 0xffffffff
+
+// A triangle of the hull that `convex_hull_from_points` builds
+// NOTE: This only lives in the arena while the hull is being built.
+struct HullFace {
+  uint32 vertices[3]; 
+
+  // The face on the other side of the edge from `vertices[i]` to `vertices[(i + 1) % 3]`
+  uint32 neighbors[3]; 
+
+  Vector3 normal; 
+  float32 distance;
+
+  // The points in front of the face (linked through the `next` array of the builder) and the farthest one
+  uint32 outside;
+  uint32 farthest; 
+  float32 farthest_distance;
+
+  // The faces before and after this one in the list of faces with points in front of them
+  uint32 pending_prev; 
+  uint32 pending_next;
+
+  uint32 visited;
+  bool is_alive;
+  bool is_visible;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Bounding volume functions
+///////////////////////////////////////////////////////////////
+
+#ifndef SOC_DECLARE_ONLY
+
+// Keeps the biggest of `values` in every lane of `best` along with the index of its point (`first` being the index of lane 0)
+SOC_INLINE void bounds_track_max(const floatx8& values, const uint32 first, floatx8& best, uint32* best_indices) {
+  maskx8 is_bigger = values > best;
+
+  uint32 bits = maskx8_bits(is_bigger);
+  if(bits == 0) {
+    return;
+  }
+
+  best = floatx8_select(is_bigger, values, best);
+  for(uint32 i = 0; i < 8; i++) {
+    if(bits & (1 << i)) {
+      best_indices[i] = first + i;
+    }
+  }
+}
+
+// Returns the index of the biggest lane of `best` (the lowest index wins a tie)
+SOC_INLINE const uint32 bounds_reduce_max(const floatx8& best, const uint32* best_indices, float32* out_value) {
+  uint32 index  = best_indices[0];
+  float32 value = best.lanes[0];
+
+  for(uint32 i = 1; i < 8; i++) {
+    if(best.lanes[i] > value || (best.lanes[i] == value && best_indices[i] < index)) {
+      index = best_indices[i];
+      value = best.lanes[i];
+    }
+  }
+
+  *out_value = value;
+  return index;
+}
+
+// Writes the indices of the points with the smallest and biggest X, Y, and Z (in that order) into `out_indices`
+SOC_INLINE void bounds_extremes(const Vector3* points, const uint32 count, uint32* out_indices) {
+  floatx8 best[6]; 
+  uint32 best_indices[6][8] = {};
+  for(uint32 i = 0; i < 6; i++) {
+    best[i] = floatx8(-SOC_FLOAT_MAX);
+  }
+
+  uint32 i = 0;
+  for(; i + 8 <= count; i += 8) {
+    Vector3x8 p = vec3x8_load(points + i);
+
+    bounds_track_max(-p.x, i, best[0], best_indices[0]);
+    bounds_track_max(p.x,  i, best[1], best_indices[1]);
+    bounds_track_max(-p.y, i, best[2], best_indices[2]);
+    bounds_track_max(p.y,  i, best[3], best_indices[3]);
+    bounds_track_max(-p.z, i, best[4], best_indices[4]);
+    bounds_track_max(p.z,  i, best[5], best_indices[5]);
+  }
+
+  float32 values[6];
+  for(uint32 k = 0; k < 6; k++) {
+    out_indices[k] = bounds_reduce_max(best[k], best_indices[k], &values[k]);
+  }
+
+  for(; i < count; i++) {
+    float32 point_values[6] = {-points[i].x, points[i].x, -points[i].y, points[i].y, -points[i].z, points[i].z};
+
+    for(uint32 k = 0; k < 6; k++) {
+      if(point_values[k] > values[k]) {
+        values[k]      = point_values[k];
+        out_indices[k] = i;
+      }
+    }
+  }
+}
+
+// Grows the sphere at `center` with `radius` just enough to hold `point` (Ritter's update)
+SOC_INLINE void sphere_grow(Vector3& center, float32& radius, const Vector3& point) {
+  Vector3 diff  = point - center;
+  float32 dist2 = vec3_dot(diff, diff);
+  if(dist2 <= (radius * radius)) {
+    return;
+  }
+
+  float32 dist       = std::sqrt(dist2);
+  float32 new_radius = (radius + dist) * 0.5f;
+
+  center += diff * ((new_radius - radius) / dist);
+  radius  = new_radius;
+}
+
+// Returns the distance from `center` to the point farthest away from it
+SOC_INLINE const float32 sphere_radius_around(const Vector3* points, const uint32 count, const Vector3& center) {
+  Vector3x8 center_x8(center);
+  floatx8 max_dist2(0.0f);
+
+  uint32 i = 0;
+  for(; i + 8 <= count; i += 8) {
+    Vector3x8 diff = vec3x8_load(points + i) - center_x8;
+    max_dist2      = floatx8_max(max_dist2, vec3x8_dot(diff, diff));
+  }
+
+  float32 dist2 = 0.0f;
+  for(uint32 k = 0; k < 8; k++) {
+    dist2 = max_dist2.lanes[k] > dist2 ? max_dist2.lanes[k] : dist2;
+  }
+
+  for(; i < count; i++) {
+    Vector3 diff     = points[i] - center;
+    float32 to_point = vec3_dot(diff, diff);
+    dist2            = to_point > dist2 ? to_point : dist2;
+  }
+
+  return std::sqrt(dist2);
+}
+
+#endif
+
+// Returns a sphere around the `count` `points` using Ritter's algorithm 
+// NOTE: This is a single pass over the points after finding the extreme points along X, Y, and Z (8 at a time), 
+// so it is fast enough for deforming meshes every frame. The sphere is usually 5% to 20% bigger than the minimum 
+// one (see `sphere_from_points_welzl`). Growing the sphere rounds its center and radius, so the radius is measured 
+// again around the final center in one last pass, which puts every point inside of the returned sphere. 
+// Returns a sphere of no size at the origin if `count` is 0.
+SOC_API const Sphere sphere_from_points_ritter(const Vector3* points, const uint32 count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const Sphere sphere_from_points_ritter(const Vector3* points, const uint32 count) {
+  if(count == 0) {
+    return Sphere();
+  }
+
+  uint32 extremes[6];
+  bounds_extremes(points, count, extremes);
+
+  // Starting with the pair of extreme points that are the farthest apart
+  Vector3 a         = points[extremes[0]];
+  Vector3 b         = points[extremes[1]];
+  float32 max_dist2 = vec3_dot(b - a, b - a);
+  for(uint32 i = 1; i < 3; i++) {
+    Vector3 min     = points[extremes[i * 2 + 0]];
+    Vector3 max     = points[extremes[i * 2 + 1]];
+    float32 dist2   = vec3_dot(max - min, max - min);
+
+    if(dist2 > max_dist2) {
+      a         = min;
+      b         = max;
+      max_dist2 = dist2;
+    }
+  }
+
+  Vector3 center = (a + b) * 0.5f;
+  float32 radius = std::sqrt(max_dist2) * 0.5f;
+
+  // Only the blocks with a point outside of the sphere go through the (scalar) growing
+  uint32 i = 0;
+  for(; i + 8 <= count; i += 8) {
+    Vector3x8 diff = vec3x8_load(points + i) - Vector3x8(center);
+    if(!maskx8_any(vec3x8_dot(diff, diff) > floatx8(radius * radius))) {
+      continue;
+    }
+
+    for(uint32 j = 0; j < 8; j++) {
+      sphere_grow(center, radius, points[i + j]);
+    }
+  }
+
+  for(; i < count; i++) {
+    sphere_grow(center, radius, points[i]);
+  }
+
+  return Sphere(center, sphere_radius_around(points, count, center));
+}
+#endif
+
+#ifndef SOC_DECLARE_ONLY
+
+// A sphere in doubles that the minimum sphere is built with 
+struct WelzlSphere {
+  float64 center[3]; 
+  float64 radius2;
+};
+
+// Returns true if `point` is inside `sphere` (give or take `SOC_WELZL_TOLERANCE`)
+SOC_INLINE const bool welzl_contains(const WelzlSphere& sphere, const Vector3& point) {
+  float64 dx = (float64)point.x - sphere.center[0];
+  float64 dy = (float64)point.y - sphere.center[1];
+  float64 dz = (float64)point.z - sphere.center[2];
+
+  return ((dx * dx) + (dy * dy) + (dz * dz)) <= (sphere.radius2 * (1.0 + SOC_WELZL_TOLERANCE));
+}
+
+// Returns the smallest sphere with both `a` and `b` on its surface
+SOC_INLINE const WelzlSphere welzl_sphere2(const Vector3& a, const Vector3& b) {
+  float64 half[3] = {
+    ((float64)b.x - (float64)a.x) * 0.5, 
+    ((float64)b.y - (float64)a.y) * 0.5, 
+    ((float64)b.z - (float64)a.z) * 0.5,
+  };
+
+  return WelzlSphere{
+    {(float64)a.x + half[0], (float64)a.y + half[1], (float64)a.z + half[2]}, 
+    (half[0] * half[0]) + (half[1] * half[1]) + (half[2] * half[2]),
+  };
+}
+
+// Returns the smallest sphere with `a`, `b`, and `c` on its surface (their circumcircle)
+// NOTE: Points on a line have no circumcircle, so the sphere around the two points that are farthest apart is returned instead.
+SOC_INLINE const WelzlSphere welzl_sphere3(const Vector3& a, const Vector3& b, const Vector3& c) {
+  float64 ab[3] = {(float64)b.x - (float64)a.x, (float64)b.y - (float64)a.y, (float64)b.z - (float64)a.z};
+  float64 ac[3] = {(float64)c.x - (float64)a.x, (float64)c.y - (float64)a.y, (float64)c.z - (float64)a.z};
+  float64 n[3]  = {
+    (ab[1] * ac[2]) - (ab[2] * ac[1]), 
+    (ab[2] * ac[0]) - (ab[0] * ac[2]), 
+    (ab[0] * ac[1]) - (ab[1] * ac[0]),
+  };
+
+  float64 ab2 = (ab[0] * ab[0]) + (ab[1] * ab[1]) + (ab[2] * ab[2]);
+  float64 ac2 = (ac[0] * ac[0]) + (ac[1] * ac[1]) + (ac[2] * ac[2]);
+  float64 n2  = (n[0] * n[0]) + (n[1] * n[1]) + (n[2] * n[2]);
+
+  if(n2 <= (1e-12 * ab2 * ac2)) {
+    float64 bc2 = (((float64)c.x - (float64)b.x) * ((float64)c.x - (float64)b.x)) + 
+                  (((float64)c.y - (float64)b.y) * ((float64)c.y - (float64)b.y)) + 
+                  (((float64)c.z - (float64)b.z) * ((float64)c.z - (float64)b.z));
+
+    if(ab2 >= ac2 && ab2 >= bc2) {
+      return welzl_sphere2(a, b);
+    }
+    else if(ac2 >= bc2) {
+      return welzl_sphere2(a, c);
+    }
+
+    return welzl_sphere2(b, c);
+  }
+
+  // ((n x ab) * |ac|^2 + (ac x n) * |ab|^2) / (2 * |n|^2)
+  float64 scale     = 1.0 / (2.0 * n2);
+  float64 offset[3] = {
+    ((((n[1] * ab[2]) - (n[2] * ab[1])) * ac2) + (((ac[1] * n[2]) - (ac[2] * n[1])) * ab2)) * scale, 
+    ((((n[2] * ab[0]) - (n[0] * ab[2])) * ac2) + (((ac[2] * n[0]) - (ac[0] * n[2])) * ab2)) * scale, 
+    ((((n[0] * ab[1]) - (n[1] * ab[0])) * ac2) + (((ac[0] * n[1]) - (ac[1] * n[0])) * ab2)) * scale,
+  };
+
+  return WelzlSphere{
+    {(float64)a.x + offset[0], (float64)a.y + offset[1], (float64)a.z + offset[2]}, 
+    (offset[0] * offset[0]) + (offset[1] * offset[1]) + (offset[2] * offset[2]),
+  };
+}
+
+// Returns the smallest sphere with `a`, `b`, `c`, and `d` on its surface (their circumsphere)
+// NOTE: Points on a plane have no circumsphere, so the smallest circumcircle sphere of 3 of them that holds all 4 is returned instead.
+SOC_INLINE const WelzlSphere welzl_sphere4(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) {
+  float64 ab[3] = {(float64)b.x - (float64)a.x, (float64)b.y - (float64)a.y, (float64)b.z - (float64)a.z};
+  float64 ac[3] = {(float64)c.x - (float64)a.x, (float64)c.y - (float64)a.y, (float64)c.z - (float64)a.z};
+  float64 ad[3] = {(float64)d.x - (float64)a.x, (float64)d.y - (float64)a.y, (float64)d.z - (float64)a.z};
+
+  float64 ac_ad[3] = {(ac[1] * ad[2]) - (ac[2] * ad[1]), (ac[2] * ad[0]) - (ac[0] * ad[2]), (ac[0] * ad[1]) - (ac[1] * ad[0])};
+  float64 ad_ab[3] = {(ad[1] * ab[2]) - (ad[2] * ab[1]), (ad[2] * ab[0]) - (ad[0] * ab[2]), (ad[0] * ab[1]) - (ad[1] * ab[0])};
+  float64 ab_ac[3] = {(ab[1] * ac[2]) - (ab[2] * ac[1]), (ab[2] * ac[0]) - (ab[0] * ac[2]), (ab[0] * ac[1]) - (ab[1] * ac[0])};
+
+  float64 ab2 = (ab[0] * ab[0]) + (ab[1] * ab[1]) + (ab[2] * ab[2]);
+  float64 ac2 = (ac[0] * ac[0]) + (ac[1] * ac[1]) + (ac[2] * ac[2]);
+  float64 ad2 = (ad[0] * ad[0]) + (ad[1] * ad[1]) + (ad[2] * ad[2]);
+  float64 det = (ab[0] * ac_ad[0]) + (ab[1] * ac_ad[1]) + (ab[2] * ac_ad[2]);
+
+  if((det * det) <= (1e-12 * ab2 * ac2 * ad2)) {
+    const WelzlSphere candidates[4] = {
+      welzl_sphere3(a, b, c), 
+      welzl_sphere3(a, b, d), 
+      welzl_sphere3(a, c, d), 
+      welzl_sphere3(b, c, d),
+    };
+    const Vector3* others[4] = {&d, &c, &b, &a};
+
+    WelzlSphere best = candidates[0];
+    bool is_found    = false;
+    for(uint32 i = 0; i < 4; i++) {
+      if(!welzl_contains(candidates[i], *others[i])) {
+        continue;
+      }
+
+      if(!is_found || candidates[i].radius2 < best.radius2) {
+        best     = candidates[i];
+        is_found = true;
+      }
+    }
+
+    return best;
+  }
+
+  // (|ab|^2 * (ac x ad) + |ac|^2 * (ad x ab) + |ad|^2 * (ab x ac)) / (2 * det)
+  float64 scale     = 1.0 / (2.0 * det);
+  float64 offset[3] = {
+    ((ab2 * ac_ad[0]) + (ac2 * ad_ab[0]) + (ad2 * ab_ac[0])) * scale, 
+    ((ab2 * ac_ad[1]) + (ac2 * ad_ab[1]) + (ad2 * ab_ac[1])) * scale, 
+    ((ab2 * ac_ad[2]) + (ac2 * ad_ab[2]) + (ad2 * ab_ac[2])) * scale,
+  };
+
+  return WelzlSphere{
+    {(float64)a.x + offset[0], (float64)a.y + offset[1], (float64)a.z + offset[2]}, 
+    (offset[0] * offset[0]) + (offset[1] * offset[1]) + (offset[2] * offset[2]),
+  };
+}
+
+// Returns the minimum sphere around the `count` `points` (the iterative version of Welzl's algorithm)
+// NOTE: This takes expected linear time as long as the points are in a random order.
+SOC_INLINE const WelzlSphere welzl_min_sphere(const Vector3* points, const uint32 count) {
+  WelzlSphere sphere = welzl_sphere2(points[0], points[0]);
+
+  for(uint32 i = 1; i < count; i++) {
+    if(welzl_contains(sphere, points[i])) {
+      continue;
+    }
+
+    // `points[i]` is on the surface of the minimum sphere of the first `i + 1` points
+    sphere = welzl_sphere2(points[i], points[0]);
+    for(uint32 j = 1; j < i; j++) {
+      if(welzl_contains(sphere, points[j])) {
+        continue;
+      }
+
+      sphere = welzl_sphere2(points[i], points[j]);
+      for(uint32 k = 0; k < j; k++) {
+        if(welzl_contains(sphere, points[k])) {
+          continue;
+        }
+
+        sphere = welzl_sphere3(points[i], points[j], points[k]);
+        for(uint32 l = 0; l < k; l++) {
+          if(!welzl_contains(sphere, points[l])) {
+            sphere = welzl_sphere4(points[i], points[j], points[k], points[l]);
+          }
+        }
+      }
+    }
+  }
+
+  return sphere;
+}
+
+#endif
+
+// Finds the minimum sphere around the `count` `points` (Welzl's algorithm) and writes it into `out_sphere`
+// NOTE: Welzl's algorithm only runs over a small working set: a sample of `SOC_WELZL_SAMPLE` points plus the 
+// extreme points to begin with, and then the points that are still outside of its sphere (found 8 at a time) 
+// until there are none left. The working set comes from `arena` and is given back before returning. The sphere is 
+// built in doubles and its radius is then measured in floats, so every point is inside of `out_sphere`. Returns false 
+// (and leaves `out_sphere` as it was) if `arena` does not have enough room for `count + 6` points.
+SOC_API const bool sphere_from_points_welzl(const Vector3* points, const uint32 count, FrameArena& arena, Sphere* out_sphere);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool sphere_from_points_welzl(const Vector3* points, const uint32 count, FrameArena& arena, Sphere* out_sphere) {
+  if(count == 0) {
+    *out_sphere = Sphere();
+    return true;
+  }
+
+  uint64 marker        = arena_marker(arena);
+  uint32 capacity      = count + 6;
+  Vector3* working     = (Vector3*)arena_alloc(arena, sizeof(Vector3) * capacity, 64);
+  uint32 working_count = 0;
+  if(!working) {
+    return false;
+  }
+
+  uint32 extremes[6];
+  bounds_extremes(points, count, extremes);
+  for(uint32 i = 0; i < 6; i++) {
+    working[working_count++] = points[extremes[i]];
+  }
+
+  uint32 stride = count > SOC_WELZL_SAMPLE ? (count / SOC_WELZL_SAMPLE) : 1;
+  for(uint32 i = 0; i < count && working_count < capacity; i += stride) {
+    working[working_count++] = points[i];
+  }
+
+  // A fixed seed keeps the result the same from run to run
+  Random random        = random_create(count, 0);
+  WelzlSphere sphere   = welzl_sphere2(points[0], points[0]);
+  float64 last_radius2 = -1.0;
+
+  while(true) {
+    for(uint32 i = working_count - 1; i > 0; i--) {
+      uint32 j = random_next(random) % (i + 1);
+
+      Vector3 temp = working[i];
+      working[i]   = working[j];
+      working[j]   = temp;
+    }
+
+    // Adding points that only look outside (because of rounding) leaves the sphere as it was
+    sphere = welzl_min_sphere(working, working_count);
+    if(sphere.radius2 <= last_radius2) {
+      break;
+    }
+    last_radius2 = sphere.radius2;
+
+    // Points that are outside by less than the float rounding of the center are left to the final radius 
+    Vector3 center = Vector3((float32)sphere.center[0], (float32)sphere.center[1], (float32)sphere.center[2]);
+    float32 limit  = (float32)(sphere.radius2 * (1.0 + 1e-5));
+    uint32 added   = 0;
+
+    Vector3x8 center_x8(center);
+    floatx8 limit_x8(limit);
+
+    uint32 i = 0;
+    for(; i + 8 <= count; i += 8) {
+      Vector3x8 diff = vec3x8_load(points + i) - center_x8;
+      uint32 bits    = maskx8_bits(vec3x8_dot(diff, diff) > limit_x8);
+
+      for(uint32 j = 0; bits != 0 && j < 8; j++) {
+        if((bits & (1 << j)) && working_count < capacity) {
+          working[working_count++] = points[i + j];
+          added++;
+        }
+      }
+    }
+
+    for(; i < count; i++) {
+      Vector3 diff = points[i] - center;
+      if(vec3_dot(diff, diff) > limit && working_count < capacity) {
+        working[working_count++] = points[i];
+        added++;
+      }
+    }
+
+    if(added == 0) {
+      break;
+    }
+  }
+
+  arena_rewind(arena, marker);
+
+  Vector3 center = Vector3((float32)sphere.center[0], (float32)sphere.center[1], (float32)sphere.center[2]);
+  *out_sphere    = Sphere(center, sphere_radius_around(points, count, center));
+
+  return true;
+}
+#endif
+
+// Returns the number of bytes of arena memory that `convex_hull_from_points` needs (at most) for `count` points
+SOC_INLINE const uint64 convex_hull_memory_size(const uint32 count) {
+  uint64 faces_capacity = (2 * (uint64)count) + 8;
+
+  // The faces, the visible faces with their points, the horizon, the point list links, and the 
+  // per-vertex new faces (plus the padding of every allocation)
+  return (sizeof(HullFace) * faces_capacity) + 
+         (sizeof(uint32) * 2 * faces_capacity) + 
+         (sizeof(uint32) * 2 * (uint64)count) + 
+         (sizeof(uint32) * 3 * (uint64)count) + 
+         (64 * 7);
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// The state of `convex_hull_from_points` while it is building the hull
+struct HullBuilder {
+  const Vector3* points;
+  uint32 count;
+  float32 tolerance;
+
+  HullFace* faces; 
+  uint32 faces_count;
+  uint32 faces_capacity;
+  uint32 free_faces; 
+  uint32 pending;
+
+  uint32* next;         // The next point in the same outside list (one per point)
+  uint32* visible;      // The faces that can see the current eye point
+  uint32* outsides;     // The outside lists of `visible` before they were freed 
+  uint32* horizon;      // Pairs of the visible face and the edge of every horizon edge
+  uint32* edge_starts;  // The new face whose horizon edge starts at a vertex (one per point)
+  uint32* edge_ends;    // The new face whose horizon edge ends at a vertex (one per point)
+};
+
+// Adds `face` to the list of faces with points in front of them
+SOC_INLINE void hull_pending_add(HullBuilder& hull, const uint32 face) {
+  HullFace& f    = hull.faces[face];
+  f.pending_prev = SOC_HULL_NONE;
+  f.pending_next = hull.pending;
+
+  if(hull.pending != SOC_HULL_NONE) {
+    hull.faces[hull.pending].pending_prev = face;
+  }
+  hull.pending = face;
+}
+
+// Removes `face` from the list of faces with points in front of them
+SOC_INLINE void hull_pending_remove(HullBuilder& hull, const uint32 face) {
+  HullFace& f = hull.faces[face];
+
+  if(f.pending_prev != SOC_HULL_NONE) {
+    hull.faces[f.pending_prev].pending_next = f.pending_next;
+  }
+  else {
+    hull.pending = f.pending_next;
+  }
+
+  if(f.pending_next != SOC_HULL_NONE) {
+    hull.faces[f.pending_next].pending_prev = f.pending_prev;
+  }
+}
+
+// Creates a face with the vertices `a`, `b`, and `c` (counter-clockwise when looking at its front) and returns its index
+SOC_INLINE const uint32 hull_face_create(HullBuilder& hull, const uint32 a, const uint32 b, const uint32 c) {
+  uint32 face = hull.free_faces;
+  if(face != SOC_HULL_NONE) {
+    hull.free_faces = hull.faces[face].outside;
+  }
+  else {
+    face = hull.faces_count++;
+  }
+
+  HullFace& f = hull.faces[face];
+  f.vertices[0]       = a;
+  f.vertices[1]       = b;
+  f.vertices[2]       = c;
+  f.neighbors[0]      = SOC_HULL_NONE;
+  f.neighbors[1]      = SOC_HULL_NONE;
+  f.neighbors[2]      = SOC_HULL_NONE;
+  f.normal            = vec3_normalize(vec3_cross(hull.points[b] - hull.points[a], hull.points[c] - hull.points[a]));
+  f.distance          = vec3_dot(f.normal, hull.points[a]);
+  f.outside           = SOC_HULL_NONE;
+  f.farthest          = SOC_HULL_NONE;
+  f.farthest_distance = 0.0f;
+  f.pending_prev      = SOC_HULL_NONE;
+  f.pending_next      = SOC_HULL_NONE;
+  f.visited           = 0;
+  f.is_alive          = true;
+  f.is_visible        = false;
+
+  return face;
+}
+
+// Gives `face` back to the free list (reusing `outside` as the link)
+SOC_INLINE void hull_face_free(HullBuilder& hull, const uint32 face) {
+  HullFace& f = hull.faces[face];
+
+  if(f.outside != SOC_HULL_NONE) {
+    hull_pending_remove(hull, face);
+  }
+
+  f.is_alive      = false;
+  f.outside       = hull.free_faces;
+  hull.free_faces = face;
+}
+
+// Adds `point` to the outside list of the face among the `faces_count` `faces` it is the farthest in front of 
+// NOTE: Points that are not in front of any of them (give or take the tolerance) are inside the hull and get dropped.
+SOC_INLINE void hull_point_assign(HullBuilder& hull, const uint32 point, const uint32* faces, const uint32 faces_count) {
+  uint32 best_face  = SOC_HULL_NONE;
+  float32 best_dist = hull.tolerance;
+
+  for(uint32 i = 0; i < faces_count; i++) {
+    const HullFace& f = hull.faces[faces[i]];
+    float32 dist      = vec3_dot(f.normal, hull.points[point]) - f.distance;
+
+    if(dist > best_dist) {
+      best_face = faces[i];
+      best_dist = dist;
+    }
+  }
+
+  if(best_face == SOC_HULL_NONE) {
+    return;
+  }
+
+  HullFace& f = hull.faces[best_face];
+  if(f.outside == SOC_HULL_NONE) {
+    hull_pending_add(hull, best_face);
+  }
+
+  hull.next[point] = f.outside;
+  f.outside        = point;
+
+  if(f.farthest == SOC_HULL_NONE || best_dist > f.farthest_distance) {
+    f.farthest          = point;
+    f.farthest_distance = best_dist;
+  }
+}
+
+// Returns the index of the point farthest away from the line through `a` in the direction of `dir` (or from the plane 
+// through `a` with the normal `dir` if `is_plane`) and writes that distance (squared for the line) into `out_dist`
+SOC_INLINE const uint32 hull_farthest(const Vector3* points, const uint32 count, const Vector3& a, const Vector3& dir, const bool is_plane, float32* out_dist) {
+  floatx8 best(-SOC_FLOAT_MAX);
+  uint32 best_indices[8] = {};
+
+  Vector3x8 a_x8(a);
+  Vector3x8 dir_x8(dir);
+
+  uint32 i = 0;
+  for(; i + 8 <= count; i += 8) {
+    Vector3x8 diff = vec3x8_load(points + i) - a_x8;
+    
+    if(is_plane) {
+      bounds_track_max(floatx8_abs(vec3x8_dot(diff, dir_x8)), i, best, best_indices);
+    }
+    else {
+      Vector3x8 perp = vec3x8_cross(diff, dir_x8);
+      bounds_track_max(vec3x8_dot(perp, perp), i, best, best_indices);
+    }
+  }
+
+  float32 value = 0.0f;
+  uint32 index  = bounds_reduce_max(best, best_indices, &value);
+
+  for(; i < count; i++) {
+    Vector3 diff = points[i] - a;
+
+    float32 dist = 0.0f;
+    if(is_plane) {
+      dist = std::fabs(vec3_dot(diff, dir));
+    }
+    else {
+      Vector3 perp = vec3_cross(diff, dir);
+      dist         = vec3_dot(perp, perp);
+    }
+
+    if(dist > value) {
+      value = dist;
+      index = i;
+    }
+  }
+
+  *out_dist = value;
+  return index;
+}
+
+// Adds the point farthest in front of the pending face `face` to the hull 
+// NOTE: The faces that get tested are marked with `stamp` and the new ones with `stamp + 1`. Returns false if the horizon 
+// around the point is not a single loop, which only happens when rounding gets in the way.
+SOC_INLINE const bool hull_add_point(HullBuilder& hull, const uint32 face, const uint32 stamp) {
+  uint32 eye       = hull.faces[face].farthest;
+  Vector3 eye_pos  = hull.points[eye];
+
+  // Every face that can see the eye point (they are all connected to `face`)
+  uint32 visible_count        = 1;
+  hull.visible[0]             = face;
+  hull.faces[face].visited    = stamp;
+  hull.faces[face].is_visible = true;
+
+  for(uint32 i = 0; i < visible_count; i++) {
+    HullFace& f = hull.faces[hull.visible[i]];
+
+    for(uint32 e = 0; e < 3; e++) {
+      HullFace& neighbor = hull.faces[f.neighbors[e]];
+      if(neighbor.visited == stamp) {
+        continue;
+      }
+
+      neighbor.visited    = stamp;
+      neighbor.is_visible = (vec3_dot(neighbor.normal, eye_pos) - neighbor.distance) > 0.0f;
+      if(neighbor.is_visible) {
+        hull.visible[visible_count++] = f.neighbors[e];
+      }
+    }
+  }
+
+  // The edges between visible and hidden faces
+  uint32 horizon_count = 0;
+  for(uint32 i = 0; i < visible_count; i++) {
+    const HullFace& f = hull.faces[hull.visible[i]];
+
+    for(uint32 e = 0; e < 3; e++) {
+      if(hull.faces[f.neighbors[e]].is_visible) {
+        continue;
+      }
+      else if(horizon_count >= hull.count) {
+        return false;
+      }
+
+      hull.horizon[horizon_count * 2 + 0] = hull.visible[i];
+      hull.horizon[horizon_count * 2 + 1] = e;
+      horizon_count++;
+    }
+  }
+
+  // The new faces go into the horizon array (the face and the edge of every horizon edge are not needed after this)
+  for(uint32 i = 0; i < horizon_count; i++) {
+    const HullFace& f = hull.faces[hull.horizon[i * 2 + 0]];
+    uint32 e          = hull.horizon[i * 2 + 1];
+
+    hull.horizon[i * 2 + 0] = f.vertices[e];
+    hull.horizon[i * 2 + 1] = f.neighbors[e];
+  }
+
+  for(uint32 i = 0; i < visible_count; i++) {
+    hull.outsides[i]                       = hull.faces[hull.visible[i]].outside;
+    hull.faces[hull.visible[i]].is_visible = false;
+
+    hull_face_free(hull, hull.visible[i]);
+  }
+
+  // One new face from every horizon edge to the eye point
+  for(uint32 i = 0; i < horizon_count; i++) {
+    uint32 start   = hull.horizon[i * 2 + 0];
+    uint32 hidden  = hull.horizon[i * 2 + 1];
+    
+    // The hidden face goes around the same edge the other way
+    const HullFace& h = hull.faces[hidden];
+    uint32 e          = h.vertices[1] == start ? 0 : (h.vertices[2] == start ? 1 : 2);
+    uint32 end        = h.vertices[e];
+
+    uint32 new_face = hull_face_create(hull, start, end, eye);
+    hull.faces[new_face].neighbors[0] = hidden;
+    hull.faces[new_face].visited      = stamp + 1;
+    hull.faces[hidden].neighbors[e]   = new_face;
+
+    hull.edge_starts[start] = new_face;
+    hull.edge_ends[end]     = new_face;
+    hull.visible[i]         = new_face;
+  }
+
+  for(uint32 i = 0; i < horizon_count; i++) {
+    HullFace& f = hull.faces[hull.visible[i]];
+    
+    // Every horizon vertex has to start exactly one new edge and end exactly one 
+    uint32 after  = hull.edge_starts[f.vertices[1]];
+    uint32 before = hull.edge_ends[f.vertices[0]];
+    if(hull.edge_starts[f.vertices[0]] != hull.visible[i] || after == SOC_HULL_NONE || before == SOC_HULL_NONE || 
+       hull.faces[after].visited != (stamp + 1) || hull.faces[before].visited != (stamp + 1) || 
+       hull.faces[after].vertices[0] != f.vertices[1] || hull.faces[before].vertices[1] != f.vertices[0]) {
+      return false;
+    }
+
+    f.neighbors[1] = after;
+    f.neighbors[2] = before;
+  }
+
+  // The points in front of the old faces are either in front of a new one or inside the hull now
+  for(uint32 i = 0; i < visible_count; i++) {
+    uint32 point = hull.outsides[i];
+
+    while(point != SOC_HULL_NONE) {
+      uint32 next = hull.next[point];
+      if(point != eye) {
+        hull_point_assign(hull, point, hull.visible, horizon_count);
+      }
+
+      point = next;
+    }
+  }
+
+  return true;
+}
+
+#endif
+
+// Builds the convex hull of the `count` `points` (quickhull) and writes its triangles into `out_indices`, returning 
+// the number of indices written (3 per triangle)
+// NOTE: The triangles are counter-clockwise when looking at them from outside of the hull and index into `points`, 
+// so `out_indices` is an index buffer as is. `out_indices` needs room for `(2 * count - 4) * 3` indices in the worst case. 
+// Points within `SOC_HULL_TOLERANCE` of a face are left out, and the faces are never merged, so very dense points that are 
+// almost on a plane can leave dents about as deep as the float rounding of the thinnest triangles. 
+// All the memory the builder needs comes from `arena` (see `convex_hull_memory_size`) and is given back before returning. 
+// Returns 0 if `arena` does not have enough room, if the points are all on a plane (or a line), if `count` is less than 4, 
+// or (very rarely) if rounding leaves the hull in a state it cannot be closed from.
+SOC_API const uint32 convex_hull_from_points(const Vector3* points, const uint32 count, FrameArena& arena, uint32* out_indices);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const uint32 convex_hull_from_points(const Vector3* points, const uint32 count, FrameArena& arena, uint32* out_indices) {
+  if(count < 4) {
+    return 0;
+  }
+
+  uint64 marker = arena_marker(arena);
+
+  HullBuilder hull;
+  hull.points         = points;
+  hull.count          = count;
+  hull.faces_count    = 0;
+  hull.faces_capacity = (2 * count) + 8;
+  hull.free_faces     = SOC_HULL_NONE;
+  hull.pending        = SOC_HULL_NONE;
+  hull.faces          = (HullFace*)arena_alloc(arena, sizeof(HullFace) * hull.faces_capacity, 64);
+  hull.visible        = (uint32*)arena_alloc(arena, sizeof(uint32) * hull.faces_capacity, 64);
+  hull.outsides       = (uint32*)arena_alloc(arena, sizeof(uint32) * hull.faces_capacity, 64);
+  hull.horizon        = (uint32*)arena_alloc(arena, sizeof(uint32) * 2 * count, 64);
+  hull.next           = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+  hull.edge_starts    = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+  hull.edge_ends      = (uint32*)arena_alloc(arena, sizeof(uint32) * count, 64);
+
+  if(!hull.faces || !hull.visible || !hull.outsides || !hull.horizon || !hull.next || !hull.edge_starts || !hull.edge_ends) {
+    arena_rewind(arena, marker);
+    return 0;
+  }
+
+  uint32 extremes[6];
+  bounds_extremes(points, count, extremes);
+
+  // The tolerance grows with the size of the points
+  float32 max_x  = std::fmax(std::fabs(points[extremes[0]].x), std::fabs(points[extremes[1]].x));
+  float32 max_y  = std::fmax(std::fabs(points[extremes[2]].y), std::fabs(points[extremes[3]].y));
+  float32 max_z  = std::fmax(std::fabs(points[extremes[4]].z), std::fabs(points[extremes[5]].z));
+  hull.tolerance = SOC_HULL_TOLERANCE * SOC_EPSILON * (max_x + max_y + max_z);
+
+  // The starting tetrahedron: the extreme points farthest apart, the point farthest from their line, 
+  // and the point farthest from the plane of the three
+  uint32 v0       = extremes[0];
+  uint32 v1       = extremes[1];
+  float32 max_len = vec3_dot(points[v1] - points[v0], points[v1] - points[v0]);
+  for(uint32 i = 1; i < 3; i++) {
+    Vector3 diff = points[extremes[i * 2 + 1]] - points[extremes[i * 2 + 0]];
+    if(vec3_dot(diff, diff) > max_len) {
+      v0      = extremes[i * 2 + 0];
+      v1      = extremes[i * 2 + 1];
+      max_len = vec3_dot(diff, diff);
+    }
+  }
+
+  float32 line_dist2  = 0.0f;
+  float32 plane_dist  = 0.0f;
+  Vector3 line_dir    = vec3_normalize(points[v1] - points[v0]);
+  uint32 v2           = hull_farthest(points, count, points[v0], line_dir, false, &line_dist2);
+  Vector3 plane_dir   = vec3_normalize(vec3_cross(points[v1] - points[v0], points[v2] - points[v0]));
+  uint32 v3           = hull_farthest(points, count, points[v0], plane_dir, true, &plane_dist);
+
+  if(max_len <= (hull.tolerance * hull.tolerance) || line_dist2 <= (hull.tolerance * hull.tolerance) || plane_dist <= hull.tolerance) {
+    arena_rewind(arena, marker);
+    return 0;
+  }
+
+  // Every face of the tetrahedron looks away from the remaining vertex
+  if(vec3_dot(plane_dir, points[v3] - points[v0]) > 0.0f) {
+    uint32 temp = v1;
+    v1          = v2;
+    v2          = temp;
+  }
+
+  uint32 tetra[4] = {
+    hull_face_create(hull, v0, v1, v2), 
+    hull_face_create(hull, v0, v3, v1), 
+    hull_face_create(hull, v1, v3, v2), 
+    hull_face_create(hull, v2, v3, v0),
+  };
+
+  for(uint32 f = 0; f < 4; f++) {
+    HullFace& face = hull.faces[tetra[f]];
+
+    for(uint32 e = 0; e < 3; e++) {
+      uint32 a = face.vertices[e];
+      uint32 b = face.vertices[(e + 1) % 3];
+
+      for(uint32 g = 0; g < 4; g++) {
+        const HullFace& other = hull.faces[tetra[g]];
+        
+        for(uint32 k = 0; k < 3; k++) {
+          if(g != f && other.vertices[k] == b && other.vertices[(k + 1) % 3] == a) {
+            face.neighbors[e] = tetra[g];
+          }
+        }
+      }
+    }
+  }
+
+  for(uint32 i = 0; i < count; i++) {
+    if(i != v0 && i != v1 && i != v2 && i != v3) {
+      hull_point_assign(hull, i, tetra, 4);
+    }
+  }
+
+  // Adding the farthest point of a pending face until no point is left outside
+  std::memset(hull.edge_starts, 0xff, sizeof(uint32) * count);
+  std::memset(hull.edge_ends, 0xff, sizeof(uint32) * count);
+
+  uint32 stamp     = 1;
+  bool is_complete = true;
+  while(hull.pending != SOC_HULL_NONE) {
+    stamp += 2;
+
+    if(!hull_add_point(hull, hull.pending, stamp)) {
+      is_complete = false;
+      break;
+    }
+  }
+
+  uint32 indices_count = 0;
+  for(uint32 i = 0; i < hull.faces_count && is_complete; i++) {
+    const HullFace& f = hull.faces[i];
+    if(!f.is_alive) {
+      continue;
+    }
+
+    out_indices[indices_count++] = f.vertices[0];
+    out_indices[indices_count++] = f.vertices[1];
+    out_indices[indices_count++] = f.vertices[2];
+  }
+
+  arena_rewind(arena, marker);
+  return indices_count;
+}
+#endif
+
+///////////////////////////////////////////////////////////////
+
+// Occlusion types
+///////////////////////////////////////////////////////////////
+
+// The width and height (in pixels) of the screen tiles that `occlusion_rasterize` bins the occluders into 
+// and splits its work across
+// NOTE: The width and height of an `OcclusionBuffer` must be multiples of it.
+#define SOC_OCCLUSION_TILE_SIZE 32
+
+// The number of levels in an `OcclusionBuffer`, from every pixel down to one texel per tile
+#define SOC_OCCLUSION_LEVELS 6
+
+// How far (in pixels) the vertices of an occluder can go outside of the screen before the whole triangle gets skipped, 
+// which keeps the edge functions precise
+#define SOC_OCCLUSION_GUARD_BAND 16384.0f
+
+// A low resolution, depth-only buffer of occluders that is used to cull the objects hidden behind them on the CPU
+//
+// Every level is a row-major grid of NDC depths (`z / w`, from -1 at the near plane to 1 at the far plane), with row 0 
+// at the top of the screen. `levels[0]` has a depth for every one of the `width` x `height` pixels, and each level 
+// after it is half the size of the one before, with every texel keeping the farthest depth of the 2x2 texels under it. 
+// Use `occlusion_buffer_memory_size` and `occlusion_buffer_create` to set one up, `occlusion_rasterize` to draw the 
+// occluders into it, and `occlusion_test_aabb` (or `occlusion_test_aabbs`) to find out which objects are hidden.
+// NOTE: The buffer does NOT own its memory.
+struct OcclusionBuffer {
+  float32* levels[SOC_OCCLUSION_LEVELS];
+
+  uint32 width; 
+  uint32 height;
+  uint32 tiles_x; 
+  uint32 tiles_y;
+};
+
+///////////////////////////////////////////////////////////////
+
+// Occlusion functions
+///////////////////////////////////////////////////////////////
+
+// Returns the number of bytes an `OcclusionBuffer` of `width` x `height` pixels needs
+// NOTE: `width` and `height` must be multiples of `SOC_OCCLUSION_TILE_SIZE`.
+SOC_INLINE const uint64 occlusion_buffer_memory_size(const uint32 width, const uint32 height) {
+  uint64 size = SOC_SOA_ALIGNMENT;
+  for(uint32 i = 0; i < SOC_OCCLUSION_LEVELS; i++) {
+    size += (uint64)(width >> i) * (height >> i) * sizeof(float32);
+  }
+
+  return size;
+}
+
+// Creates and returns an `OcclusionBuffer` of `width` x `height` pixels inside of `memory`, cleared to the far plane
+// NOTE: `memory` must be at least `occlusion_buffer_memory_size(width, height)` bytes.
+SOC_INLINE const OcclusionBuffer occlusion_buffer_create(void* memory, const uint32 width, const uint32 height) {
+  OcclusionBuffer buffer;
+  buffer.width   = width; 
+  buffer.height  = height; 
+  buffer.tiles_x = width / SOC_OCCLUSION_TILE_SIZE; 
+  buffer.tiles_y = height / SOC_OCCLUSION_TILE_SIZE; 
+
+  float32* level = (float32*)(((uintptr_t)memory + (SOC_SOA_ALIGNMENT - 1)) & ~(uintptr_t)(SOC_SOA_ALIGNMENT - 1));
+  for(uint32 i = 0; i < SOC_OCCLUSION_LEVELS; i++) {
+    uint64 texels_count = (uint64)(width >> i) * (height >> i);
+
+    buffer.levels[i] = level;
+    for(uint64 j = 0; j < texels_count; j++) {
+      level[j] = 1.0f;
+    }
+
+    level += texels_count;
+  }
+
+  return buffer;
+}
+
+#ifndef SOC_DECLARE_ONLY
+
+// A triangle that is ready to be rasterized, with its edge functions and depth plane relative to the 
+// center of its first pixel (`min_x`, `min_y`)
+struct OcclusionTriangle {
+  // Every edge function is `edge_start + (edge_x * dx) + (edge_y * dy)` and is positive inside of the triangle
+  float32 edge_x[3]; 
+  float32 edge_y[3]; 
+  float32 edge_start[3];
+
+  float32 depth_x; 
+  float32 depth_y; 
+  float32 depth_start;
+
+  // The closest depth of the triangle
+  float32 depth_min;
+
+  // The pixels the triangle can cover (inclusive and already clamped to the screen)
+  uint32 min_x, min_y; 
+  uint32 max_x, max_y;
+};
+
+struct OcclusionRasterJob {
+  OcclusionBuffer* buffer;
+  const Matrix4* view_projection;
+  const Vector3* positions;
+  uint32 vertices_count;
+  const uint32* indices;
+  uint32 triangles_count;
+
+  // The screen position (`x` and `y`) and NDC depth (`z`) of every vertex
+  Vector3* projected;
+
+  // The triangles get set up in `chunks_count` contiguous chunks, and every chunk writes the ones it keeps 
+  // into `triangles` starting at the index of its first triangle
+  OcclusionTriangle* triangles;
+  uint32 chunks_count;
+  uint32* accepted_counts;
+
+  // How many triangles of each chunk touch each tile (`chunk_bins[(chunk * tiles_count) + tile]`), 
+  // which then become where the chunk writes them into `bins`
+  uint32* chunk_bins;
+
+  // The triangles of tile `i` are `bins[bin_offsets[i]]` up to `bins[bin_offsets[i + 1]]`
+  uint32* bin_offsets; 
+  uint32* bins;
+};
+
+struct OcclusionTestJob {
+  const OcclusionBuffer* buffer;
+  const Matrix4* view_projection;
+  const AABB* boxes;
+  bool* out_visible;
+};
+
+// Writes the clip space `x`, `y`, `z`, and `w` of the 8 `points` transformed by `m` (in the same order as `mat4_transform_vec4`)
+SOC_INLINE void occlusion_transform(const Matrix4& m, const Vector3x8& points, floatx8* out_clip) {
+  for(uint32 i = 0; i < 4; i++) {
+    out_clip[i] = (floatx8(m.data[i]) * points.x) + (floatx8(m.data[i + 4]) * points.y) + (floatx8(m.data[i + 8]) * points.z) + floatx8(m.data[i + 12]);
+  }
+}
+
+// Converts the `clip` coordinates of 8 points to screen pixels and NDC depth, returning the lanes 
+// that are in front of the near plane (or behind the camera), which get a zero position and a depth of -2
+SOC_INLINE const maskx8 occlusion_project(const OcclusionBuffer& buffer, 
+                                          const floatx8* clip, 
+                                          floatx8* out_x, 
+                                          floatx8* out_y, 
+                                          floatx8* out_depth) {
+  floatx8 zero(0.0f); 
+  floatx8 one(1.0f);
+  floatx8 half_width((float32)buffer.width * 0.5f); 
+  floatx8 half_height((float32)buffer.height * 0.5f);
+
+  maskx8 is_clipped = ~((clip[2] >= (zero - clip[3])) & (clip[3] > zero));
+  floatx8 inv_w     = one / floatx8_select(is_clipped, one, clip[3]);
+
+  *out_x     = floatx8_select(is_clipped, zero, (clip[0] * inv_w * half_width) + half_width);
+  *out_y     = floatx8_select(is_clipped, zero, half_height - (clip[1] * inv_w * half_height));
+  *out_depth = floatx8_select(is_clipped, floatx8(-2.0f), clip[2] * inv_w);
+
+  return is_clipped;
+}
+
+// Projects the vertices in the blocks of 8 in `[begin, end)`
+SOC_INLINE void occlusion_project_range(void* user_data, const uint32 begin, const uint32 end) {
+  OcclusionRasterJob* job = (OcclusionRasterJob*)user_data;
+
+  for(uint32 i = begin * 8; i < end * 8; i += 8) {
+    Vector3 tail[8];
+    const Vector3* points = job->positions + i;
+
+    if(i + 8 > job->vertices_count) {
+      for(uint32 j = 0; j < job->vertices_count - i; j++) {
+        tail[j] = job->positions[i + j];
+      }
+      points = tail;
+    }
+
+    floatx8 clip[4], x, y, depth;
+    occlusion_transform(*job->view_projection, vec3x8_load(points), clip);
+    occlusion_project(*job->buffer, clip, &x, &y, &depth);
+
+    vec3x8_store(Vector3x8(x, y, depth), job->projected + i);
+  }
+}
+
+// Sets up the `lanes_count` triangles in `corners` (the `x`, `y`, and `z` of their 3 vertices, already in the 
+// order that puts the inside on the positive side of every edge), appends the ones that cover at least one 
+// pixel center to `triangles`, and counts how many of them touch each tile
+SOC_INLINE void occlusion_setup_batch(const OcclusionBuffer& buffer, 
+                                      const float32 corners[9][8], 
+                                      const uint32 lanes_count, 
+                                      OcclusionTriangle* triangles, 
+                                      uint32& accepted_count, 
+                                      uint32* counts) {
+  floatx8 zero(0.0f);
+  floatx8 half(0.5f);
+  floatx8 max_x((float32)(buffer.width - 1)); 
+  floatx8 max_y((float32)(buffer.height - 1));
+  floatx8 guard_min(-SOC_OCCLUSION_GUARD_BAND);
+  floatx8 guard_max_x((float32)buffer.width + SOC_OCCLUSION_GUARD_BAND); 
+  floatx8 guard_max_y((float32)buffer.height + SOC_OCCLUSION_GUARD_BAND);
+
+  floatx8 x0 = floatx8_load(corners[0]), x1 = floatx8_load(corners[1]), x2 = floatx8_load(corners[2]);
+  floatx8 y0 = floatx8_load(corners[3]), y1 = floatx8_load(corners[4]), y2 = floatx8_load(corners[5]);
+  floatx8 z0 = floatx8_load(corners[6]), z1 = floatx8_load(corners[7]), z2 = floatx8_load(corners[8]);
+
+  floatx8 area = ((x1 - x0) * (y2 - y0)) - ((y1 - y0) * (x2 - x0));
+
+  floatx8 left      = floatx8_min(floatx8_min(x0, x1), x2);
+  floatx8 right     = floatx8_max(floatx8_max(x0, x1), x2);
+  floatx8 top       = floatx8_min(floatx8_min(y0, y1), y2);
+  floatx8 bottom    = floatx8_max(floatx8_max(y0, y1), y2);
+  floatx8 depth_min = floatx8_min(floatx8_min(z0, z1), z2);
+
+  // Every comparison is false for NaNs, so those triangles get skipped as well
+  maskx8 is_accepted = (area > floatx8(SOC_EPSILON)) & 
+                       (depth_min >= floatx8(-1.0f)) & 
+                       (left >= guard_min) & (right <= guard_max_x) & 
+                       (top >= guard_min) & (bottom <= guard_max_y);
+
+  // The first and last pixel centers inside of the bounds
+  floatx8 pixel_min_x = floatx8_max(zero - floatx8_floor(half - left), zero);
+  floatx8 pixel_min_y = floatx8_max(zero - floatx8_floor(half - top), zero);
+  floatx8 pixel_max_x = floatx8_min(floatx8_floor(right - half), max_x);
+  floatx8 pixel_max_y = floatx8_min(floatx8_floor(bottom - half), max_y);
+
+  uint32 bits = maskx8_bits(is_accepted & (pixel_min_x <= pixel_max_x) & (pixel_min_y <= pixel_max_y));
+  bits       &= (1u << lanes_count) - 1;
+  if(bits == 0) {
+    return;
+  }
+
+  floatx8 ref_x = pixel_min_x + half; 
+  floatx8 ref_y = pixel_min_y + half;
+
+  floatx8 edge_x[3]     = {y0 - y1, y1 - y2, y2 - y0};
+  floatx8 edge_y[3]     = {x1 - x0, x2 - x1, x0 - x2};
+  floatx8 edge_start[3] = {(edge_x[0] * (ref_x - x0)) + (edge_y[0] * (ref_y - y0)), 
+                           (edge_x[1] * (ref_x - x1)) + (edge_y[1] * (ref_y - y1)), 
+                           (edge_x[2] * (ref_x - x2)) + (edge_y[2] * (ref_y - y2))};
+
+  floatx8 inv_area    = floatx8(1.0f) / area;
+  floatx8 depth_x     = (((z1 - z0) * (y2 - y0)) - ((z2 - z0) * (y1 - y0))) * inv_area;
+  floatx8 depth_y     = (((x1 - x0) * (z2 - z0)) - ((x2 - x0) * (z1 - z0))) * inv_area;
+  floatx8 depth_start = z0 + (depth_x * (ref_x - x0)) + (depth_y * (ref_y - y0));
+
+  for(uint32 j = 0; j < 8; j++) {
+    if(!(bits & (1 << j))) {
+      continue;
+    }
+
+    OcclusionTriangle& tri = triangles[accepted_count++];
+    for(uint32 k = 0; k < 3; k++) {
+      tri.edge_x[k]     = edge_x[k].lanes[j];
+      tri.edge_y[k]     = edge_y[k].lanes[j];
+      tri.edge_start[k] = edge_start[k].lanes[j];
+    }
+
+    tri.depth_x     = depth_x.lanes[j];
+    tri.depth_y     = depth_y.lanes[j];
+    tri.depth_start = depth_start.lanes[j];
+    tri.depth_min   = depth_min.lanes[j];
+
+    tri.min_x = (uint32)pixel_min_x.lanes[j];
+    tri.min_y = (uint32)pixel_min_y.lanes[j];
+    tri.max_x = (uint32)pixel_max_x.lanes[j];
+    tri.max_y = (uint32)pixel_max_y.lanes[j];
+
+    for(uint32 ty = tri.min_y / SOC_OCCLUSION_TILE_SIZE; ty <= tri.max_y / SOC_OCCLUSION_TILE_SIZE; ty++) {
+      for(uint32 tx = tri.min_x / SOC_OCCLUSION_TILE_SIZE; tx <= tri.max_x / SOC_OCCLUSION_TILE_SIZE; tx++) {
+        counts[(ty * buffer.tiles_x) + tx]++;
+      }
+    }
+  }
+}
+
+// Sets up the triangles of the chunks in `[begin, end)` and counts how many of them touch each tile
+// NOTE: The back faces, the triangles with a vertex in front of the near plane, and the ones that are completely 
+// off the screen get thrown out one at a time first (which only needs their projected vertices), so only the 
+// triangles that are left get set up 8 at a time.
+SOC_INLINE void occlusion_setup_range(void* user_data, const uint32 begin, const uint32 end) {
+  OcclusionRasterJob* job       = (OcclusionRasterJob*)user_data;
+  const OcclusionBuffer& buffer = *job->buffer;
+  uint32 tiles_count            = buffer.tiles_x * buffer.tiles_y;
+  float32 width                 = (float32)buffer.width;
+  float32 height                = (float32)buffer.height;
+
+  for(uint32 chunk = begin; chunk < end; chunk++) {
+    uint32 first = (uint32)(((uint64)job->triangles_count * chunk) / job->chunks_count);
+    uint32 last  = (uint32)(((uint64)job->triangles_count * (chunk + 1)) / job->chunks_count);
+
+    OcclusionTriangle* triangles = job->triangles + first;
+    uint32* counts               = job->chunk_bins + ((uint64)chunk * tiles_count);
+    uint32 accepted_count        = 0;
+
+    std::memset(counts, 0, sizeof(uint32) * tiles_count);
+
+    float32 corners[9][8];
+    uint32 lanes_count = 0;
+
+    for(uint32 i = first; i < last; i++) {
+      const uint32* triangle = job->indices + ((uint64)i * 3);
+
+      // The front faces are clockwise on the screen (since its rows go down), so swapping their last two 
+      // vertices puts the inside on the positive side of every edge
+      const Vector3& v0 = job->projected[triangle[0]];
+      const Vector3& v1 = job->projected[triangle[2]];
+      const Vector3& v2 = job->projected[triangle[1]];
+
+      // A cheaper version of the tests in `occlusion_setup_batch`, which throws out the same triangles
+      float32 area = ((v1.x - v0.x) * (v2.y - v0.y)) - ((v1.y - v0.y) * (v2.x - v0.x));
+      bool is_kept = (area > SOC_EPSILON) && 
+                     (v0.z >= -1.0f) && (v1.z >= -1.0f) && (v2.z >= -1.0f) && 
+                     !((v0.x < 0.0f) && (v1.x < 0.0f) && (v2.x < 0.0f)) && 
+                     !((v0.y < 0.0f) && (v1.y < 0.0f) && (v2.y < 0.0f)) && 
+                     !((v0.x > width) && (v1.x > width) && (v2.x > width)) && 
+                     !((v0.y > height) && (v1.y > height) && (v2.y > height));
+      if(!is_kept) {
+        continue;
+      }
+
+      corners[0][lanes_count] = v0.x; corners[1][lanes_count] = v1.x; corners[2][lanes_count] = v2.x;
+      corners[3][lanes_count] = v0.y; corners[4][lanes_count] = v1.y; corners[5][lanes_count] = v2.y;
+      corners[6][lanes_count] = v0.z; corners[7][lanes_count] = v1.z; corners[8][lanes_count] = v2.z;
+      lanes_count++;
+
+      if(lanes_count == 8) {
+        occlusion_setup_batch(buffer, corners, 8, triangles, accepted_count, counts);
+        lanes_count = 0;
+      }
+    }
+
+    // The unused lanes get a copy of the first one, so they never divide by zero
+    if(lanes_count > 0) {
+      for(uint32 k = 0; k < 9; k++) {
+        for(uint32 j = lanes_count; j < 8; j++) {
+          corners[k][j] = corners[k][0];
+        }
+      }
+
+      occlusion_setup_batch(buffer, corners, lanes_count, triangles, accepted_count, counts);
+    }
+
+    job->accepted_counts[chunk] = accepted_count;
+  }
+}
+
+// Writes the triangles of the chunks in `[begin, end)` into the bins of the tiles they touch
+SOC_INLINE void occlusion_bin_range(void* user_data, const uint32 begin, const uint32 end) {
+  OcclusionRasterJob* job = (OcclusionRasterJob*)user_data;
+  uint32 tiles_count      = job->buffer->tiles_x * job->buffer->tiles_y;
+
+  for(uint32 chunk = begin; chunk < end; chunk++) {
+    uint32 first    = (uint32)(((uint64)job->triangles_count * chunk) / job->chunks_count);
+    uint32* cursors = job->chunk_bins + ((uint64)chunk * tiles_count);
+
+    for(uint32 i = first; i < first + job->accepted_counts[chunk]; i++) {
+      const OcclusionTriangle& tri = job->triangles[i];
+
+      for(uint32 ty = tri.min_y / SOC_OCCLUSION_TILE_SIZE; ty <= tri.max_y / SOC_OCCLUSION_TILE_SIZE; ty++) {
+        for(uint32 tx = tri.min_x / SOC_OCCLUSION_TILE_SIZE; tx <= tri.max_x / SOC_OCCLUSION_TILE_SIZE; tx++) {
+          job->bins[cursors[(ty * job->buffer->tiles_x) + tx]++] = i;
+        }
+      }
+    }
+  }
+}
+
+// Draws the binned triangles of the tiles in `[begin, end)` and builds their levels
+SOC_INLINE void occlusion_rasterize_range(void* user_data, const uint32 begin, const uint32 end) {
+  OcclusionRasterJob* job = (OcclusionRasterJob*)user_data;
+  OcclusionBuffer& buffer = *job->buffer;
+
+  const float32 lane_offsets[8] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+  floatx8 lanes = floatx8_load(lane_offsets);
+  floatx8 zero(0.0f);
+  floatx8 one(1.0f);
+
+  for(uint32 tile = begin; tile < end; tile++) {
+    uint32 tile_x = (tile % buffer.tiles_x) * SOC_OCCLUSION_TILE_SIZE;
+    uint32 tile_y = (tile / buffer.tiles_x) * SOC_OCCLUSION_TILE_SIZE;
+
+    for(uint32 y = tile_y; y < tile_y + SOC_OCCLUSION_TILE_SIZE; y++) {
+      for(uint32 x = tile_x; x < tile_x + SOC_OCCLUSION_TILE_SIZE; x += 8) {
+        floatx8_store(floatx8(1.0f), buffer.levels[0] + ((uint64)y * buffer.width) + x);
+      }
+    }
+
+    // The farthest depth in the tile (so the triangles behind all of it can be skipped), which only gets 
+    // updated after the triangles that cover at least a quarter of it
+    float32 tile_max = 1.0f;
+
+    for(uint32 i = job->bin_offsets[tile]; i < job->bin_offsets[tile + 1]; i++) {
+      const OcclusionTriangle& tri = job->triangles[job->bins[i]];
+      if(tri.depth_min >= tile_max) {
+        continue;
+      }
+
+      uint32 min_x = tri.min_x > tile_x ? tri.min_x : tile_x;
+      uint32 min_y = tri.min_y > tile_y ? tri.min_y : tile_y;
+      uint32 max_x = tri.max_x < (tile_x + SOC_OCCLUSION_TILE_SIZE - 1) ? tri.max_x : (tile_x + SOC_OCCLUSION_TILE_SIZE - 1);
+      uint32 max_y = tri.max_y < (tile_y + SOC_OCCLUSION_TILE_SIZE - 1) ? tri.max_y : (tile_y + SOC_OCCLUSION_TILE_SIZE - 1);
+
+      // The spans of 8 pixels are aligned to the tile (so they never go past it), and the edges and 
+      // depth along each one of them are the same on every row
+      uint32 start_x     = min_x & ~7u;
+      uint32 spans_count = ((max_x - start_x) / 8) + 1;
+
+      floatx8 span_edges[SOC_OCCLUSION_TILE_SIZE / 8][3];
+      floatx8 span_depths[SOC_OCCLUSION_TILE_SIZE / 8];
+      for(uint32 j = 0; j < spans_count; j++) {
+        floatx8 dx = floatx8((float32)((int32)(start_x + (j * 8)) - (int32)tri.min_x)) + lanes;
+
+        span_edges[j][0] = floatx8(tri.edge_x[0]) * dx;
+        span_edges[j][1] = floatx8(tri.edge_x[1]) * dx;
+        span_edges[j][2] = floatx8(tri.edge_x[2]) * dx;
+        span_depths[j]   = floatx8(tri.depth_x) * dx;
+      }
+
+      floatx8 dy((float32)(min_y - tri.min_y));
+      for(uint32 y = min_y; y <= max_y; y++) {
+        floatx8 edge0 = floatx8(tri.edge_start[0]) + (floatx8(tri.edge_y[0]) * dy);
+        floatx8 edge1 = floatx8(tri.edge_start[1]) + (floatx8(tri.edge_y[1]) * dy);
+        floatx8 edge2 = floatx8(tri.edge_start[2]) + (floatx8(tri.edge_y[2]) * dy);
+        floatx8 depth = floatx8(tri.depth_start) + (floatx8(tri.depth_y) * dy);
+
+        float32* row = buffer.levels[0] + ((uint64)y * buffer.width) + start_x;
+        for(uint32 j = 0; j < spans_count; j++) {
+          floatx8 edges    = floatx8_min(floatx8_min(edge0 + span_edges[j][0], edge1 + span_edges[j][1]), edge2 + span_edges[j][2]);
+          maskx8 is_inside = edges >= zero;
+
+          floatx8 old_depth = floatx8_load(row + (j * 8));
+          floatx8 new_depth = floatx8_min(old_depth, depth + span_depths[j]);
+          floatx8_store(floatx8_select(is_inside, new_depth, old_depth), row + (j * 8));
+        }
+
+        dy = dy + one;
+      }
+
+      if(((max_x - min_x + 1) * (max_y - min_y + 1)) < (SOC_OCCLUSION_TILE_SIZE * SOC_OCCLUSION_TILE_SIZE / 4)) {
+        continue;
+      }
+
+      floatx8 farthest = floatx8_load(buffer.levels[0] + ((uint64)tile_y * buffer.width) + tile_x);
+      for(uint32 y = tile_y; y < tile_y + SOC_OCCLUSION_TILE_SIZE; y++) {
+        for(uint32 x = tile_x; x < tile_x + SOC_OCCLUSION_TILE_SIZE; x += 8) {
+          farthest = floatx8_max(farthest, floatx8_load(buffer.levels[0] + ((uint64)y * buffer.width) + x));
+        }
+      }
+
+      tile_max = farthest.lanes[0];
+      for(uint32 j = 1; j < 8; j++) {
+        tile_max = farthest.lanes[j] > tile_max ? farthest.lanes[j] : tile_max;
+      }
+    }
+
+    // Every texel of a level keeps the farthest depth of the 2x2 texels under it
+    for(uint32 level = 1; level < SOC_OCCLUSION_LEVELS; level++) {
+      const float32* src = buffer.levels[level - 1];
+      float32* dst       = buffer.levels[level];
+
+      uint32 src_width = buffer.width >> (level - 1);
+      uint32 dst_width = buffer.width >> level;
+      uint32 size      = SOC_OCCLUSION_TILE_SIZE >> level;
+
+      for(uint32 y = (tile_y >> level); y < (tile_y >> level) + size; y++) {
+        for(uint32 x = (tile_x >> level); x < (tile_x >> level) + size; x++) {
+          const float32* top    = src + ((uint64)(y * 2) * src_width) + (x * 2);
+          const float32* bottom = top + src_width;
+
+          float32 a = top[0] > top[1] ? top[0] : top[1];
+          float32 b = bottom[0] > bottom[1] ? bottom[0] : bottom[1];
+          dst[((uint64)y * dst_width) + x] = a > b ? a : b;
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+// Clears the `buffer` and draws the occluder triangles in `indices` (`indices_count / 3` of them, using the 
+// `vertices_count` `positions`) into it, as seen through the `view_projection` (`projection * view`, like 
+// `mat4_perspective(...) * mat4_look_at(...)`), splitting the work across `threads_count` threads
+//
+// The vertices get projected 8 at a time. The back faces and the triangles that are clipped or off the screen get 
+// thrown out right away, the rest get set up 8 at a time, and the ones that cover at least one pixel center get binned 
+// into the screen tiles they touch (in their original order). Every tile then rasterizes 
+// its own triangles 8 pixels at a time (keeping the closest depth) and builds its part of the other levels, 
+// so the threads never write to the same memory and the result is the same for any number of threads. 
+// A tile also skips the triangles that are behind everything it already has.
+//
+// Returns false if `arena` ran out of room (which leaves the `buffer` as it was). 
+// NOTE: The scratch memory comes out of the `arena` and gets freed before returning. Only the front faces get drawn 
+// (counter-clockwise, like OpenGL and `mesh_compute_normals`). Triangles with a vertex in front of the near plane 
+// (or that go more than `SOC_OCCLUSION_GUARD_BAND` pixels outside of the screen) get skipped instead of clipped, 
+// since a missing occluder can only make more objects visible.
+SOC_API const bool occlusion_rasterize(OcclusionBuffer& buffer, 
+                                       const Matrix4& view_projection, 
+                                       const Vector3* positions, 
+                                       const uint32 vertices_count, 
+                                       const uint32* indices, 
+                                       const uint32 indices_count, 
+                                       FrameArena& arena, 
+                                       const uint32 threads_count);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool occlusion_rasterize(OcclusionBuffer& buffer, 
+                                       const Matrix4& view_projection, 
+                                       const Vector3* positions, 
+                                       const uint32 vertices_count, 
+                                       const uint32* indices, 
+                                       const uint32 indices_count, 
+                                       FrameArena& arena, 
+                                       const uint32 threads_count) {
+  uint64 marker          = arena_marker(arena);
+  uint32 tiles_count     = buffer.tiles_x * buffer.tiles_y;
+  uint32 triangles_count = indices_count / 3;
+
+  // Every thread sets up its own chunk of the triangles
+  uint32 chunks_count = threads_count < 1 ? 1 : (threads_count > SOC_MAX_THREADS ? SOC_MAX_THREADS : threads_count);
+  chunks_count        = chunks_count > triangles_count ? (triangles_count > 0 ? triangles_count : 1) : chunks_count;
+
+  OcclusionRasterJob job = {};
+  job.buffer          = &buffer; 
+  job.view_projection = &view_projection; 
+  job.positions       = positions; 
+  job.vertices_count  = vertices_count;
+  job.indices         = indices; 
+  job.triangles_count = triangles_count;
+  job.chunks_count    = chunks_count;
+
+  job.projected       = (Vector3*)arena_alloc(arena, sizeof(Vector3) * ((vertices_count + 7) & ~7u), 64);
+  job.triangles       = (OcclusionTriangle*)arena_alloc(arena, sizeof(OcclusionTriangle) * triangles_count, 64);
+  job.accepted_counts = (uint32*)arena_alloc(arena, sizeof(uint32) * chunks_count, 64);
+  job.chunk_bins      = (uint32*)arena_alloc(arena, sizeof(uint32) * chunks_count * tiles_count, 64);
+  job.bin_offsets     = (uint32*)arena_alloc(arena, sizeof(uint32) * (tiles_count + 1), 64);
+
+  if(!job.projected || !job.triangles || !job.accepted_counts || !job.chunk_bins || !job.bin_offsets) {
+    arena_rewind(arena, marker);
+    return false;
+  }
+
+  parallel_for((vertices_count + 7) / 8, threads_count, occlusion_project_range, &job);
+  parallel_for(chunks_count, threads_count, occlusion_setup_range, &job);
+
+  // Every tile gets the triangles of the first chunk, then the ones of the second chunk, and so on, 
+  // which keeps them in their original order no matter how many threads there are
+  uint32 bins_count = 0;
+  for(uint32 tile = 0; tile < tiles_count; tile++) {
+    job.bin_offsets[tile] = bins_count;
+
+    for(uint32 chunk = 0; chunk < chunks_count; chunk++) {
+      uint32& count = job.chunk_bins[((uint64)chunk * tiles_count) + tile];
+      uint32 start  = bins_count;
+
+      bins_count += count;
+      count       = start;
+    }
+  }
+  job.bin_offsets[tiles_count] = bins_count;
+
+  job.bins = (uint32*)arena_alloc(arena, sizeof(uint32) * bins_count, 64);
+  if(!job.bins) {
+    arena_rewind(arena, marker);
+    return false;
+  }
+
+  parallel_for(chunks_count, threads_count, occlusion_bin_range, &job);
+  parallel_for(tiles_count, threads_count, occlusion_rasterize_range, &job);
+
+  arena_rewind(arena, marker);
+  return true;
+}
+#endif
+
+// Returns true if any part of the `box` might be visible in the `buffer` that `occlusion_rasterize` 
+// drew with the same `view_projection`
+//
+// The 8 corners get transformed at once, and the screen rectangle they cover gets tested against the 
+// level where it is at most about 4x4 texels. The box is only hidden if every one of those texels 
+// is closer than the closest corner.
+// NOTE: Boxes that cross the near plane are always visible, while boxes that are completely outside of the 
+// frustum are never visible. Like any low resolution depth buffer, a box that only shows through gaps smaller 
+// than a pixel can still get culled.
+SOC_API const bool occlusion_test_aabb(const OcclusionBuffer& buffer, const Matrix4& view_projection, const AABB& box);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API const bool occlusion_test_aabb(const OcclusionBuffer& buffer, const Matrix4& view_projection, const AABB& box) {
+  float32 corners[3][8];
+  for(uint32 i = 0; i < 8; i++) {
+    corners[0][i] = (i & 1) ? box.max.x : box.min.x;
+    corners[1][i] = (i & 2) ? box.max.y : box.min.y;
+    corners[2][i] = (i & 4) ? box.max.z : box.min.z;
+  }
+
+  floatx8 clip[4], x, y, depth;
+  occlusion_transform(view_projection, Vector3x8(floatx8_load(corners[0]), floatx8_load(corners[1]), floatx8_load(corners[2])), clip);
+
+  // The box is outside of the frustum if all of its corners are outside of the same plane (even behind the camera)
+  floatx8 neg_w = floatx8(0.0f) - clip[3];
+  if(maskx8_all(clip[0] < neg_w) || maskx8_all(clip[0] > clip[3]) || 
+     maskx8_all(clip[1] < neg_w) || maskx8_all(clip[1] > clip[3]) || 
+     maskx8_all(clip[2] < neg_w) || maskx8_all(clip[2] > clip[3])) {
+    return false;
+  }
+
+  if(maskx8_any(occlusion_project(buffer, clip, &x, &y, &depth))) {
+    return true;
+  }
+
+  float32 min_x = x.lanes[0], max_x = x.lanes[0];
+  float32 min_y = y.lanes[0], max_y = y.lanes[0];
+  float32 min_depth = depth.lanes[0];
+
+  for(uint32 i = 1; i < 8; i++) {
+    min_x     = x.lanes[i] < min_x ? x.lanes[i] : min_x;
+    max_x     = x.lanes[i] > max_x ? x.lanes[i] : max_x;
+    min_y     = y.lanes[i] < min_y ? y.lanes[i] : min_y;
+    max_y     = y.lanes[i] > max_y ? y.lanes[i] : max_y;
+    min_depth = depth.lanes[i] < min_depth ? depth.lanes[i] : min_depth;
+  }
+
+  // Every comparison is false for NaNs, so those boxes stay visible
+  if(max_x < 0.0f || min_x >= (float32)buffer.width || max_y < 0.0f || min_y >= (float32)buffer.height || min_depth > 1.0f) {
+    return false;
+  }
+
+  uint32 pixel_min_x = min_x > 0.0f ? (uint32)min_x : 0;
+  uint32 pixel_min_y = min_y > 0.0f ? (uint32)min_y : 0;
+  uint32 pixel_max_x = max_x < (float32)(buffer.width - 1) ? (uint32)max_x : buffer.width - 1;
+  uint32 pixel_max_y = max_y < (float32)(buffer.height - 1) ? (uint32)max_y : buffer.height - 1;
+
+  uint32 level = 0;
+  while(level < (SOC_OCCLUSION_LEVELS - 1) && 
+        (((pixel_max_x >> level) - (pixel_min_x >> level)) >= 4 || ((pixel_max_y >> level) - (pixel_min_y >> level)) >= 4)) {
+    level++;
+  }
+
+  const float32* texels = buffer.levels[level];
+  uint32 level_width    = buffer.width >> level;
+
+  for(uint32 ty = (pixel_min_y >> level); ty <= (pixel_max_y >> level); ty++) {
+    for(uint32 tx = (pixel_min_x >> level); tx <= (pixel_max_x >> level); tx++) {
+      if(!(texels[((uint64)ty * level_width) + tx] < min_depth)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+SOC_INLINE void occlusion_test_range(void* user_data, const uint32 begin, const uint32 end) {
+  OcclusionTestJob* job = (OcclusionTestJob*)user_data;
+
+  for(uint32 i = begin; i < end; i++) {
+    job->out_visible[i] = occlusion_test_aabb(*job->buffer, *job->view_projection, job->boxes[i]);
+  }
+}
+#endif
+
+// Tests all of the `count` `boxes` against the `buffer` (see `occlusion_test_aabb`) and writes 
+// the results into `out_visible`, splitting the work across `threads_count` threads
+SOC_API void occlusion_test_aabbs(const OcclusionBuffer& buffer, 
+                                  const Matrix4& view_projection, 
+                                  const AABB* boxes, 
+                                  const uint32 count, 
+                                  const uint32 threads_count, 
+                                  bool* out_visible);
+
+#ifndef SOC_DECLARE_ONLY
+SOC_API void occlusion_test_aabbs(const OcclusionBuffer& buffer, 
+                                  const Matrix4& view_projection, 
+                                  const AABB* boxes, 
+                                  const uint32 count, 
+                                  const uint32 threads_count, 
+                                  bool* out_visible) {
+  OcclusionTestJob job = {};
+  job.buffer          = &buffer; 
+  job.view_projection = &view_projection; 
+  job.boxes           = boxes; 
+  job.out_visible     = out_visible;
+
+  parallel_for(count, threads_count, occlusion_test_range, &job);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////
 
 } // End of soc